@@ -459,8 +459,13 @@ declare global {
          */
         subscribe(hook: HookType, callback: Function): IDisposable;
 
-        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void): IDisposable;
-        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void): IDisposable;
+        /**
+         * Subscribes to the given action hook. When actions are given in the options, the callback is only called
+         * for those actions and the event arguments are not created at all for other actions.
+         * @param options Restricts the actions the callback is called for.
+         */
+        subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void, options?: ActionHookOptions): IDisposable;
+        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void, options?: ActionHookOptions): IDisposable;
         subscribe(hook: "interval.tick", callback: () => void): IDisposable;
         subscribe(hook: "interval.day", callback: () => void): IDisposable;
         subscribe(hook: "network.chat", callback: (e: NetworkChatEventArgs) => void): IDisposable;
@@ -506,6 +511,38 @@ declare global {
          * @param handle The numerical handle of the registered timeout to remove.
          */
         clearTimeout(handle: number): void;
+
+        /**
+         * Runs a script on a background thread, so that expensive work does not slow down the game.
+         * The worker script runs in its own script context that has no access to the game or to any
+         * of the plugin APIs. It can only receive messages through a global `onmessage` function and
+         * reply to them with the global `postMessage` function. Messages are copied as JSON, so only
+         * plain data can be passed in either direction.
+         * @param code The source code of the worker script.
+         */
+        createWorker(code: string): Worker;
+    }
+
+    interface Worker {
+        /**
+         * Sends a copy of the value to the worker's `onmessage` function.
+         */
+        postMessage(message: any): Worker;
+
+        /**
+         * Listens to the values the worker posts back, or to the errors thrown by the worker script.
+         * Listeners are called on the game thread.
+         */
+        on(event: "message", callback: (message: any) => void): Worker;
+        on(event: "error", callback: (message: string) => void): Worker;
+        off(event: "message", callback: (message: any) => void): Worker;
+        off(event: "error", callback: (message: string) => void): Worker;
+
+        /**
+         * Stops the worker once it has finished handling its current message. Messages that have not
+         * been handled yet are discarded. Workers are also stopped when their plugin is stopped.
+         */
+        terminate(): void;
     }
 
     interface Configuration {
@@ -1280,6 +1317,13 @@ declare global {
         height: number;
     }
 
+    interface ActionHookOptions {
+        /**
+         * The names of the actions to call the hook for, custom actions are identified by their registered name.
+         */
+        actions?: (ActionType | string)[];
+    }
+
     interface GameActionEventArgs<T = object> {
         readonly player: number;
         readonly type: number;
@@ -1417,6 +1461,29 @@ declare global {
          * @param elementIndex The index of the track element on the tile.
          */
         getTrackIterator(location: CoordsXY, elementIndex: number): TrackIterator | null;
+
+        /**
+         * Reads one field of every tile in a range into a typed array, ordered by row and then by column.
+         * This is much faster than calling {@link getTile} for each tile when scanning large areas.
+         * The range is clamped to the map.
+         * - surfaceHeight: the base height of the surface element, as a Uint8Array.
+         * - waterHeight: the water height of the surface element, as a Uint16Array.
+         * - ownership: the ownership flags of the surface element, as a Uint8Array.
+         * - elementTypes: a bit set of the tile element types on the tile, bit n being set if there is an element of
+         *   type n, in the order listed by {@link TileElementType}, as a Uint16Array.
+         * @param range The range to read, in coordinates.
+         * @param field The field to read.
+         */
+        queryTiles(range: MapRange, field: "surfaceHeight" | "ownership"): Uint8Array;
+        queryTiles(range: MapRange, field: "waterHeight" | "elementTypes"): Uint16Array;
+
+        /**
+         * Gets the id, position and state of all entities of the given type, packed into an Int32Array of five values
+         * per entity: id, x, y, z and state. The state is the peep state for guests and staff, the vehicle status for
+         * cars, the litter type for litter and 0 for other entities.
+         * @param type The type of entities to query.
+         */
+        queryEntities(type: "balloon" | "car" | "litter" | "duck" | "peep" | "guest" | "staff"): Int32Array;
     }
 
     type TileElementType =
@@ -1904,6 +1971,11 @@ declare global {
          */
         readonly downtime: number;
 
+        /**
+         * The current queue statistics of the ride and its history, sampled about every 30 seconds.
+         */
+        readonly analytics: RideAnalytics;
+
         /**
          * The currently set chain lift speed in miles per hour.
          */
@@ -1920,6 +1992,50 @@ declare global {
         readonly minLiftHillSpeed: number;
     }
 
+    interface RideAnalytics {
+        /**
+         * The total number of guests queuing at all stations.
+         */
+        readonly queueLength: number;
+
+        /**
+         * The longest queue time in minutes of all stations.
+         */
+        readonly queueTime: number;
+
+        /**
+         * The statistics of the last 64 customer intervals, oldest first.
+         */
+        readonly history: RideAnalyticsSample[];
+    }
+
+    interface RideAnalyticsSample {
+        /**
+         * The number of guests that entered the ride in the interval.
+         */
+        readonly customers: number;
+
+        /**
+         * The total queue length at the end of the interval.
+         */
+        readonly queueLength: number;
+
+        /**
+         * The longest queue time in minutes at the end of the interval.
+         */
+        readonly queueTime: number;
+
+        /**
+         * The number of breakdowns that started in the interval.
+         */
+        readonly breakdowns: number;
+
+        /**
+         * The estimated income per hour at the end of the interval.
+         */
+        readonly incomePerHour: number;
+    }
+
     type RideClassification = "ride" | "stall" | "facility";
 
     type RideStatus = "closed" | "open" | "testing" | "simulating";
@@ -4280,10 +4396,54 @@ declare global {
 
     interface Profiler {
         getData(): ProfiledFunction[];
+        /**
+         * Gets the statistics of every subscribed hook of every plugin. These are always recorded,
+         * whether the profiler is started or not.
+         */
+        getHookData(): ProfiledHook[];
         start(): void;
         stop(): void;
+        /**
+         * Resets the profiler data and the hook statistics.
+         */
         reset(): void;
         readonly enabled: boolean;
+        /**
+         * Starts recording a timeline of the profiled functions and game ticks. With a slow tick
+         * threshold in milliseconds, only the ticks that took at least that long are kept.
+         */
+        startTrace(slowTickThreshold?: number): void;
+        stopTrace(): void;
+        /**
+         * Gets the recorded timeline in the Chrome trace event format, which can be saved as a
+         * .json file and opened in chrome://tracing or https://ui.perfetto.dev.
+         */
+        getTrace(): string;
+        readonly tracing: boolean;
+    }
+
+    interface ProfiledHook {
+        readonly plugin: string;
+        readonly hook: HookType;
+        readonly callCount: number;
+        /**
+         * The total and maximum time of a call in milliseconds.
+         */
+        readonly totalTime: number;
+        readonly maxTime: number;
+        /**
+         * The net change in bytes of the size of the script heap across all calls.
+         */
+        readonly heapGrowth: number;
+        /**
+         * The number of calls that took longer than the hook_time_budget configured in the plugin
+         * section of config.ini.
+         */
+        readonly overBudgetCount: number;
+        /**
+         * Whether the hook is no longer called because it went over the budget.
+         */
+        readonly disabled: boolean;
     }
 
     interface ProfiledFunction {
@@ -28,6 +28,7 @@
 #include <openrct2/interface/Window.h>
 #include <openrct2/management/NewsItem.h>
 #include <openrct2/object/ObjectManager.h>
+#include <openrct2/ride/Ride.h>
 #include <openrct2/scenario/ScenarioRepository.h>
 #include <openrct2/scenario/ScenarioSources.h>
 #include <openrct2/title/TitleScreen.h>
@@ -380,6 +381,8 @@ namespace OpenRCT2::Title
             windowManager->SetMainView(gSavedView, gSavedViewZoom, gSavedViewRotation);
             ResetEntitySpatialIndices();
             ResetAllSpriteQuadrantPlacements();
+            RideUpdateFavouritedStat();
+            RideUpdateAnalyticsQueues();
             auto intent = Intent(INTENT_ACTION_REFRESH_NEW_RIDES);
             ContextBroadcastIntent(&intent);
             ScenerySetDefaultPlacementConfiguration();
@@ -161,7 +161,7 @@ public:
         CentreMapOnViewPoint();
         FootpathSelectDefault();
 
-        _mapWidthAndHeightLinked = gMapSize.x == gMapSize.y;
+        _mapWidthAndHeightLinked = GetMapSize().x == GetMapSize().y;
 
         // Reset land rights tool size
         _landRightsToolSize = 1;
@@ -624,7 +624,7 @@ public:
                     size += 2;
                     size = std::clamp(size, MINIMUM_MAP_SIZE_TECHNICAL, MAXIMUM_MAP_SIZE_TECHNICAL);
 
-                    TileCoordsXY newMapSize = gMapSize;
+                    TileCoordsXY newMapSize = GetMapSize();
                     if (_resizeDirection != ResizeDirection::X)
                         newMapSize.y = size;
                     if (_resizeDirection != ResizeDirection::Y)
@@ -749,7 +749,7 @@ public:
             pressed_widgets |= (1uLL << WIDX_CONSTRUCTION_RIGHTS_OWNED_CHECKBOX);
 
         // Set disabled widgets
-        SetWidgetDisabled(WIDX_MAP_SIZE_LINK, gMapSize.x != gMapSize.y);
+        SetWidgetDisabled(WIDX_MAP_SIZE_LINK, GetMapSize().x != GetMapSize().y);
 
         // Resize widgets to window size
         ResizeFrameWithPage();
@@ -972,7 +972,7 @@ private:
 
     void IncreaseMapSize()
     {
-        auto newMapSize = gMapSize;
+        auto newMapSize = GetMapSize();
         if (IsWidgetPressed(WIDX_MAP_SIZE_LINK) || _resizeDirection == ResizeDirection::Y)
             newMapSize.y++;
         if (IsWidgetPressed(WIDX_MAP_SIZE_LINK) || _resizeDirection == ResizeDirection::X)
@@ -984,7 +984,7 @@ private:
 
     void DecreaseMapSize()
     {
-        auto newMapSize = gMapSize;
+        auto newMapSize = GetMapSize();
         if (IsWidgetPressed(WIDX_MAP_SIZE_LINK) || _resizeDirection == ResizeDirection::Y)
             newMapSize.y--;
         if (IsWidgetPressed(WIDX_MAP_SIZE_LINK) || _resizeDirection == ResizeDirection::X)
@@ -1314,8 +1314,8 @@ private:
 
         // Push width (Y) and height (X) to the common formatter arguments for the map size spinners to use
         auto ft = Formatter::Common();
-        ft.Add<uint16_t>(gMapSize.y - 2);
-        ft.Add<uint16_t>(gMapSize.x - 2);
+        ft.Add<uint16_t>(GetMapSize().y - 2);
+        ft.Add<uint16_t>(GetMapSize().x - 2);
     }
 
     void InputLandSize()
@@ -6904,7 +6904,7 @@ static void WindowRideCustomerMouseup(WindowBase* w, WidgetIndex widgetIndex)
 static void WindowRideCustomerResize(WindowBase* w)
 {
     w->flags |= WF_RESIZABLE;
-    WindowSetResize(*w, 316, 163, 316, 163);
+    WindowSetResize(*w, 316, 221, 316, 221);
 }
 
 /**
@@ -6966,6 +6966,40 @@ static void WindowRideCustomerInvalidate(WindowBase* w)
     }
 }
 
+static void WindowRideCustomerDrawQueueHistory(WindowBase* w, DrawPixelInfo* dpi, const Ride& ride)
+{
+    constexpr int32_t barWidth = 4;
+    constexpr int32_t graphHeight = 40;
+
+    const auto& widget = window_ride_customer_widgets[WIDX_PAGE_BACKGROUND];
+    auto screenCoords = w->windowPos + ScreenCoordsXY{ widget.left + 4, widget.bottom - graphHeight - LIST_ROW_HEIGHT - 4 };
+    DrawTextBasic(dpi, screenCoords, STR_QUEUE_LENGTH);
+    screenCoords.y += LIST_ROW_HEIGHT;
+
+    const auto& history = ride.Analytics.History;
+    const auto graphWidth = static_cast<int32_t>(history.capacity()) * barWidth;
+    GfxFillRectInset(
+        dpi, { screenCoords, screenCoords + ScreenCoordsXY{ graphWidth + 1, graphHeight } }, w->colours[1], INSET_RECT_F_30);
+
+    int32_t maxQueueLength = 1;
+    for (size_t i = 0; i < history.size(); i++)
+    {
+        maxQueueLength = std::max<int32_t>(maxQueueLength, history[i].QueueLength);
+    }
+
+    // Newest sample on the right
+    const auto bottom = screenCoords.y + graphHeight - 1;
+    auto x = screenCoords.x + 1 + static_cast<int32_t>(history.capacity() - history.size()) * barWidth;
+    for (size_t i = 0; i < history.size(); i++, x += barWidth)
+    {
+        const auto barHeight = history[i].QueueLength * (graphHeight - 2) / maxQueueLength;
+        if (barHeight > 0)
+        {
+            GfxFillRect(dpi, { { x, bottom - barHeight }, { x + barWidth - 2, bottom - 1 } }, PALETTE_INDEX_21);
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x006AD6CD
@@ -7037,7 +7071,7 @@ static void WindowRideCustomerPaint(WindowBase* w, DrawPixelInfo* dpi)
     // Queue time
     if (ride->IsRide())
     {
-        queueTime = ride->GetMaxQueueTime();
+        queueTime = ride->Analytics.MaxQueueTime;
         stringId = queueTime == 1 ? STR_QUEUE_TIME_MINUTE : STR_QUEUE_TIME_MINUTES;
         ft = Formatter();
         ft.Add<int32_t>(queueTime);
@@ -7092,6 +7126,11 @@ static void WindowRideCustomerPaint(WindowBase* w, DrawPixelInfo* dpi)
     ft = Formatter();
     ft.Add<int16_t>(age);
     DrawTextBasic(dpi, screenCoords, stringId, ft);
+
+    if (ride->IsRide())
+    {
+        WindowRideCustomerDrawQueueHistory(w, dpi, *ride);
+    }
 }
 
 #pragma endregion
@@ -2670,9 +2670,9 @@ private:
             return;
         }
 
-        auto preserveMapSize = gMapSize;
+        auto preserveMapSize = GetMapSize();
 
-        gMapSize = { MAXIMUM_MAP_SIZE_TECHNICAL, MAXIMUM_MAP_SIZE_TECHNICAL };
+        SetMapSize({ MAXIMUM_MAP_SIZE_TECHNICAL, MAXIMUM_MAP_SIZE_TECHNICAL });
 
         // Setup non changing parts of the temporary track tile element
         tempTrackTileElement.SetType(TileElementType::Track);
@@ -2736,7 +2736,7 @@ private:
             trackBlock++;
         }
 
-        gMapSize = preserveMapSize;
+        SetMapSize(preserveMapSize);
 
         PaintSessionArrange(*session);
         PaintDrawStructs(*session);
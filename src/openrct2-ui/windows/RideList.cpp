@@ -644,7 +644,7 @@ public:
                     break;
                 case INFORMATION_TYPE_QUEUE_LENGTH:
                 {
-                    const auto queueLength = ridePtr->GetTotalQueueLength();
+                    const auto queueLength = ridePtr->Analytics.QueueLength;
                     ft.Add<uint16_t>(queueLength);
 
                     if (queueLength == 1)
@@ -663,7 +663,7 @@ public:
                 }
                 case INFORMATION_TYPE_QUEUE_TIME:
                 {
-                    const auto maxQueueTime = ridePtr->GetMaxQueueTime();
+                    const auto maxQueueTime = ridePtr->Analytics.MaxQueueTime;
                     ft.Add<uint16_t>(maxQueueTime);
 
                     if (maxQueueTime > 1)
@@ -870,13 +870,13 @@ private:
                 case INFORMATION_TYPE_QUEUE_LENGTH:
                     currentListPosition = SortList(
                         currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.GetTotalQueueLength() <= otherRide.GetTotalQueueLength();
+                            return thisRide.Analytics.QueueLength <= otherRide.Analytics.QueueLength;
                         });
                     break;
                 case INFORMATION_TYPE_QUEUE_TIME:
                     currentListPosition = SortList(
                         currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.GetMaxQueueTime() <= otherRide.GetMaxQueueTime();
+                            return thisRide.Analytics.MaxQueueTime <= otherRide.Analytics.MaxQueueTime;
                         });
                     break;
                 case INFORMATION_TYPE_RELIABILITY:
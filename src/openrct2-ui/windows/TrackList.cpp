@@ -23,6 +23,7 @@
 #include <openrct2/ride/RideConstruction.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/ride/TrackDesign.h>
+#include <openrct2/ride/TrackDesignPreviewCache.h>
 #include <openrct2/ride/TrackDesignRepository.h>
 #include <openrct2/sprites.h>
 #include <openrct2/windows/Intent.h>
@@ -78,6 +79,7 @@ private:
     uint16_t _loadedTrackDesignIndex;
     std::unique_ptr<TrackDesign> _loadedTrackDesign;
     std::vector<uint8_t> _trackDesignPreviewPixels;
+    TrackDesignPreviewCache _previewCache;
 
     void FilterList()
     {
@@ -185,17 +187,40 @@ private:
         _trackDesigns = repo->GetItemsForObjectEntry(item.Type, entryName);
 
         FilterList();
+
+        std::vector<u8string> paths;
+        paths.reserve(_trackDesigns.size());
+        for (const auto& trackDesign : _trackDesigns)
+        {
+            paths.push_back(trackDesign.path);
+        }
+        _previewCache.Prefetch(paths);
     }
 
     bool LoadDesignPreview(const u8string& path)
     {
         _loadedTrackDesign = TrackDesignImport(path.c_str());
-        if (_loadedTrackDesign != nullptr)
+        if (_loadedTrackDesign == nullptr)
         {
-            TrackDesignDrawPreview(_loadedTrackDesign.get(), _trackDesignPreviewPixels.data());
+            return false;
+        }
+
+        // Cached previews show all of the design's scenery, they are shown without placing the design again
+        auto* pixels = _trackDesignPreviewPixels.data();
+        TrackDesignPreviewCache::Placement placement;
+        if (!gTrackDesignSceneryToggle && _previewCache.Get(path, pixels, placement))
+        {
+            _loadedTrackDesign->cost = placement.Cost;
+            _loadedTrackDesign->track_flags = placement.TrackFlags;
             return true;
         }
-        return false;
+
+        TrackDesignDrawPreview(_loadedTrackDesign.get(), pixels);
+        if (!gTrackDesignSceneryToggle && !(_loadedTrackDesign->track_flags & TRACK_DESIGN_FLAG_SCENERY_UNAVAILABLE))
+        {
+            _previewCache.Store(path, pixels, { _loadedTrackDesign->cost, _loadedTrackDesign->track_flags });
+        }
+        return true;
     }
 
 public:
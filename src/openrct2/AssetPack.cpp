@@ -129,9 +129,9 @@ public:
         throw std::runtime_error("Not implemented");
     }
 
-    bool ShouldLoadImages() override
+    ObjectImageLoadMode GetImageLoadMode() override
     {
-        return true;
+        return ObjectImageLoadMode::Full;
     }
 
     std::vector<uint8_t> GetData(std::string_view path) override
@@ -36,6 +36,7 @@
 #include "core/Guard.hpp"
 #include "core/Http.h"
 #include "core/MemoryStream.h"
+#include "core/Parallel.h"
 #include "core/Path.hpp"
 #include "core/String.hpp"
 #include "core/Timer.hpp"
@@ -80,6 +81,7 @@
 #include <future>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <string>
 
 using namespace OpenRCT2;
@@ -135,6 +137,7 @@ namespace OpenRCT2
         float _realtimeAccumulator = 0.0f;
         float _timeScale = 1.0f;
         bool _variableFrame = false;
+        std::timed_mutex _frameMutex;
 
         // If set, will end the OpenRCT2 game loop. Intentionally private to this module so that the flag can not be set back to
         // false.
@@ -336,6 +339,11 @@ namespace OpenRCT2
 
             CrashInit();
 
+            if (gConfigGeneral.ThreadCount > 0)
+            {
+                Parallel::SetThreadCount(static_cast<size_t>(gConfigGeneral.ThreadCount));
+            }
+
             if (String::Equals(gConfigGeneral.LastRunVersion, OPENRCT2_VERSION))
             {
                 gOpenRCT2ShowChangelog = false;
@@ -472,6 +480,12 @@ namespace OpenRCT2
                 }
                 LightFXInit();
             }
+            else
+            {
+                // Needed to allocate the same image ids as instances with graphics
+                GfxLoadG1Headers(*_env);
+                GfxLoadCsgHeaders();
+            }
 
             InputResetPlaceObjModifier();
             ViewportInitAll();
@@ -1099,10 +1113,14 @@ namespace OpenRCT2
         {
             PROFILED_FUNCTION();
 
+            std::unique_lock<std::timed_mutex> frameLock(_frameMutex);
             _uiContext->ProcessMessages();
 
             if (_ticksAccumulator < GAME_UPDATE_TIME_MS)
             {
+                // Other threads can use the game state until the next tick
+                frameLock.unlock();
+
                 const auto sleepTimeSec = (GAME_UPDATE_TIME_MS - _ticksAccumulator);
                 Platform::Sleep(static_cast<uint32_t>(sleepTimeSec * 1000.f));
                 return;
@@ -1131,6 +1149,7 @@ namespace OpenRCT2
             const bool shouldDraw = ShouldDraw();
             auto& tweener = EntityTweener::Get();
 
+            std::lock_guard<std::timed_mutex> frameLock(_frameMutex);
             _uiContext->ProcessMessages();
 
             while (_ticksAccumulator >= GAME_UPDATE_TIME_MS)
@@ -1167,6 +1186,8 @@ namespace OpenRCT2
             _drawingEngine->BeginDraw();
             _painter->Paint(*_drawingEngine);
             _drawingEngine->EndDraw();
+
+            GfxObjectUnloadUnusedImages();
         }
 
         void Tick()
@@ -1343,6 +1364,11 @@ namespace OpenRCT2
         {
             return _timeScale;
         }
+
+        std::timed_mutex& GetFrameMutex() override
+        {
+            return _frameMutex;
+        }
     };
 
     Context* Context::Instance = nullptr;
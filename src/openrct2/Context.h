@@ -15,6 +15,7 @@
 #include "world/Location.hpp"
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 struct IObjectManager;
@@ -165,6 +166,11 @@ namespace OpenRCT2
 
         virtual void SetTimeScale(float newScale) abstract;
         virtual float GetTimeScale() const abstract;
+
+        /**
+         * Held by the game loop while it runs a frame. Other threads may use the game state while they hold it.
+         */
+        virtual std::timed_mutex& GetFrameMutex() abstract;
     };
 
     [[nodiscard]] std::unique_ptr<IContext> CreateContext();
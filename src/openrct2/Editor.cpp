@@ -202,8 +202,8 @@ namespace Editor
      */
     static void SetAllLandOwned()
     {
-        MapRange range = { 2 * COORDS_XY_STEP, 2 * COORDS_XY_STEP, (gMapSize.x - 3) * COORDS_XY_STEP,
-                           (gMapSize.y - 3) * COORDS_XY_STEP };
+        MapRange range = { 2 * COORDS_XY_STEP, 2 * COORDS_XY_STEP, (GetMapSize().x - 3) * COORDS_XY_STEP,
+                           (GetMapSize().y - 3) * COORDS_XY_STEP };
         auto landSetRightsAction = LandSetRightsAction(range, LandSetRightSetting::SetForSale);
         landSetRightsAction.SetFlags(GAME_COMMAND_FLAG_NO_SPEND);
         GameActions::Execute(&landSetRightsAction);
@@ -428,7 +428,7 @@ void GameFixSaveVars()
 
             // Fix the invisible border tiles.
             // At this point, we can be sure that surfaceElement is not NULL.
-            if (x == 0 || x == gMapSize.x - 1 || y == 0 || y == gMapSize.y - 1)
+            if (x == 0 || x == GetMapSize().x - 1 || y == 0 || y == GetMapSize().y - 1)
             {
                 surfaceElement->SetBaseZ(MINIMUM_LAND_HEIGHT_BIG);
                 surfaceElement->SetClearanceZ(MINIMUM_LAND_HEIGHT_BIG);
@@ -452,6 +452,10 @@ void GameFixSaveVars()
     UpdateConsolidatedPatrolAreas();
 
     MapCountRemainingLandRights();
+
+    // Favourites are counted as guests change them from here on, saves only contain a weekly snapshot of the counts
+    RideUpdateFavouritedStat();
+    RideUpdateAnalyticsQueues();
 }
 
 void GameLoadInit()
@@ -21,6 +21,7 @@
 #include "actions/GameAction.h"
 #include "config/Config.h"
 #include "entity/EntityRegistry.h"
+#include "entity/Guest.h"
 #include "entity/PatrolArea.h"
 #include "entity/Staff.h"
 #include "interface/Screenshot.h"
@@ -252,10 +253,38 @@ void GameState::Tick()
 }
 
 void GameState::UpdateLogic(LogicTimings* timings)
+{
+    UpdateLogicImpl<false>(timings);
+}
+
+void GameState::Simulate(uint32_t ticks)
+{
+    // Network games have to poll and flush every tick to stay in sync with the other players
+    if (NetworkGetMode() != NETWORK_MODE_NONE)
+    {
+        for (uint32_t i = 0; i < ticks; i++)
+        {
+            UpdateLogicImpl<false>(nullptr);
+        }
+        return;
+    }
+
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        UpdateLogicImpl<true>(nullptr);
+    }
+}
+
+template<bool TSimulationOnly> void GameState::UpdateLogicImpl(LogicTimings* timings)
 {
     PROFILED_FUNCTION();
+    Profiling::Tracing::ScopedTick tracingTick(gCurrentTicks);
 
-    auto start_time = std::chrono::high_resolution_clock::now();
+    std::chrono::high_resolution_clock::time_point start_time;
+    if (timings != nullptr)
+    {
+        start_time = std::chrono::high_resolution_clock::now();
+    }
 
     auto report_time = [timings, start_time](LogicTimePart part) {
         if (timings != nullptr)
@@ -270,8 +299,11 @@ void GameState::UpdateLogic(LogicTimings* timings)
 
     GetContext()->GetReplayManager()->Update();
 
-    NetworkUpdate();
-    report_time(LogicTimePart::NetworkUpdate);
+    if constexpr (!TSimulationOnly)
+    {
+        NetworkUpdate();
+        report_time(LogicTimePart::NetworkUpdate);
+    }
 
     if (NetworkGetMode() == NETWORK_MODE_SERVER)
     {
@@ -354,29 +386,37 @@ void GameState::UpdateLogic(LogicTimings* timings)
     News::UpdateCurrentItem();
     report_time(LogicTimePart::News);
 
+    // Also removes finished animations from the list, so it has to run even when nothing is drawn
     MapAnimationInvalidateAll();
     report_time(LogicTimePart::MapAnimation);
-    VehicleSoundsUpdate();
-    PeepUpdateCrowdNoise();
-    ClimateUpdateSound();
-    report_time(LogicTimePart::Sounds);
-    EditorOpenWindowsForCurrentStep();
-
-    // Update windows
-    // WindowDispatchUpdateAll();
 
-    // Start autosave timer after update
-    if (gLastAutoSaveUpdate == AUTOSAVE_PAUSE)
+    if constexpr (!TSimulationOnly)
     {
-        gLastAutoSaveUpdate = Platform::GetTicks();
+        VehicleSoundsUpdate();
+        PeepUpdateCrowdNoise();
+        ClimateUpdateSound();
+        report_time(LogicTimePart::Sounds);
+        EditorOpenWindowsForCurrentStep();
+
+        // Update windows
+        // WindowDispatchUpdateAll();
+
+        // Start autosave timer after update
+        if (gLastAutoSaveUpdate == AUTOSAVE_PAUSE)
+        {
+            gLastAutoSaveUpdate = Platform::GetTicks();
+        }
     }
 
     GameActions::ProcessQueue();
     report_time(LogicTimePart::GameActions);
 
-    NetworkProcessPending();
-    NetworkFlush();
-    report_time(LogicTimePart::NetworkFlush);
+    if constexpr (!TSimulationOnly)
+    {
+        NetworkProcessPending();
+        NetworkFlush();
+        report_time(LogicTimePart::NetworkFlush);
+    }
 
     gCurrentTicks++;
     gSavedAge++;
@@ -392,6 +432,8 @@ void GameState::UpdateLogic(LogicTimings* timings)
     report_time(LogicTimePart::Scripts);
 #endif
 
+    Profiling::Tracing::Counter("Guests in park", gNumGuestsInPark);
+
     if (timings != nullptr)
     {
         timings->CurrentIdx = (timings->CurrentIdx + 1) % LOGIC_UPDATE_MEASUREMENTS_COUNT;
@@ -87,7 +87,15 @@ namespace OpenRCT2
         void Tick();
         void UpdateLogic(LogicTimings* timings = nullptr);
 
+        /**
+         * Runs the given number of game ticks without any of the work that only matters for presentation, such as
+         * sounds, editor windows, the autosave timer and polling the network. The resulting game state is the same as
+         * calling UpdateLogic for each tick. Network games always use UpdateLogic.
+         */
+        void Simulate(uint32_t ticks);
+
     private:
+        template<bool TSimulationOnly> void UpdateLogicImpl(LogicTimings* timings);
         void CreateStateSnapshot();
     };
 } // namespace OpenRCT2
@@ -11,6 +11,7 @@
 
 #include "Context.h"
 #include "Game.h"
+#include "GameState.h"
 #include "GameStateSnapshots.h"
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
@@ -35,7 +36,9 @@
 #include "world/Park.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <memory>
 #include <vector>
 
@@ -70,6 +73,13 @@ namespace OpenRCT2
         }
     };
 
+    struct ReplayKeyframe
+    {
+        uint32_t tick = 0;
+        OpenRCT2::MemoryStream parkData;
+        OpenRCT2::MemoryStream parkParams;
+    };
+
     struct ReplayRecordFile
     {
         uint32_t magic;
@@ -95,11 +105,15 @@ namespace OpenRCT2
         std::vector<std::pair<uint32_t, EntitiesChecksum>> checksums;
         uint32_t checksumIndex;
         OpenRCT2::MemoryStream gameStateSnapshots;
+        uint32_t keyframeInterval; // Ticks between keyframes, 0 if the replay has none.
+        std::vector<ReplayKeyframe> keyframes;
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t ReplayVersion = 10;
+        static constexpr uint16_t ReplayVersion = 11;
+        // Replays from before keyframes were added can still be played
+        static constexpr uint16_t ReplayVersionWithoutKeyframes = 10;
         static constexpr uint32_t ReplayMagic = 0x5243524F; // ORCR.
         static constexpr int ReplayCompressionLevel = 9;
         static constexpr int NormalRecordingChecksumTicks = 1;
@@ -167,6 +181,13 @@ namespace OpenRCT2
                 _nextChecksumTick = gCurrentTicks + ChecksumTicksDelta();
             }
 
+            if (_mode == ReplayMode::RECORDING && _currentRecording->keyframeInterval != 0
+                && gCurrentTicks == _nextKeyframeTick)
+            {
+                AddKeyframe();
+                _nextKeyframeTick = gCurrentTicks + _currentRecording->keyframeInterval;
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (gCurrentTicks >= _currentRecording->tickEnd)
@@ -185,7 +206,7 @@ namespace OpenRCT2
                 ReplayCommands();
 
                 // Normal playback will always end at the specific tick.
-                if (gCurrentTicks >= _currentReplay->tickEnd)
+                if (gCurrentTicks >= _playbackEndTick)
                 {
                     StopPlayback();
                     return;
@@ -219,8 +240,32 @@ namespace OpenRCT2
             snapshots->SerialiseSnapshot(snapshot, snapShotDs);
         }
 
+        void ExportPark(MemoryStream& parkData)
+        {
+            auto context = GetContext();
+            auto& objManager = context->GetObjectManager();
+            auto objects = objManager.GetPackableObjects();
+
+            auto exporter = std::make_unique<ParkFileExporter>();
+            exporter->ExportObjectsList = objects;
+            exporter->Export(parkData);
+        }
+
+        void AddKeyframe()
+        {
+            ReplayKeyframe keyframe;
+            keyframe.tick = gCurrentTicks;
+            ExportPark(keyframe.parkData);
+
+            DataSerialiser parkParamsDs(true, keyframe.parkParams);
+            SerialiseParkParameters(parkParamsDs);
+
+            _currentRecording->keyframes.push_back(std::move(keyframe));
+        }
+
         virtual bool StartRecording(
-            const std::string& name, uint32_t maxTicks /*= k_MaxReplayTicks*/, RecordType rt /*= RecordType::NORMAL*/) override
+            const std::string& name, uint32_t maxTicks /*= k_MaxReplayTicks*/, RecordType rt /*= RecordType::NORMAL*/,
+            uint32_t keyframeInterval /*= 0*/) override
         {
             // If using silent recording, discard whatever recording there is going on, even if a new silent recording is to be
             // started.
@@ -242,14 +287,9 @@ namespace OpenRCT2
                 replayData->tickEnd = k_MaxReplayTicks;
 
             replayData->filePath = name;
+            replayData->keyframeInterval = keyframeInterval;
 
-            auto context = GetContext();
-            auto& objManager = context->GetObjectManager();
-            auto objects = objManager.GetPackableObjects();
-
-            auto exporter = std::make_unique<ParkFileExporter>();
-            exporter->ExportObjectsList = objects;
-            exporter->Export(replayData->parkData);
+            ExportPark(replayData->parkData);
 
             replayData->timeRecorded = std::chrono::seconds(std::time(nullptr)).count();
 
@@ -267,6 +307,7 @@ namespace OpenRCT2
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = gCurrentTicks + 1;
+            _nextKeyframeTick = gCurrentTicks + keyframeInterval;
 
             return true;
         }
@@ -361,20 +402,23 @@ namespace OpenRCT2
             if (data == nullptr)
                 return false;
 
-            info.FilePath = data->filePath;
-            info.Name = data->name;
-            info.Version = data->version;
-            info.TimeRecorded = data->timeRecorded;
+            GetReplayInfo(*data, info);
             if (_mode == ReplayMode::RECORDING)
                 info.Ticks = gCurrentTicks - data->tickStart;
-            else if (_mode == ReplayMode::PLAYING)
-                info.Ticks = data->tickEnd - data->tickStart;
-            info.NumCommands = static_cast<uint32_t>(data->commands.size());
-            info.NumChecksums = static_cast<uint32_t>(data->checksums.size());
 
             return true;
         }
 
+        virtual bool ReadReplayInfo(const std::string& file, ReplayRecordInfo& info) override
+        {
+            ReplayRecordData data{};
+            if (!ReadReplayData(file, data))
+                return false;
+
+            GetReplayInfo(data, info);
+            return true;
+        }
+
         void LoadAndCompareSnapshot(MemoryStream& snapshotStream)
         {
             DataSerialiser ds(false, snapshotStream);
@@ -440,6 +484,7 @@ namespace OpenRCT2
             _currentReplay = std::move(replayData);
             _currentReplay->checksumIndex = 0;
             _faultyChecksumIndex = -1;
+            _playbackEndTick = _currentReplay->tickEnd;
 
             // Make sure game is not paused.
             gGamePaused = 0;
@@ -460,7 +505,11 @@ namespace OpenRCT2
             if (_mode != ReplayMode::PLAYING && _mode != ReplayMode::NORMALISATION)
                 return false;
 
-            LoadAndCompareSnapshot(_currentReplay->gameStateSnapshots);
+            // A segment that ends at a keyframe has no snapshot to compare against
+            if (_playbackEndTick == _currentReplay->tickEnd)
+            {
+                LoadAndCompareSnapshot(_currentReplay->gameStateSnapshots);
+            }
 
             // During normal playback we pause the game if stopped.
             if (_mode == ReplayMode::PLAYING)
@@ -480,6 +529,73 @@ namespace OpenRCT2
             return true;
         }
 
+        virtual bool StartPlaybackSegment(const std::string& file, uint32_t segment) override
+        {
+            if (_mode != ReplayMode::NONE)
+                return false;
+
+            if (!StartPlayback(file))
+                return false;
+
+            auto& keyframes = _currentReplay->keyframes;
+            if (segment > keyframes.size())
+            {
+                LOG_ERROR("Replay only has %u segments.", static_cast<uint32_t>(keyframes.size() + 1));
+                StopPlayback();
+                return false;
+            }
+
+            if (segment > 0 && !RestoreKeyframe(segment - 1))
+            {
+                StopPlayback();
+                return false;
+            }
+
+            if (segment < keyframes.size())
+            {
+                _playbackEndTick = keyframes[segment].tick;
+            }
+            return true;
+        }
+
+        virtual bool SeekPlayback(uint32_t replayTick) override
+        {
+            if (_mode != ReplayMode::PLAYING)
+                return false;
+
+            const auto targetTick = _currentReplay->tickStart + replayTick;
+            if (replayTick > _currentReplay->tickEnd - _currentReplay->tickStart || targetTick > _playbackEndTick)
+                return false;
+
+            // Find the last keyframe at or before the target
+            const auto& keyframes = _currentReplay->keyframes;
+            auto it = std::upper_bound(
+                keyframes.begin(), keyframes.end(), targetTick,
+                [](uint32_t tick, const ReplayKeyframe& keyframe) { return tick < keyframe.tick; });
+
+            // Only restore a park if it saves simulating ticks or if the target has already been passed
+            if (it != keyframes.begin() && std::prev(it)->tick > gCurrentTicks)
+            {
+                if (!RestoreKeyframe(static_cast<size_t>(std::distance(keyframes.begin(), std::prev(it)))))
+                    return false;
+            }
+            else if (targetTick < gCurrentTicks)
+            {
+                bool restored = it != keyframes.begin()
+                    ? RestoreKeyframe(static_cast<size_t>(std::distance(keyframes.begin(), std::prev(it))))
+                    : RestoreStart();
+                if (!restored)
+                    return false;
+            }
+
+            auto* gameState = GetContext()->GetGameState();
+            while (IsReplaying() && gCurrentTicks < targetTick)
+            {
+                gameState->UpdateLogic();
+            }
+            return true;
+        }
+
         virtual bool NormaliseReplay(const std::string& file, const std::string& outFile) override
         {
             _mode = ReplayMode::NORMALISATION;
@@ -489,7 +605,7 @@ namespace OpenRCT2
                 return false;
             }
 
-            if (!StartRecording(outFile, k_MaxReplayTicks, RecordType::NORMAL))
+            if (!StartRecording(outFile, k_MaxReplayTicks, RecordType::NORMAL, 0))
             {
                 StopPlayback();
                 return false;
@@ -514,16 +630,22 @@ namespace OpenRCT2
         }
 
         bool LoadReplayDataMap(ReplayRecordData& data)
+        {
+            return LoadPark(data.parkData, data.parkParams);
+        }
+
+        bool LoadPark(MemoryStream& parkData, MemoryStream& parkParams)
         {
             try
             {
-                data.parkData.SetPosition(0);
+                parkData.SetPosition(0);
+                parkParams.SetPosition(0);
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
                 auto importer = ParkImporter::CreateParkFile(context->GetObjectRepository());
 
-                auto loadResult = importer->LoadFromStream(&data.parkData, false);
+                auto loadResult = importer->LoadFromStream(&parkData, false);
                 objManager.LoadObjects(loadResult.RequiredObjects);
 
                 importer->Import();
@@ -531,7 +653,7 @@ namespace OpenRCT2
                 EntityTweener::Get().Reset();
 
                 // Load all map global variables.
-                DataSerialiser parkParamsDs(false, data.parkParams);
+                DataSerialiser parkParamsDs(false, parkParams);
                 SerialiseParkParameters(parkParamsDs);
 
                 GameLoadInit();
@@ -704,7 +826,7 @@ namespace OpenRCT2
 
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == ReplayVersion;
+            return data.version == ReplayVersion || data.version == ReplayVersionWithoutKeyframes;
         }
 
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
@@ -777,6 +899,96 @@ namespace OpenRCT2
             }
 
             serialiser << data.gameStateSnapshots;
+
+            if (data.version >= ReplayVersion)
+            {
+                serialiser << data.keyframeInterval;
+
+                uint32_t countKeyframes = static_cast<uint32_t>(data.keyframes.size());
+                serialiser << countKeyframes;
+
+                if (serialiser.IsLoading())
+                {
+                    data.keyframes.resize(countKeyframes);
+                }
+
+                for (auto& keyframe : data.keyframes)
+                {
+                    serialiser << keyframe.tick;
+                    serialiser << keyframe.parkData;
+                    serialiser << keyframe.parkParams;
+                }
+            }
+            return true;
+        }
+
+        void GetReplayInfo(const ReplayRecordData& data, ReplayRecordInfo& info) const
+        {
+            info.FilePath = data.filePath;
+            info.Name = data.name;
+            info.Version = data.version;
+            info.TimeRecorded = data.timeRecorded;
+            info.Ticks = data.tickEnd - data.tickStart;
+            info.NumCommands = static_cast<uint32_t>(data.commands.size());
+            info.NumChecksums = static_cast<uint32_t>(data.checksums.size());
+            info.KeyframeTicks.clear();
+            for (const auto& keyframe : data.keyframes)
+            {
+                info.KeyframeTicks.push_back(keyframe.tick - data.tickStart);
+            }
+        }
+
+        // Commands are removed once they have been replayed, so read them again from the file
+        bool ReloadCommands()
+        {
+            ReplayRecordData data{};
+            if (!ReadReplayData(_currentReplay->filePath, data))
+            {
+                LOG_ERROR("Unable to read replay data.");
+                return false;
+            }
+            _currentReplay->commands = std::move(data.commands);
+            return true;
+        }
+
+        void SkipToTick(uint32_t tick)
+        {
+            gCurrentTicks = tick;
+
+            auto& commands = _currentReplay->commands;
+            commands.erase(
+                commands.begin(),
+                std::find_if(commands.begin(), commands.end(), [tick](const ReplayCommand& c) { return c.tick >= tick; }));
+
+            const auto& checksums = _currentReplay->checksums;
+            auto checksumIt = std::find_if(
+                checksums.begin(), checksums.end(), [tick](const auto& checksum) { return checksum.first >= tick; });
+            _currentReplay->checksumIndex = static_cast<uint32_t>(std::distance(checksums.begin(), checksumIt));
+            _faultyChecksumIndex = -1;
+
+            gGamePaused = 0;
+        }
+
+        bool RestoreKeyframe(size_t index)
+        {
+            auto& keyframe = _currentReplay->keyframes[index];
+            if (!ReloadCommands() || !LoadPark(keyframe.parkData, keyframe.parkParams))
+            {
+                LOG_ERROR("Unable to load keyframe at tick %u.", keyframe.tick);
+                return false;
+            }
+            SkipToTick(keyframe.tick);
+            return true;
+        }
+
+        bool RestoreStart()
+        {
+            if (!ReloadCommands() || !LoadReplayDataMap(*_currentReplay))
+            {
+                LOG_ERROR("Unable to load map.");
+                return false;
+            }
+            SkipToTick(_currentReplay->tickStart);
             return true;
         }
 
@@ -870,6 +1082,8 @@ namespace OpenRCT2
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
         uint32_t _nextReplayTick = 0;
+        uint32_t _nextKeyframeTick = 0;
+        uint32_t _playbackEndTick = 0;
         RecordType _recordType = RecordType::NORMAL;
     };
 
@@ -14,6 +14,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 class GameAction;
 
@@ -30,6 +31,8 @@ namespace OpenRCT2
         uint32_t NumChecksums;
         std::string Name;
         std::string FilePath;
+        // Replay ticks of the park snapshots that playback can be resumed from
+        std::vector<uint32_t> KeyframeTicks;
     };
 
     struct IReplayManager
@@ -52,16 +55,26 @@ namespace OpenRCT2
 
         virtual void AddGameAction(uint32_t tick, const GameAction* action) = 0;
 
+        // When keyframeInterval is not zero a full park snapshot is stored every keyframeInterval ticks
         virtual bool StartRecording(
-            const std::string& name, uint32_t maxTicks = k_MaxReplayTicks, RecordType rt = RecordType::NORMAL)
+            const std::string& name, uint32_t maxTicks = k_MaxReplayTicks, RecordType rt = RecordType::NORMAL,
+            uint32_t keyframeInterval = 0)
             = 0;
         virtual bool StopRecording(bool discard = false) = 0;
         virtual bool GetCurrentReplayInfo(ReplayRecordInfo& info) const = 0;
 
         virtual bool StartPlayback(const std::string& file) = 0;
+        // Plays the replay from the start of the given segment to the start of the next one, segment 0 starts at the
+        // beginning of the replay and every keyframe starts a new segment
+        virtual bool StartPlaybackSegment(const std::string& file, uint32_t segment) = 0;
+        // Restores the nearest keyframe before the given replay tick and simulates up to that tick
+        virtual bool SeekPlayback(uint32_t replayTick) = 0;
         virtual bool IsPlaybackStateMismatching() const = 0;
         virtual bool StopPlayback() = 0;
 
+        // Reads the information of a replay file without loading its park
+        virtual bool ReadReplayInfo(const std::string& file, ReplayRecordInfo& info) = 0;
+
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
     };
 
@@ -363,9 +363,10 @@ ParametersRange CheatSetAction::GetParameterRange(CheatType cheatType) const
 
 void CheatSetAction::SetGrassLength(int32_t length) const
 {
-    for (int32_t y = 0; y < gMapSize.y; y++)
+    const auto mapSize = GetMapSize();
+    for (int32_t y = 0; y < mapSize.y; y++)
     {
-        for (int32_t x = 0; x < gMapSize.x; x++)
+        for (int32_t x = 0; x < mapSize.x; x++)
         {
             auto surfaceElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y }.ToCoordsXY());
             if (surfaceElement == nullptr)
@@ -48,21 +48,21 @@ GameActions::Result MapChangeSizeAction::Query() const
 GameActions::Result MapChangeSizeAction::Execute() const
 {
     // Expand map
-    while (_targetSize.x > gMapSize.x)
+    while (_targetSize.x > GetMapSize().x)
     {
-        gMapSize.x++;
+        SetMapSize({ GetMapSize().x + 1, GetMapSize().y });
         MapExtendBoundarySurfaceX();
     }
-    while (_targetSize.y > gMapSize.y)
+    while (_targetSize.y > GetMapSize().y)
     {
-        gMapSize.y++;
+        SetMapSize({ GetMapSize().x, GetMapSize().y + 1 });
         MapExtendBoundarySurfaceY();
     }
 
     // Shrink map
-    if (_targetSize.x < gMapSize.x || _targetSize.y < gMapSize.y)
+    if (_targetSize.x < GetMapSize().x || _targetSize.y < GetMapSize().y)
     {
-        gMapSize = _targetSize;
+        SetMapSize(_targetSize);
         MapRemoveOutOfRangeElements();
     }
 
@@ -0,0 +1,450 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileSystem.hpp"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../entity/Guest.h"
+#include "../management/Finance.h"
+#include "../platform/Platform.h"
+#include "../ride/Ride.h"
+#include "../scenario/Scenario.h"
+#include "../world/Park.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <thread>
+
+using namespace OpenRCT2;
+
+static u8string _outputPath;
+static int32_t _jobs = static_cast<int32_t>(std::max(std::thread::hardware_concurrency(), 1u));
+
+// clang-format off
+// HandleRun passes the data paths on to the process of each park
+static constexpr const CommandLineOptionDefinition ParkOptions[]
+{
+    { CMDLINE_TYPE_STRING, &gCustomUserDataPath,     NAC, "user-data-path",     "path to the user data directory (containing config.ini)" },
+    { CMDLINE_TYPE_STRING, &gCustomOpenRCT2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
+    { CMDLINE_TYPE_STRING, &gCustomRCT1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory" },
+    { CMDLINE_TYPE_STRING, &gCustomRCT2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory" },
+    OptionTableEnd
+};
+
+static constexpr const CommandLineOptionDefinition RunOptions[]
+{
+    { CMDLINE_TYPE_STRING,  &_outputPath,             'o', "output",             "file to write the report to, CSV if it ends in .csv, else JSON" },
+    { CMDLINE_TYPE_INTEGER, &_jobs,                   'j', "jobs",               "number of parks to simulate at the same time, one per process" },
+    { CMDLINE_TYPE_STRING,  &gCustomUserDataPath,     NAC, "user-data-path",     "path to the user data directory (containing config.ini)" },
+    { CMDLINE_TYPE_STRING,  &gCustomOpenRCT2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
+    { CMDLINE_TYPE_STRING,  &gCustomRCT1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory" },
+    { CMDLINE_TYPE_STRING,  &gCustomRCT2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleRun(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandlePark(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BatchSimulateCommands[]
+{
+    // Main commands
+    DefineCommand("run",  "<manifest> [--output <report>] [--jobs <count>]", RunOptions,  HandleRun),
+    DefineCommand("park", "<park> <ticks> <result>",                         ParkOptions, HandlePark),
+    CommandTableEnd
+};
+// clang-format on
+
+struct BatchPark
+{
+    u8string Path;
+    uint32_t Ticks{};
+};
+
+static std::unique_ptr<IContext> CreateBatchContext()
+{
+    Platform::CoreInit();
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return nullptr;
+    }
+    return context;
+}
+
+/**
+ * Reads a manifest such as { "ticks": 100000, "parks": [ "a.park", { "path": "b.sv6", "ticks": 5000 } ] }.
+ * Relative park paths are relative to the manifest, parks without their own tick count use the manifest's.
+ */
+static std::vector<BatchPark> ReadManifest(const u8string& manifestPath)
+{
+    auto manifest = Json::ReadFromFile(manifestPath);
+    auto directory = Path::GetDirectory(manifestPath);
+    auto defaultTicks = Json::GetNumber<uint32_t>(manifest["ticks"]);
+
+    std::vector<BatchPark> parks;
+    for (auto& jPark : Json::AsArray(manifest["parks"]))
+    {
+        BatchPark park;
+        if (jPark.is_string())
+        {
+            park.Path = Json::GetString(jPark);
+            park.Ticks = defaultTicks;
+        }
+        else
+        {
+            park.Path = Json::GetString(jPark["path"]);
+            park.Ticks = Json::GetNumber<uint32_t>(jPark["ticks"], defaultTicks);
+        }
+        if (park.Path.empty())
+        {
+            throw std::runtime_error("Park in manifest has no path.");
+        }
+        park.Path = Path::GetAbsolute(Path::Combine(directory, park.Path));
+        parks.push_back(std::move(park));
+    }
+    return parks;
+}
+
+static json_t RatingToJson(ride_rating rating)
+{
+    if (rating == RIDE_RATING_UNDEFINED)
+    {
+        return nullptr;
+    }
+    return rating / 100.0;
+}
+
+static json_t GetTickTimes(std::vector<double>& tickTimes)
+{
+    json_t result = json_t::object();
+    if (tickTimes.empty())
+    {
+        return result;
+    }
+
+    std::sort(tickTimes.begin(), tickTimes.end());
+    auto percentile = [&tickTimes](size_t p) { return tickTimes[std::min(tickTimes.size() * p / 100, tickTimes.size() - 1)]; };
+
+    double total{};
+    for (auto tickTime : tickTimes)
+    {
+        total += tickTime;
+    }
+    result["total"] = total;
+    result["mean"] = total / tickTimes.size();
+    result["p50"] = percentile(50);
+    result["p90"] = percentile(90);
+    result["p99"] = percentile(99);
+    result["max"] = tickTimes.back();
+    return result;
+}
+
+static const char* GetObjectiveStatus()
+{
+    if (gScenarioCompletedCompanyValue == MONEY64_UNDEFINED)
+        return "inProgress";
+    if (gScenarioCompletedCompanyValue == COMPANY_VALUE_ON_FAILED_OBJECTIVE)
+        return "failed";
+    return "completed";
+}
+
+// Loads the park, runs it for the given number of ticks and returns its metrics, tick times are in microseconds
+static json_t SimulatePark(IContext& context, const BatchPark& park)
+{
+    json_t result = json_t::object();
+    result["path"] = park.Path;
+    result["ticks"] = park.Ticks;
+    if (!context.LoadParkFromFile(park.Path))
+    {
+        result["error"] = "Unable to load park.";
+        return result;
+    }
+
+    auto* gameState = context.GetGameState();
+    std::vector<double> tickTimes;
+    tickTimes.reserve(park.Ticks);
+    for (uint32_t i = 0; i < park.Ticks; i++)
+    {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        gameState->UpdateLogic();
+        std::chrono::duration<double, std::micro> duration = std::chrono::high_resolution_clock::now() - startTime;
+        tickTimes.push_back(duration.count());
+    }
+
+    auto& date = gameState->GetDate();
+    result["date"] = { { "year", date.GetYear() + 1 }, { "month", date.GetMonth() + 1 }, { "day", date.GetDay() + 1 } };
+    result["parkRating"] = gParkRating;
+    result["guests"] = gNumGuestsInPark;
+    result["cash"] = gCash;
+    result["companyValue"] = gCompanyValue;
+    result["objective"] = GetObjectiveStatus();
+
+    json_t rides = json_t::array();
+    for (const auto& ride : GetRideManager())
+    {
+        rides.push_back({
+            { "id", ride.id.ToUnderlying() },
+            { "name", ride.GetName() },
+            { "excitement", RatingToJson(ride.excitement) },
+            { "intensity", RatingToJson(ride.intensity) },
+            { "nausea", RatingToJson(ride.nausea) },
+        });
+    }
+    result["rides"] = std::move(rides);
+    result["tickTime"] = GetTickTimes(tickTimes);
+    return result;
+}
+
+static std::string EscapeCsv(const std::string& value)
+{
+    if (value.find_first_of(",\"\n") == std::string::npos)
+    {
+        return value;
+    }
+
+    std::string result = "\"";
+    for (auto c : value)
+    {
+        if (c == '"')
+        {
+            result += '"';
+        }
+        result += c;
+    }
+    result += "\"";
+    return result;
+}
+
+// One row per park, ride ratings are summarised as the mean of the rated rides
+static std::string GetCsvReport(const json_t& results)
+{
+    static constexpr const char* Columns[] = { "parkRating", "guests", "cash", "companyValue", "objective" };
+    static constexpr const char* RatingColumns[] = { "excitement", "intensity", "nausea" };
+    static constexpr const char* TickTimeColumns[] = { "total", "mean", "p50", "p90", "p99", "max" };
+
+    std::string csv = "path,ticks,error";
+    for (auto column : Columns)
+        csv += String::StdFormat(",%s", column);
+    csv += ",rides,ratedRides";
+    for (auto column : RatingColumns)
+        csv += String::StdFormat(",%sMean", column);
+    for (auto column : TickTimeColumns)
+        csv += String::StdFormat(",tickTime_%s", column);
+    csv += "\n";
+
+    auto toCsv = [](const json_t& value) { return value.is_null() ? std::string() : EscapeCsv(value.dump()); };
+    for (const auto& result : results)
+    {
+        csv += EscapeCsv(Json::GetString(result["path"]));
+        csv += "," + toCsv(result.value("ticks", json_t()));
+        csv += "," + EscapeCsv(result.value("error", std::string()));
+        for (auto column : Columns)
+        {
+            auto value = result.value(column, json_t());
+            csv += "," + (value.is_string() ? EscapeCsv(value.get<std::string>()) : toCsv(value));
+        }
+
+        const auto rides = result.value("rides", json_t::array());
+        size_t numRated = 0;
+        std::array<double, std::size(RatingColumns)> ratingSums{};
+        for (const auto& ride : rides)
+        {
+            if (ride["excitement"].is_null())
+                continue;
+            numRated++;
+            for (size_t i = 0; i < std::size(RatingColumns); i++)
+            {
+                ratingSums[i] += Json::GetNumber<double>(ride[RatingColumns[i]]);
+            }
+        }
+        csv += String::StdFormat(",%zu,%zu", rides.size(), numRated);
+        for (auto sum : ratingSums)
+        {
+            csv += numRated != 0 ? String::StdFormat(",%.2f", sum / numRated) : std::string(",");
+        }
+
+        const auto tickTime = result.value("tickTime", json_t::object());
+        for (auto column : TickTimeColumns)
+        {
+            csv += "," + toCsv(tickTime.value(column, json_t()));
+        }
+        csv += "\n";
+    }
+    return csv;
+}
+
+static json_t RunParksInProcess(const std::vector<BatchPark>& parks)
+{
+    json_t results = json_t::array();
+    auto context = CreateBatchContext();
+    for (const auto& park : parks)
+    {
+        if (context == nullptr)
+        {
+            results.push_back({ { "path", park.Path }, { "ticks", park.Ticks }, { "error", "Unable to create context." } });
+            continue;
+        }
+        Console::WriteLine("Simulating %u ticks of '%s'...", park.Ticks, park.Path.c_str());
+        results.push_back(SimulatePark(*context, park));
+    }
+    return results;
+}
+
+// Every park gets a fresh process so no state is carried over from the previous park and a crash only loses one park
+static json_t RunParksInChildProcesses(const std::vector<BatchPark>& parks)
+{
+    auto resultPrefix = String::StdFormat("openrct2-batchsimulate-%u-", std::random_device{}());
+    std::vector<u8string> resultPaths;
+    std::vector<std::string> commands;
+    for (size_t i = 0; i < parks.size(); i++)
+    {
+        resultPaths.push_back((fs::temp_directory_path() / (resultPrefix + std::to_string(i) + ".json")).u8string());
+        auto ticksArg = std::to_string(parks[i].Ticks);
+        commands.push_back(
+            CommandLine::GetChildProcessCommand({ "batchsimulate", "park", parks[i].Path, ticksArg, resultPaths[i] }));
+    }
+
+    Console::WriteLine("Simulating %zu parks in up to %d processes...", parks.size(), _jobs);
+    auto processResults = CommandLine::RunChildProcesses(commands, _jobs);
+
+    json_t results = json_t::array();
+    for (size_t i = 0; i < parks.size(); i++)
+    {
+        json_t result;
+        try
+        {
+            if (processResults[i].ExitCode == 0)
+            {
+                result = Json::ReadFromFile(resultPaths[i]);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to read result of '%s': %s", parks[i].Path.c_str(), e.what());
+        }
+        File::Delete(resultPaths[i]);
+
+        if (!result.is_object())
+        {
+            result = { { "path", parks[i].Path },
+                       { "ticks", parks[i].Ticks },
+                       { "error", String::StdFormat("Process exited with code %d.", processResults[i].ExitCode) } };
+            Console::Error::WriteLine("%s", processResults[i].Output.c_str());
+        }
+        results.push_back(std::move(result));
+    }
+    return results;
+}
+
+static exitcode_t HandleRun(CommandLineArgEnumerator* argEnumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    const utf8* rawManifestPath;
+    if (!argEnumerator->TryPopString(&rawManifestPath))
+    {
+        Console::Error::WriteLine("Expected a manifest path.");
+        return EXITCODE_FAIL;
+    }
+
+    std::vector<BatchPark> parks;
+    try
+    {
+        parks = ReadManifest(Path::GetAbsolute(rawManifestPath));
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to read manifest: %s", e.what());
+        return EXITCODE_FAIL;
+    }
+
+    // Each process can only run one park at a time, so there is nothing to gain from them with a single job
+    auto results = _jobs <= 1 || parks.size() <= 1 ? RunParksInProcess(parks) : RunParksInChildProcesses(parks);
+
+    size_t numFailed = 0;
+    for (const auto& park : results)
+    {
+        if (park.contains("error"))
+        {
+            Console::Error::WriteLine("%s: %s", Json::GetString(park["path"]).c_str(), Json::GetString(park["error"]).c_str());
+            numFailed++;
+        }
+    }
+
+    if (_outputPath.empty())
+    {
+        Console::WriteLine("%s", results.dump(4).c_str());
+    }
+    else if (String::EndsWith(_outputPath, u8".csv", true))
+    {
+        auto csv = GetCsvReport(results);
+        File::WriteAllBytes(_outputPath, csv.data(), csv.size());
+    }
+    else
+    {
+        Json::WriteToFile(_outputPath, results);
+    }
+
+    if (numFailed != 0)
+    {
+        Console::Error::WriteLine("%zu of %zu parks failed.", numFailed, results.size());
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+static exitcode_t HandlePark(CommandLineArgEnumerator* argEnumerator)
+{
+    const utf8* parkPath;
+    int32_t ticks;
+    const utf8* resultPath;
+    if (!argEnumerator->TryPopString(&parkPath) || !argEnumerator->TryPopInteger(&ticks)
+        || !argEnumerator->TryPopString(&resultPath) || ticks < 0)
+    {
+        Console::Error::WriteLine("Expected <park> <ticks> <result>.");
+        return EXITCODE_FAIL;
+    }
+
+    auto context = CreateBatchContext();
+    if (context == nullptr)
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto result = SimulatePark(*context, { parkPath, static_cast<uint32_t>(ticks) });
+    try
+    {
+        Json::WriteToFile(resultPath, result);
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to write result: %s", e.what());
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
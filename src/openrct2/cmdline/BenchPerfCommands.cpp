@@ -0,0 +1,459 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../Version.h"
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/Json.hpp"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../interface/Viewport.h"
+#include "../paint/Paint.h"
+#include "../park/ParkFile.h"
+#include "../platform/Platform.h"
+#include "../world/Map.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+
+using namespace OpenRCT2;
+
+static u8string _outputPath;
+static u8string _baselinePath;
+static int32_t _ticks = 1000;
+static int32_t _repetitions = 3;
+static float _threshold = 10.0f;
+static float _minTime = 0.01f;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition RunOptions[]
+{
+    { CMDLINE_TYPE_STRING,  &_outputPath,   'o', "output",      "file to write the JSON results to instead of the console"   },
+    { CMDLINE_TYPE_STRING,  &_baselinePath, 'b', "baseline",    "results of an earlier run to check for regressions against" },
+    { CMDLINE_TYPE_INTEGER, &_ticks,        't', "ticks",       "number of ticks to simulate each park for"                  },
+    { CMDLINE_TYPE_INTEGER, &_repetitions,  'r', "repetitions", "number of times to repeat the other benchmarks"             },
+    { CMDLINE_TYPE_REAL,    &_threshold,    NAC, "threshold",   "percentage a metric may be slower than the baseline"        },
+    { CMDLINE_TYPE_REAL,    &_minTime,      NAC, "min-time",    "milliseconds below which a metric is too noisy to compare"  },
+    OptionTableEnd
+};
+
+static constexpr const CommandLineOptionDefinition CompareOptions[]
+{
+    { CMDLINE_TYPE_REAL, &_threshold, NAC, "threshold", "percentage a metric may be slower than the baseline"       },
+    { CMDLINE_TYPE_REAL, &_minTime,   NAC, "min-time",  "milliseconds below which a metric is too noisy to compare" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleRun(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleCompare(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchPerfCommands[]
+{
+    // Main commands
+    DefineCommand("run",     "<path> [<path>...] [--output <results>] [--baseline <results>]", RunOptions,     HandleRun),
+    DefineCommand("compare", "<results> <baseline> [--threshold <percent>]",                   CompareOptions, HandleCompare),
+    CommandTableEnd
+};
+
+static constexpr std::pair<LogicTimePart, const char*> LogicTimePartNames[] =
+{
+    { LogicTimePart::NetworkUpdate,                 "NetworkUpdate"                 },
+    { LogicTimePart::Date,                          "Date"                          },
+    { LogicTimePart::Scenario,                      "Scenario"                      },
+    { LogicTimePart::Climate,                       "Climate"                       },
+    { LogicTimePart::MapTiles,                      "MapTiles"                      },
+    { LogicTimePart::MapStashProvisionalElements,   "MapStashProvisionalElements"   },
+    { LogicTimePart::MapPathWideFlags,              "MapPathWideFlags"              },
+    { LogicTimePart::Peep,                          "Peep"                          },
+    { LogicTimePart::MapRestoreProvisionalElements, "MapRestoreProvisionalElements" },
+    { LogicTimePart::Vehicle,                       "Vehicle"                       },
+    { LogicTimePart::Misc,                          "Misc"                          },
+    { LogicTimePart::Ride,                          "Ride"                          },
+    { LogicTimePart::Park,                          "Park"                          },
+    { LogicTimePart::Research,                      "Research"                      },
+    { LogicTimePart::RideRatings,                   "RideRatings"                   },
+    { LogicTimePart::RideMeasurments,               "RideMeasurments"               },
+    { LogicTimePart::News,                          "News"                          },
+    { LogicTimePart::MapAnimation,                  "MapAnimation"                  },
+    { LogicTimePart::Sounds,                        "Sounds"                        },
+    { LogicTimePart::GameActions,                   "GameActions"                   },
+    { LogicTimePart::NetworkFlush,                  "NetworkFlush"                  },
+    { LogicTimePart::Scripts,                       "Scripts"                       },
+};
+// clang-format on
+
+// Metric names are <file>/<benchmark> or <file>/simulate/<part>, values are milliseconds per operation
+using BenchMetrics = std::map<std::string, double>;
+
+template<typename TFn> static double MeasureMilliseconds(TFn&& fn)
+{
+    auto startTime = std::chrono::high_resolution_clock::now();
+    fn();
+    std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - startTime;
+    return duration.count();
+}
+
+// The median is less affected than the mean by the occasional repetition that gets descheduled
+template<typename TFn> static double MeasureMedianMilliseconds(TFn&& fn)
+{
+    std::vector<double> times;
+    for (int32_t i = 0; i < std::max(_repetitions, 1); i++)
+    {
+        times.push_back(MeasureMilliseconds(fn));
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+struct PaintTimes
+{
+    double Setup{};
+    double Sort{};
+};
+
+// Generates and arranges the paint structs of a view of the whole map the same way the viewport does, without drawing
+static PaintTimes MeasurePaint()
+{
+    auto mapSize = GetMapSize();
+    auto centre = TileCoordsXY(mapSize.x / 2, mapSize.y / 2).ToCoordsXY().ToTileCentre();
+    auto centreScreen = Translate3DTo2DWithZ(0, CoordsXYZ(centre, TileElementHeight(centre)));
+
+    gCurrentRotation = 0;
+    ResetAllSpriteQuadrantPlacements();
+
+    DrawPixelInfo dpi;
+    dpi.width = mapSize.x * COORDS_XY_STEP * 2 + 8;
+    dpi.height = mapSize.y * COORDS_XY_STEP + 128;
+    dpi.x = centreScreen.x - dpi.width / 2;
+    dpi.y = centreScreen.y - dpi.height / 2;
+    dpi.zoom_level = ZoomLevel{ 0 };
+
+    PaintTimes times;
+    const auto rightBorder = dpi.x + dpi.width;
+    for (auto x = dpi.x & ~31; x < rightBorder; x += 32)
+    {
+        PaintSession* session = PaintSessionAlloc(&dpi, 0);
+        auto& columnDpi = session->DPI;
+        columnDpi.x = std::max(columnDpi.x, x);
+        columnDpi.width = std::min(rightBorder, x + 32) - columnDpi.x;
+
+        times.Setup += MeasureMilliseconds([session]() { PaintSessionGenerate(*session); });
+        times.Sort += MeasureMilliseconds([session]() { PaintSessionArrange(*session); });
+        PaintSessionFree(session);
+    }
+    return times;
+}
+
+static void AddStateBenchmarks(BenchMetrics& metrics, const std::string& name)
+{
+    std::vector<PaintTimes> paintTimes;
+    for (int32_t i = 0; i < std::max(_repetitions, 1); i++)
+    {
+        paintTimes.push_back(MeasurePaint());
+    }
+    std::sort(paintTimes.begin(), paintTimes.end(), [](const PaintTimes& a, const PaintTimes& b) {
+        return a.Setup + a.Sort < b.Setup + b.Sort;
+    });
+    metrics[name + "/paintSetup"] = paintTimes[paintTimes.size() / 2].Setup;
+    metrics[name + "/spriteSort"] = paintTimes[paintTimes.size() / 2].Sort;
+
+    metrics[name + "/save"] = MeasureMedianMilliseconds([]() {
+        MemoryStream stream;
+        ParkFileExporter().Export(stream);
+    });
+}
+
+// Runs ticks until the given predicate is false, recording the mean time per tick and of each part of the tick
+template<typename TFn> static void AddSimulateBenchmark(BenchMetrics& metrics, const std::string& name, TFn&& keepRunning)
+{
+    auto* gameState = GetContext()->GetGameState();
+    LogicTimings timings;
+    std::map<std::string, double> partTimes;
+    double totalTime{};
+    uint32_t ticks = 0;
+    for (; keepRunning(ticks); ticks++)
+    {
+        totalTime += MeasureMilliseconds([gameState, &timings]() { gameState->UpdateLogic(&timings); });
+
+        // Each part is recorded as the time since the start of the tick, parts that did not run this tick are skipped
+        auto index = (timings.CurrentIdx + LOGIC_UPDATE_MEASUREMENTS_COUNT - 1) % LOGIC_UPDATE_MEASUREMENTS_COUNT;
+        std::chrono::duration<double, std::milli> previous{};
+        for (const auto& [part, partName] : LogicTimePartNames)
+        {
+            auto it = timings.TimingInfo.find(part);
+            if (it == timings.TimingInfo.end() || it->second[index].count() <= 0)
+                continue;
+
+            std::chrono::duration<double, std::milli> current = it->second[index];
+            partTimes[partName] += (current - previous).count();
+            previous = current;
+            it->second[index] = {};
+        }
+    }
+
+    if (ticks == 0)
+        return;
+
+    metrics[name + "/simulate"] = totalTime / ticks;
+    for (const auto& [partName, time] : partTimes)
+    {
+        metrics[name + "/simulate/" + partName] = time / ticks;
+    }
+}
+
+static bool BenchmarkPark(IContext& context, BenchMetrics& metrics, const u8string& path)
+{
+    auto name = Path::GetFileName(path);
+    bool loaded = true;
+    metrics[name + "/load"] = MeasureMedianMilliseconds([&]() { loaded = loaded && context.LoadParkFromFile(path); });
+    if (!loaded)
+    {
+        return false;
+    }
+
+    AddStateBenchmarks(metrics, name);
+    AddSimulateBenchmark(metrics, name, [](uint32_t tick) { return tick < static_cast<uint32_t>(std::max(_ticks, 0)); });
+    return true;
+}
+
+// Replays are simulated to their end so every recorded action is part of the measurement
+static bool BenchmarkReplay(IContext& context, BenchMetrics& metrics, const u8string& path)
+{
+    auto name = Path::GetFileName(path);
+    auto* replayManager = context.GetReplayManager();
+    bool started = false;
+    metrics[name + "/load"] = MeasureMilliseconds([&]() { started = replayManager->StartPlayback(path); });
+    if (!started)
+    {
+        return false;
+    }
+
+    AddStateBenchmarks(metrics, name);
+    AddSimulateBenchmark(metrics, name, [replayManager](uint32_t) { return replayManager->IsReplaying(); });
+    return true;
+}
+
+static void AddBenchmarkPaths(std::vector<u8string>& paths, const u8string& path)
+{
+    if (!Path::DirectoryExists(path))
+    {
+        // Parts of the corpus are optional, e.g. the replays are only there once they have been downloaded
+        if (File::Exists(path))
+        {
+            paths.push_back(path);
+        }
+        else
+        {
+            Console::Error::WriteLine("Skipping '%s' as it does not exist.", path.c_str());
+        }
+        return;
+    }
+
+    auto scanner = Path::ScanDirectory(Path::Combine(path, u8"*.park;*.sv4;*.sv6;*.sc4;*.sc6;*.sea;*.parkrep"), true);
+    while (scanner->Next())
+    {
+        paths.push_back(scanner->GetPath());
+    }
+}
+
+static double GetThreshold(const json_t& baseline, const std::string& metricName)
+{
+    // Thresholds can be set for a whole benchmark such as "simulate" or for one part such as "simulate/Peep"
+    auto thresholds = baseline.value("thresholds", json_t::object());
+    auto benchmarkName = metricName.substr(std::min(metricName.find('/') + 1, metricName.size()));
+    auto benchmarkKind = benchmarkName.substr(0, benchmarkName.find('/'));
+    for (const auto& key : { benchmarkName, benchmarkKind })
+    {
+        if (thresholds.contains(key) && thresholds[key].is_number())
+        {
+            return thresholds[key].get<double>();
+        }
+    }
+    return _threshold;
+}
+
+// Returns the number of metrics that are slower than the baseline by more than their threshold
+static size_t CompareWithBaseline(const BenchMetrics& metrics, const json_t& baseline)
+{
+    size_t numRegressions = 0;
+    for (const auto& [metricName, jBaselineTime] : Json::AsObject(baseline["metrics"]).items())
+    {
+        auto it = metrics.find(metricName);
+        if (it == metrics.end() || !jBaselineTime.is_number())
+            continue;
+
+        auto baselineTime = jBaselineTime.get<double>();
+        auto time = it->second;
+        if (std::max(baselineTime, time) < _minTime)
+            continue;
+
+        auto change = baselineTime > 0 ? (time - baselineTime) / baselineTime * 100.0 : 100.0;
+        auto threshold = GetThreshold(baseline, metricName);
+        if (change > threshold)
+        {
+            Console::WriteLine(
+                "REGRESSION %s: %.4f ms -> %.4f ms (%+.1f%%, threshold %.1f%%)", metricName.c_str(), baselineTime, time,
+                change, threshold);
+            numRegressions++;
+        }
+        else if (change < -threshold)
+        {
+            Console::WriteLine("Improved %s: %.4f ms -> %.4f ms (%+.1f%%)", metricName.c_str(), baselineTime, time, change);
+        }
+    }
+    return numRegressions;
+}
+
+static exitcode_t ReportRegressions(size_t numRegressions)
+{
+    if (numRegressions != 0)
+    {
+        Console::Error::WriteLine("%zu metrics regressed.", numRegressions);
+        return EXITCODE_FAIL;
+    }
+    Console::WriteLine("No metrics regressed.");
+    return EXITCODE_OK;
+}
+
+static BenchMetrics ReadMetrics(const json_t& results)
+{
+    BenchMetrics metrics;
+    for (const auto& [metricName, time] : Json::AsObject(results["metrics"]).items())
+    {
+        if (time.is_number())
+        {
+            metrics[metricName] = time.get<double>();
+        }
+    }
+    return metrics;
+}
+
+static exitcode_t HandleRun(CommandLineArgEnumerator* argEnumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    std::vector<u8string> paths;
+    const utf8* rawPath;
+    while (argEnumerator->TryPopString(&rawPath))
+    {
+        AddBenchmarkPaths(paths, Path::GetAbsolute(rawPath));
+    }
+    if (paths.empty())
+    {
+        Console::Error::WriteLine("Expected at least one park, replay or directory path.");
+        return EXITCODE_FAIL;
+    }
+
+    json_t baseline;
+    if (!_baselinePath.empty())
+    {
+        try
+        {
+            baseline = Json::ReadFromFile(_baselinePath);
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to read baseline: %s", e.what());
+            return EXITCODE_FAIL;
+        }
+    }
+
+    // Graphics are loaded so the paint benchmarks see the same sprite bounds as the game
+    Platform::CoreInit();
+    gOpenRCT2Headless = true;
+
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    BenchMetrics metrics;
+    size_t numFailed = 0;
+    for (const auto& path : paths)
+    {
+        Console::WriteLine("Benchmarking '%s'...", path.c_str());
+        bool isReplay = String::EndsWith(path, u8".parkrep", true);
+        bool succeeded = isReplay ? BenchmarkReplay(*context, metrics, path) : BenchmarkPark(*context, metrics, path);
+        if (!succeeded)
+        {
+            Console::Error::WriteLine("Unable to load '%s'.", path.c_str());
+            numFailed++;
+        }
+    }
+
+    json_t results = {
+        { "version", std::string(gVersionInfoFull) },
+        { "ticks", _ticks },
+        { "repetitions", _repetitions },
+        { "metrics", metrics },
+    };
+    if (_outputPath.empty())
+    {
+        Console::WriteLine("%s", results.dump(4).c_str());
+    }
+    else
+    {
+        Json::WriteToFile(_outputPath, results);
+    }
+
+    if (numFailed != 0)
+    {
+        Console::Error::WriteLine("%zu of %zu files could not be loaded.", numFailed, paths.size());
+        return EXITCODE_FAIL;
+    }
+    if (baseline.is_object())
+    {
+        return ReportRegressions(CompareWithBaseline(metrics, baseline));
+    }
+    return EXITCODE_OK;
+}
+
+static exitcode_t HandleCompare(CommandLineArgEnumerator* argEnumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    const utf8* resultsPath;
+    const utf8* baselinePath;
+    if (!argEnumerator->TryPopString(&resultsPath) || !argEnumerator->TryPopString(&baselinePath))
+    {
+        Console::Error::WriteLine("Expected <results> <baseline>.");
+        return EXITCODE_FAIL;
+    }
+
+    try
+    {
+        auto metrics = ReadMetrics(Json::ReadFromFile(resultsPath));
+        return ReportRegressions(CompareWithBaseline(metrics, Json::ReadFromFile(baselinePath)));
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to read results: %s", e.what());
+        return EXITCODE_FAIL;
+    }
+}
@@ -87,8 +87,8 @@ static std::vector<RecordedPaintSession> extract_paint_session(std::string_view
         gIntroState = IntroState::None;
         gScreenFlags = SCREEN_FLAGS_PLAYING;
 
-        int32_t resolutionWidth = (gMapSize.x * COORDS_XY_STEP * 2);
-        int32_t resolutionHeight = (gMapSize.y * COORDS_XY_STEP * 1);
+        int32_t resolutionWidth = (GetMapSize().x * COORDS_XY_STEP * 2);
+        int32_t resolutionHeight = (GetMapSize().y * COORDS_XY_STEP * 1);
 
         resolutionWidth += 8;
         resolutionHeight += 128;
@@ -102,7 +102,7 @@ static std::vector<RecordedPaintSession> extract_paint_session(std::string_view
         viewport.var_11 = 0;
         viewport.flags = 0;
 
-        auto customXY = TileCoordsXY(gMapSize.x / 2, gMapSize.y / 2).ToCoordsXY().ToTileCentre();
+        auto customXY = TileCoordsXY(GetMapSize().x / 2, GetMapSize().y / 2).ToCoordsXY().ToTileCentre();
         auto customXYZ = CoordsXYZ(customXY, TileElementHeight(customXY));
         auto screenXY = Translate3DTo2DWithZ(0, customXYZ);
 
@@ -16,10 +16,14 @@
 #    include "../OpenRCT2.h"
 #    include "../core/File.h"
 #    include "../platform/Platform.h"
+#    include "../scripting/HookEngine.h"
+#    include "../scripting/Plugin.h"
+#    include "../scripting/ScriptEngine.h"
 
 #    include <benchmark/benchmark.h>
 #    include <cstdint>
 #    include <iterator>
+#    include <map>
 #    include <numeric>
 #    include <vector>
 
@@ -35,6 +39,11 @@ static void BM_update(benchmark::State& state, const std::string& filename)
             state.SkipWithError("Failed to load file!");
         }
 
+#    ifdef ENABLE_SCRIPTING
+        auto& hookEngine = context->GetScriptEngine().GetHookEngine();
+        hookEngine.ResetStatistics();
+#    endif
+
         std::vector<LogicTimings> timings(1);
         timings.reserve(100);
         int currentTimingIdx = 0;
@@ -80,6 +89,46 @@ static void BM_update(benchmark::State& state, const std::string& filename)
         state.counters["GameActionsAcc_ms"] = accumulator(LogicTimePart::GameActions);
         state.counters["NetworkFlushAcc_ms"] = accumulator(LogicTimePart::NetworkFlush);
         state.counters["ScriptsAcc_ms"] = accumulator(LogicTimePart::Scripts);
+
+#    ifdef ENABLE_SCRIPTING
+        // Time spent in the hooks of each plugin, for benchmarking plugins against a park
+        std::map<std::string, double> pluginTimes;
+        for (const auto& hookList : hookEngine.GetHookLists())
+        {
+            for (const auto& hook : hookList.Hooks)
+            {
+                pluginTimes[hook.Owner->GetMetadata().Name] += hook.Statistics.TotalTime;
+            }
+        }
+        for (const auto& [name, time] : pluginTimes)
+        {
+            state.counters["Plugin:" + name + "_ms"] = time;
+        }
+#    endif
+    }
+    else
+    {
+        state.SkipWithError("Context initialization failed.");
+    }
+}
+
+// Same as BM_update without any of the presentation work, which is what scenario testing and other headless tools run
+static void BM_simulate(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (context->Initialise())
+    {
+        if (!filename.empty() && !context->LoadParkFromFile(filename))
+        {
+            state.SkipWithError("Failed to load file!");
+        }
+
+        auto* gameState = context->GetGameState();
+        for (auto _ : state)
+        {
+            gameState->Simulate(1);
+        }
+        state.SetItemsProcessed(state.iterations());
     }
     else
     {
@@ -106,6 +155,7 @@ static int CmdlineForBenchSpriteSort(int argc, const char* const* argv)
         {
             // Register benchmark for sv6 if valid
             benchmark::RegisterBenchmark(argv[i], BM_update, argv[i]);
+            benchmark::RegisterBenchmark((std::string(argv[i]) + " (simulation only)").c_str(), BM_simulate, argv[i]);
         }
         else
         {
@@ -0,0 +1,103 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../OpenRCT2.h"
+#include "../core/Path.hpp"
+#include "../platform/Platform.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+
+static std::string QuoteArgument(std::string_view argument)
+{
+#ifdef _WIN32
+    return "\"" + std::string(argument) + "\"";
+#else
+    // Single quotes prevent any expansion by the shell, a single quote itself has to be closed, escaped and reopened
+    std::string result = "'";
+    for (auto c : argument)
+    {
+        if (c == '\'')
+        {
+            result += "'\\''";
+        }
+        else
+        {
+            result += c;
+        }
+    }
+    result += "'";
+    return result;
+#endif
+}
+
+std::string CommandLine::GetChildProcessCommand(const std::vector<std::string_view>& arguments)
+{
+    auto command = QuoteArgument(Platform::GetCurrentExecutablePath());
+    for (auto argument : arguments)
+    {
+        command += " ";
+        command += QuoteArgument(argument);
+    }
+
+    // The child has to use the same data as this process, options have to be at the end of the command line
+    const std::pair<const char*, const u8string&> dataPaths[] = {
+        { "--user-data-path", gCustomUserDataPath },
+        { "--openrct2-data-path", gCustomOpenRCT2DataPath },
+        { "--rct1-data-path", gCustomRCT1DataPath },
+        { "--rct2-data-path", gCustomRCT2DataPath },
+    };
+    for (const auto& [option, path] : dataPaths)
+    {
+        if (!path.empty())
+        {
+            command += " ";
+            command += option;
+            command += " ";
+            command += QuoteArgument(Path::GetAbsolute(path));
+        }
+    }
+    return command;
+}
+
+std::vector<CommandLine::ChildProcessResult> CommandLine::RunChildProcesses(
+    const std::vector<std::string>& commands, int32_t maxProcesses)
+{
+    std::vector<ChildProcessResult> results(commands.size());
+    if (commands.empty())
+    {
+        return results;
+    }
+
+    std::atomic<size_t> nextCommand{};
+
+    // Each thread waits on one child process at a time, so the number of threads limits the number of processes
+    auto runCommands = [&]() {
+        for (auto i = nextCommand++; i < commands.size(); i = nextCommand++)
+        {
+            // The output is always read, a child writing more than the pipe can hold would otherwise never exit
+            results[i].ExitCode = Platform::Execute(commands[i], &results[i].Output);
+        }
+    };
+
+    auto numThreads = std::min(static_cast<size_t>(std::max(maxProcesses, 1)), commands.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++)
+    {
+        threads.emplace_back(runCommands);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    return results;
+}
@@ -11,6 +11,10 @@
 
 #include "../common.h"
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 /**
  * Class for enumerating and retrieving values for a set of command line arguments.
  */
@@ -119,8 +123,12 @@ namespace CommandLine
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
     extern const CommandLineCommand BenchUpdateCommands[];
+    extern const CommandLineCommand BenchPerfCommands[];
     extern const CommandLineCommand SimulateCommands[];
+    extern const CommandLineCommand BatchSimulateCommands[];
     extern const CommandLineCommand ParkInfoCommands[];
+    extern const CommandLineCommand TrackDesignCommands[];
+    extern const CommandLineCommand ReplayCommands[];
 
     extern const CommandLineExample RootExamples[];
 
@@ -129,4 +137,22 @@ namespace CommandLine
 
     exitcode_t HandleCommandConvert(CommandLineArgEnumerator* enumerator);
     exitcode_t HandleCommandUri(CommandLineArgEnumerator* enumerator);
+
+    struct ChildProcessResult
+    {
+        int32_t ExitCode{};
+        std::string Output;
+    };
+
+    /**
+     * Returns a command line that runs this executable with the given arguments. The data paths of this process are
+     * appended as options, so the command has to accept --user-data-path and the other data path options.
+     */
+    std::string GetChildProcessCommand(const std::vector<std::string_view>& arguments);
+
+    /**
+     * Runs each command in its own process, with at most maxProcesses running at the same time. The results are in
+     * the same order as the commands.
+     */
+    std::vector<ChildProcessResult> RunChildProcesses(const std::vector<std::string>& commands, int32_t maxProcesses);
 } // namespace CommandLine
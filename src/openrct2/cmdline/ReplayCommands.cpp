@@ -0,0 +1,234 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../core/Path.hpp"
+#include "../object/ObjectManager.h"
+#include "../park/ParkFile.h"
+#include "../platform/Platform.h"
+#include "CommandLine.hpp"
+
+#include <memory>
+#include <string>
+
+using namespace OpenRCT2;
+
+static int32_t _jobs = 1;
+
+// clang-format off
+// HandleReplayVerify passes the data paths on to the process of each segment
+static constexpr const CommandLineOptionDefinition ReplayOptions[]
+{
+    { CMDLINE_TYPE_STRING, &gCustomUserDataPath,     NAC, "user-data-path",     "path to the user data directory (containing config.ini)" },
+    { CMDLINE_TYPE_STRING, &gCustomOpenRCT2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
+    { CMDLINE_TYPE_STRING, &gCustomRCT1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory" },
+    { CMDLINE_TYPE_STRING, &gCustomRCT2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory" },
+    OptionTableEnd
+};
+
+static constexpr const CommandLineOptionDefinition VerifyOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_jobs,                   'j', "jobs",               "number of segments to verify at the same time, each in its own process" },
+    { CMDLINE_TYPE_STRING,  &gCustomUserDataPath,     NAC, "user-data-path",     "path to the user data directory (containing config.ini)" },
+    { CMDLINE_TYPE_STRING,  &gCustomOpenRCT2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
+    { CMDLINE_TYPE_STRING,  &gCustomRCT1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory" },
+    { CMDLINE_TYPE_STRING,  &gCustomRCT2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleReplaySeek(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleReplayVerify(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleReplayVerifySegment(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::ReplayCommands[]{
+    // Main commands
+    DefineCommand("seek",           "<replay> <tick> <output park>", ReplayOptions, HandleReplaySeek),
+    DefineCommand("verify",         "<replay> [--jobs <count>]",     VerifyOptions, HandleReplayVerify),
+    DefineCommand("verify-segment", "<replay> <segment>",            ReplayOptions, HandleReplayVerifySegment),
+
+    CommandTableEnd
+};
+// clang-format on
+
+static std::unique_ptr<IContext> CreateReplayContext()
+{
+    Platform::CoreInit();
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return nullptr;
+    }
+    return context;
+}
+
+// Plays the current replay until it ends or its state no longer matches the recording
+static bool RunReplay(IContext& context)
+{
+    auto* gameState = context.GetGameState();
+    auto* replayManager = context.GetReplayManager();
+    while (replayManager->IsReplaying())
+    {
+        gameState->UpdateLogic();
+        if (replayManager->IsPlaybackStateMismatching())
+        {
+            replayManager->StopPlayback();
+            return false;
+        }
+    }
+    return true;
+}
+
+static exitcode_t HandleReplaySeek(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* replayPath;
+    int32_t tick;
+    const char* outputPath;
+    if (!argEnumerator->TryPopString(&replayPath) || !argEnumerator->TryPopInteger(&tick)
+        || !argEnumerator->TryPopString(&outputPath) || tick < 0)
+    {
+        Console::Error::WriteLine("Expected <replay> <tick> <output park>.");
+        return EXITCODE_FAIL;
+    }
+
+    auto context = CreateReplayContext();
+    if (context == nullptr)
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto* replayManager = context->GetReplayManager();
+    if (!replayManager->StartPlayback(replayPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    if (!replayManager->SeekPlayback(static_cast<uint32_t>(tick)))
+    {
+        Console::Error::WriteLine("Unable to seek to tick %d.", tick);
+        return EXITCODE_FAIL;
+    }
+
+    // Saved the same way as the replay's keyframes, with all objects included so the park can be opened anywhere
+    auto outputFullPath = Path::GetAbsolute(outputPath);
+    try
+    {
+        ParkFileExporter exporter;
+        exporter.ExportObjectsList = context->GetObjectManager().GetPackableObjects();
+        exporter.Export(outputFullPath);
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to save park to '%s': %s", outputFullPath.c_str(), e.what());
+        return EXITCODE_FAIL;
+    }
+    Console::WriteLine("Saved park at replay tick %d to '%s'.", tick, outputFullPath.c_str());
+    return EXITCODE_OK;
+}
+
+static exitcode_t HandleReplayVerify(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* replayPath;
+    if (!argEnumerator->TryPopString(&replayPath))
+    {
+        Console::Error::WriteLine("Expected <replay>.");
+        return EXITCODE_FAIL;
+    }
+    auto replayFullPath = Path::GetAbsolute(replayPath);
+
+    auto context = CreateReplayContext();
+    if (context == nullptr)
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto* replayManager = context->GetReplayManager();
+    ReplayRecordInfo info;
+    if (!replayManager->ReadReplayInfo(replayFullPath, info))
+    {
+        Console::Error::WriteLine("Unable to read replay '%s'.", replayFullPath.c_str());
+        return EXITCODE_FAIL;
+    }
+
+    const auto numSegments = static_cast<uint32_t>(info.KeyframeTicks.size() + 1);
+    Console::WriteLine("Verifying %u ticks in %u segments...", info.Ticks, numSegments);
+
+    uint32_t numFailed = 0;
+    if (_jobs <= 1 || numSegments == 1)
+    {
+        for (uint32_t segment = 0; segment < numSegments; segment++)
+        {
+            bool matches = replayManager->StartPlaybackSegment(replayFullPath, segment) && RunReplay(*context);
+            Console::WriteLine("Segment %u: %s", segment, matches ? "OK" : "FAILED");
+            numFailed += matches ? 0 : 1;
+        }
+    }
+    else
+    {
+        // Every segment starts from a keyframe, so they can be verified in separate processes
+        std::vector<std::string> commands;
+        for (uint32_t segment = 0; segment < numSegments; segment++)
+        {
+            auto segmentArg = std::to_string(segment);
+            commands.push_back(CommandLine::GetChildProcessCommand({ "replay", "verify-segment", replayFullPath, segmentArg }));
+        }
+
+        auto results = CommandLine::RunChildProcesses(commands, _jobs);
+        for (uint32_t segment = 0; segment < numSegments; segment++)
+        {
+            bool matches = results[segment].ExitCode == 0;
+            Console::WriteLine("Segment %u: %s", segment, matches ? "OK" : "FAILED");
+            if (!matches)
+            {
+                Console::WriteLine("%s", results[segment].Output.c_str());
+                numFailed++;
+            }
+        }
+    }
+
+    if (numFailed != 0)
+    {
+        Console::Error::WriteLine("%u of %u segments failed.", numFailed, numSegments);
+        return EXITCODE_FAIL;
+    }
+    Console::WriteLine("Replay verified.");
+    return EXITCODE_OK;
+}
+
+static exitcode_t HandleReplayVerifySegment(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* replayPath;
+    int32_t segment;
+    if (!argEnumerator->TryPopString(&replayPath) || !argEnumerator->TryPopInteger(&segment) || segment < 0)
+    {
+        Console::Error::WriteLine("Expected <replay> <segment>.");
+        return EXITCODE_FAIL;
+    }
+
+    auto context = CreateReplayContext();
+    if (context == nullptr)
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto* replayManager = context->GetReplayManager();
+    if (!replayManager->StartPlaybackSegment(replayPath, static_cast<uint32_t>(segment)))
+    {
+        return EXITCODE_FAIL;
+    }
+    return RunReplay(*context) ? EXITCODE_OK : EXITCODE_FAIL;
+}
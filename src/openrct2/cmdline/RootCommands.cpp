@@ -143,8 +143,12 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
     DefineSubCommand("benchsimulate",   CommandLine::BenchUpdateCommands      ),
+    DefineSubCommand("benchperf",       CommandLine::BenchPerfCommands        ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("batchsimulate",   CommandLine::BatchSimulateCommands    ),
     DefineSubCommand("parkinfo",        CommandLine::ParkInfoCommands         ),
+    DefineSubCommand("trackdesign",     CommandLine::TrackDesignCommands      ),
+    DefineSubCommand("replay",          CommandLine::ReplayCommands           ),
     CommandTableEnd
 };
 
@@ -10,24 +10,130 @@
 #include "../Context.h"
 #include "../Game.h"
 #include "../GameState.h"
+#include "../GameStateSnapshots.h"
 #include "../OpenRCT2.h"
 #include "../core/Console.hpp"
 #include "../entity/EntityRegistry.h"
+#include "../entity/Guest.h"
+#include "../management/Finance.h"
 #include "../network/network.h"
 #include "../platform/Platform.h"
+#include "../profiling/Tracing.h"
+#include "../scenario/Scenario.h"
+#include "../world/Park.h"
 #include "CommandLine.hpp"
 
+#include <chrono>
+#include <cinttypes>
 #include <cstdlib>
 #include <memory>
 
 using namespace OpenRCT2;
 
+static bool _simulationOnly = false;
+static bool _verify = false;
+static u8string _tracePath;
+static float _traceSlowTicks = 0;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition SimulateOptions[]
+{
+    { CMDLINE_TYPE_SWITCH, &_simulationOnly, 's', "simulation-only",  "skip sounds, windows and networking for faster ticks"  },
+    { CMDLINE_TYPE_SWITCH, &_verify,         'v', "verify",           "check the simulation-only result matches a normal run" },
+    { CMDLINE_TYPE_STRING, &_tracePath,      NAC, "trace",            "file to write a Chrome or Perfetto trace to"           },
+    { CMDLINE_TYPE_REAL,   &_traceSlowTicks, NAC, "trace-slow-ticks", "only trace ticks that take at least this many ms"      },
+    OptionTableEnd
+};
+
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator);
 
-const CommandLineCommand CommandLine::SimulateCommands[]{ // Main commands
-                                                          DefineCommand("", "<ticks>", nullptr, HandleSimulate), CommandTableEnd
+const CommandLineCommand CommandLine::SimulateCommands[]{
+    // Main commands
+    DefineCommand("", "<ticks> [--simulation-only] [--verify] [--trace <file>]", SimulateOptions, HandleSimulate),
+    CommandTableEnd
+};
+// clang-format on
+
+// The park wide values that are not part of the entities compared by the game state snapshots
+struct ParkResult
+{
+    uint32_t Ticks;
+    money64 Cash;
+    money64 CompanyValue;
+    uint16_t ParkRating;
+    uint32_t NumGuestsInPark;
 };
 
+static ParkResult GetParkResult()
+{
+    return { gCurrentTicks, gCash, gCompanyValue, gParkRating, gNumGuestsInPark };
+}
+
+static void RunTicks(IContext& context, uint32_t ticks, bool simulationOnly)
+{
+    auto* gameState = context.GetGameState();
+    auto startTime = std::chrono::high_resolution_clock::now();
+    if (simulationOnly)
+    {
+        gameState->Simulate(ticks);
+    }
+    else
+    {
+        for (uint32_t i = 0; i < ticks; i++)
+        {
+            gameState->UpdateLogic();
+        }
+    }
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - startTime;
+    Console::WriteLine(
+        "Ran %u ticks in %.3f seconds (%.0f ticks per second).", ticks, duration.count(),
+        duration.count() > 0 ? ticks / duration.count() : 0.0);
+}
+
+// Runs the park once through the normal path and once through the simulation-only path and compares the results
+static exitcode_t VerifySimulation(IContext& context, const char* inputPath, uint32_t ticks)
+{
+    auto* snapshots = context.GetGameStateSnapshots();
+    snapshots->Reset();
+
+    Console::WriteLine("Running %u ticks...", ticks);
+    RunTicks(context, ticks, false);
+    auto& expectedSnapshot = snapshots->CreateSnapshot();
+    snapshots->Capture(expectedSnapshot);
+    snapshots->LinkSnapshot(expectedSnapshot, gCurrentTicks, ScenarioRandState().s0);
+    auto expected = GetParkResult();
+
+    if (!context.LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("Running %u ticks in simulation-only mode...", ticks);
+    RunTicks(context, ticks, true);
+    auto& actualSnapshot = snapshots->CreateSnapshot();
+    snapshots->Capture(actualSnapshot);
+    snapshots->LinkSnapshot(actualSnapshot, gCurrentTicks, ScenarioRandState().s0);
+    auto actual = GetParkResult();
+
+    auto cmpData = snapshots->Compare(expectedSnapshot, actualSnapshot);
+    bool matches = cmpData.spriteChanges.empty() && cmpData.tickLeft == cmpData.tickRight
+        && cmpData.srand0Left == cmpData.srand0Right && expected.Ticks == actual.Ticks && expected.Cash == actual.Cash
+        && expected.CompanyValue == actual.CompanyValue && expected.ParkRating == actual.ParkRating
+        && expected.NumGuestsInPark == actual.NumGuestsInPark;
+    if (!matches)
+    {
+        Console::Error::WriteLine("Simulation-only result does not match the normal result.");
+        Console::Error::WriteLine(
+            "Cash %" PRId64 " / %" PRId64 ", company value %" PRId64 " / %" PRId64 ", park rating %u / %u, guests %u / %u",
+            expected.Cash, actual.Cash, expected.CompanyValue, actual.CompanyValue, expected.ParkRating, actual.ParkRating,
+            expected.NumGuestsInPark, actual.NumGuestsInPark);
+        Console::Error::WriteLine("%s", snapshots->GetCompareDataText(cmpData).c_str());
+        return EXITCODE_FAIL;
+    }
+    Console::WriteLine("Simulation-only result matches: %s", GetAllEntitiesChecksum().ToString().c_str());
+    return EXITCODE_OK;
+}
+
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 {
     const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
@@ -47,7 +153,11 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
     gOpenRCT2Headless = true;
 
 #ifndef DISABLE_NETWORK
-    gNetworkStart = NETWORK_MODE_SERVER;
+    // A server has to poll the network every tick, the simulation-only path only applies to single player games
+    if (!_simulationOnly && !_verify)
+    {
+        gNetworkStart = NETWORK_MODE_SERVER;
+    }
 #endif
 
     std::unique_ptr<IContext> context(CreateContext());
@@ -58,12 +168,30 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
             return EXITCODE_FAIL;
         }
 
-        Console::WriteLine("Running %d ticks...", ticks);
-        for (uint32_t i = 0; i < ticks; i++)
+        if (_verify)
+        {
+            return VerifySimulation(*context, inputPath, ticks);
+        }
+
+        if (!_tracePath.empty())
         {
-            context->GetGameState()->UpdateLogic();
+            Profiling::Tracing::Start(_traceSlowTicks);
         }
+
+        Console::WriteLine("Running %d ticks...", ticks);
+        RunTicks(*context, ticks, _simulationOnly);
         Console::WriteLine("Completed: %s", GetAllEntitiesChecksum().ToString().c_str());
+
+        if (!_tracePath.empty())
+        {
+            Profiling::Tracing::Stop();
+            if (!Profiling::Tracing::Export(_tracePath))
+            {
+                Console::Error::WriteLine("Unable to write trace to '%s'.", _tracePath.c_str());
+                return EXITCODE_FAIL;
+            }
+            Console::WriteLine("Wrote trace to '%s'.", _tracePath.c_str());
+        }
     }
     else
     {
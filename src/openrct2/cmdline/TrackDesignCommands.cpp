@@ -0,0 +1,248 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/FileSystem.hpp"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../object/DefaultObjects.h"
+#include "../object/ObjectManager.h"
+#include "../platform/Platform.h"
+#include "../ride/TrackDesignEvaluator.h"
+#include "../world/Map.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <thread>
+
+using namespace OpenRCT2;
+
+static u8string _outputPath;
+static int32_t _maxTicks = TrackDesignEvaluateDefaultMaxTicks;
+static int32_t _jobs = static_cast<int32_t>(std::max(std::thread::hardware_concurrency(), 1u));
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition RateOptions[]
+{
+    { CMDLINE_TYPE_STRING,  &_outputPath,             'o', "output",             "file to write the JSON results to instead of the console" },
+    { CMDLINE_TYPE_INTEGER, &_maxTicks,               NAC, "max-ticks",          "number of ticks after which a test run is abandoned" },
+    { CMDLINE_TYPE_INTEGER, &_jobs,                   'j', "jobs",               "number of designs to rate at the same time, one per process" },
+    { CMDLINE_TYPE_STRING,  &gCustomUserDataPath,     NAC, "user-data-path",     "path to the user data directory (containing config.ini)" },
+    { CMDLINE_TYPE_STRING,  &gCustomOpenRCT2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
+    { CMDLINE_TYPE_STRING,  &gCustomRCT1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory" },
+    { CMDLINE_TYPE_STRING,  &gCustomRCT2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory" },
+    OptionTableEnd
+};
+
+// HandleRate passes the data paths on to the process of each design
+static constexpr const CommandLineOptionDefinition DesignOptions[]
+{
+    { CMDLINE_TYPE_STRING, &gCustomUserDataPath,     NAC, "user-data-path",     "path to the user data directory (containing config.ini)" },
+    { CMDLINE_TYPE_STRING, &gCustomOpenRCT2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
+    { CMDLINE_TYPE_STRING, &gCustomRCT1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory" },
+    { CMDLINE_TYPE_STRING, &gCustomRCT2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory" },
+    OptionTableEnd
+};
+
+static exitcode_t HandleRate(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleDesign(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::TrackDesignCommands[]
+{
+    // Main commands
+    DefineCommand("rate",   "<path> [<path>...] [--jobs <count>]", RateOptions,   HandleRate),
+    DefineCommand("design", "<path> <max-ticks> <result>",         DesignOptions, HandleDesign),
+    CommandTableEnd
+};
+// clang-format on
+
+static void AddTrackDesignPaths(std::vector<u8string>& paths, const u8string& path)
+{
+    if (!Path::DirectoryExists(path))
+    {
+        paths.push_back(path);
+        return;
+    }
+
+    auto scanner = Path::ScanDirectory(Path::Combine(path, u8"*.td4;*.td6"), true);
+    while (scanner->Next())
+    {
+        paths.push_back(scanner->GetPath());
+    }
+}
+
+// Designs are rated on scratch worlds, the park of the process only provides the objects every design needs
+static std::unique_ptr<IContext> CreateEvaluationContext()
+{
+    Platform::CoreInit();
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return nullptr;
+    }
+
+    auto& objectManager = context->GetObjectManager();
+    for (const auto& entry : MinimumRequiredObjects)
+    {
+        objectManager.LoadObject(entry);
+    }
+    for (const auto& entry : DesignerSelectedObjects)
+    {
+        objectManager.LoadObject(entry);
+    }
+    context->GetGameState()->InitAll(DEFAULT_MAP_SIZE);
+    return context;
+}
+
+static json_t RateDesignsInProcess(const std::vector<u8string>& paths, uint32_t maxTicks)
+{
+    json_t results = json_t::array();
+    auto context = CreateEvaluationContext();
+    for (const auto& path : paths)
+    {
+        if (context == nullptr)
+        {
+            results.push_back({ { "path", path }, { "error", "Unable to create context." } });
+            continue;
+        }
+        results.push_back(TrackDesignEvaluationToJson(TrackDesignEvaluate(path, maxTicks)));
+    }
+    return results;
+}
+
+// Every design is rated in its own process, so designs are rated in parallel and a crash only loses one design
+static json_t RateDesignsInChildProcesses(const std::vector<u8string>& paths, uint32_t maxTicks)
+{
+    auto resultPrefix = String::StdFormat("openrct2-trackdesign-%u-", std::random_device{}());
+    auto maxTicksArg = std::to_string(maxTicks);
+    std::vector<u8string> resultPaths;
+    std::vector<std::string> commands;
+    for (size_t i = 0; i < paths.size(); i++)
+    {
+        resultPaths.push_back((fs::temp_directory_path() / (resultPrefix + std::to_string(i) + ".json")).u8string());
+        commands.push_back(
+            CommandLine::GetChildProcessCommand({ "trackdesign", "design", paths[i], maxTicksArg, resultPaths[i] }));
+    }
+
+    auto processResults = CommandLine::RunChildProcesses(commands, _jobs);
+
+    json_t results = json_t::array();
+    for (size_t i = 0; i < paths.size(); i++)
+    {
+        json_t result;
+        try
+        {
+            if (processResults[i].ExitCode == 0)
+            {
+                result = Json::ReadFromFile(resultPaths[i]);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to read result of '%s': %s", paths[i].c_str(), e.what());
+        }
+        File::Delete(resultPaths[i]);
+
+        if (!result.is_object())
+        {
+            result = { { "path", paths[i] },
+                       { "error", String::StdFormat("Process exited with code %d.", processResults[i].ExitCode) } };
+            Console::Error::WriteLine("%s", processResults[i].Output.c_str());
+        }
+        results.push_back(std::move(result));
+    }
+    return results;
+}
+
+static exitcode_t HandleRate(CommandLineArgEnumerator* argEnumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    std::vector<u8string> paths;
+    const utf8* rawPath;
+    while (argEnumerator->TryPopString(&rawPath))
+    {
+        AddTrackDesignPaths(paths, Path::GetAbsolute(rawPath));
+    }
+    if (paths.empty())
+    {
+        Console::Error::WriteLine("Expected at least one track design path.");
+        return EXITCODE_FAIL;
+    }
+
+    // Each process can only rate one design at a time, so there is nothing to gain from them with a single job
+    const auto maxTicks = static_cast<uint32_t>(std::max(_maxTicks, 1));
+    auto results = _jobs <= 1 || paths.size() <= 1 ? RateDesignsInProcess(paths, maxTicks)
+                                                   : RateDesignsInChildProcesses(paths, maxTicks);
+    for (const auto& design : results)
+    {
+        if (design.contains("error"))
+        {
+            Console::Error::WriteLine(
+                "%s: %s", Json::GetString(design["path"]).c_str(), Json::GetString(design["error"]).c_str());
+        }
+    }
+
+    if (_outputPath.empty())
+    {
+        Console::WriteLine("%s", results.dump(4).c_str());
+    }
+    else
+    {
+        Json::WriteToFile(_outputPath, results);
+    }
+    return EXITCODE_OK;
+}
+
+static exitcode_t HandleDesign(CommandLineArgEnumerator* argEnumerator)
+{
+    const utf8* path;
+    int32_t maxTicks;
+    const utf8* resultPath;
+    if (!argEnumerator->TryPopString(&path) || !argEnumerator->TryPopInteger(&maxTicks)
+        || !argEnumerator->TryPopString(&resultPath) || maxTicks < 1)
+    {
+        Console::Error::WriteLine("Expected <path> <max-ticks> <result>.");
+        return EXITCODE_FAIL;
+    }
+
+    auto context = CreateEvaluationContext();
+    if (context == nullptr)
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto result = TrackDesignEvaluationToJson(TrackDesignEvaluate(path, static_cast<uint32_t>(maxTicks)));
+    try
+    {
+        Json::WriteToFile(resultPath, result);
+    }
+    catch (const std::exception& e)
+    {
+        Console::Error::WriteLine("Unable to write result: %s", e.what());
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
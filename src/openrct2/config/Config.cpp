@@ -105,6 +105,12 @@ namespace Config
         ConfigEnumEntry<VirtualFloorStyles>("GLASSY", VirtualFloorStyles::Glassy),
     });
 
+    static const auto Enum_PluginHookBudgetAction = ConfigEnum<PluginHookBudgetAction>({
+        ConfigEnumEntry<PluginHookBudgetAction>("LOG", PluginHookBudgetAction::Log),
+        ConfigEnumEntry<PluginHookBudgetAction>("WARN", PluginHookBudgetAction::Warn),
+        ConfigEnumEntry<PluginHookBudgetAction>("DISABLE", PluginHookBudgetAction::Disable),
+    });
+
     /**
      * Config enum wrapping LanguagesDescriptors.
      */
@@ -196,6 +202,9 @@ namespace Config
             model->WindowScale = reader->GetFloat("window_scale", Platform::GetDefaultScale());
             model->ShowFPS = reader->GetBoolean("show_fps", false);
             model->MultiThreading = reader->GetBoolean("multi_threading", false);
+            model->ThreadCount = reader->GetInt32("thread_count", 0);
+            model->ParallelSimulation = reader->GetBoolean("parallel_simulation", false);
+            model->ObjectImageMemoryBudget = reader->GetInt32("object_image_memory_budget", 256);
             model->TrapCursor = reader->GetBoolean("trap_cursor", false);
             model->AutoOpenShops = reader->GetBoolean("auto_open_shops", false);
             model->ScenarioSelectMode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -281,6 +290,9 @@ namespace Config
         writer->WriteFloat("window_scale", model->WindowScale);
         writer->WriteBoolean("show_fps", model->ShowFPS);
         writer->WriteBoolean("multi_threading", model->MultiThreading);
+        writer->WriteInt32("thread_count", model->ThreadCount);
+        writer->WriteBoolean("parallel_simulation", model->ParallelSimulation);
+        writer->WriteInt32("object_image_memory_budget", model->ObjectImageMemoryBudget);
         writer->WriteBoolean("trap_cursor", model->TrapCursor);
         writer->WriteBoolean("auto_open_shops", model->AutoOpenShops);
         writer->WriteInt32("scenario_select_mode", model->ScenarioSelectMode);
@@ -555,6 +567,9 @@ namespace Config
             auto model = &gConfigPlugin;
             model->EnableHotReloading = reader->GetBoolean("enable_hot_reloading", false);
             model->AllowedHosts = reader->GetString("allowed_hosts", "");
+            model->HookTimeBudget = reader->GetFloat("hook_time_budget", 0.0f);
+            model->HookBudgetAction = reader->GetEnum<PluginHookBudgetAction>(
+                "hook_budget_action", PluginHookBudgetAction::Log, Enum_PluginHookBudgetAction);
         }
     }
 
@@ -564,6 +579,8 @@ namespace Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->EnableHotReloading);
         writer->WriteString("allowed_hosts", model->AllowedHosts);
+        writer->WriteFloat("hook_time_budget", model->HookTimeBudget);
+        writer->WriteEnum<PluginHookBudgetAction>("hook_budget_action", model->HookBudgetAction, Enum_PluginHookBudgetAction);
     }
 
     static bool SetDefaults()
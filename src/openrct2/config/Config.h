@@ -23,6 +23,7 @@ enum class Sort : int32_t;
 enum class VirtualFloorStyles : int32_t;
 enum class DrawingEngine : int32_t;
 enum class TitleMusicKind : int32_t;
+enum class PluginHookBudgetAction : int32_t;
 
 struct GeneralConfiguration
 {
@@ -43,6 +44,9 @@ struct GeneralConfiguration
     bool UseVSync;
     bool ShowFPS;
     bool MultiThreading;
+    int32_t ThreadCount; // 0 uses one thread per hardware thread
+    bool ParallelSimulation; // Updates the trains of independent rides on several threads, not in network games
+    int32_t ObjectImageMemoryBudget; // In MiB, unused object images are unloaded above it, 0 keeps them all loaded
     bool MinimizeFullscreenFocusLoss;
     bool DisableScreensaver;
 
@@ -218,6 +222,9 @@ struct PluginConfiguration
 {
     bool EnableHotReloading;
     u8string AllowedHosts;
+    // Time in milliseconds a single hook call may take, 0 for no limit
+    float HookTimeBudget;
+    PluginHookBudgetAction HookBudgetAction;
 };
 
 enum class Sort : int32_t
@@ -256,6 +263,17 @@ enum class TitleMusicKind : int32_t
     Random
 };
 
+enum class PluginHookBudgetAction : int32_t
+{
+    // Write to the log the first time a hook goes over the budget
+    Log,
+    // Also write a warning to the in-game console
+    Warn,
+    // Also stop calling the hook, only for plugins that can not modify the game state and hooks outside of game actions
+    // and the tick
+    Disable,
+};
+
 extern GeneralConfiguration gConfigGeneral;
 extern InterfaceConfiguration gConfigInterface;
 extern SoundConfiguration gConfigSound;
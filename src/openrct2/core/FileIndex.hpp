@@ -10,19 +10,28 @@
 #pragma once
 
 #include "../common.h"
+#include "../profiling/Profiling.h"
 #include "Console.hpp"
 #include "DataSerialiser.h"
 #include "File.h"
 #include "FileScanner.h"
 #include "FileStream.h"
-#include "JobPool.h"
+#include "MemoryMappedFile.h"
+#include "MemoryStream.h"
 #include "Numerics.hpp"
+#include "Parallel.h"
 #include "Path.hpp"
 
 #include <chrono>
-#include <list>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -36,12 +45,19 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct ScannedFile
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<ScannedFile> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string>&& files) noexcept
+        ScanResult(DirectoryStats stats, std::vector<ScannedFile>&& files) noexcept
             : Stats(stats)
             , Files(std::move(files))
         {
@@ -57,10 +73,37 @@ private:
         uint16_t LanguageId = 0;
         DirectoryStats Stats;
         uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
+        uint64_t PathDataSize = 0;
+        uint64_t ItemDataSize = 0;
+    };
+
+    // One record per indexed file, stored after the header. The records are followed by the
+    // path strings and then by the serialised items, so unchanged files can be matched without
+    // touching any item data.
+    struct FileIndexRecord
+    {
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+        uint64_t PathOffset = 0;
+        uint64_t ItemOffset = 0;
+        uint32_t PathLength = 0;
+        uint32_t ItemLength = 0; // Zero if the file did not produce an item.
+    };
+
+    // The result of indexing a single file. Items read from the index stay serialised until GetItems.
+    struct IndexedFile
+    {
+        std::optional<TItem> Item;
+        std::vector<uint8_t> ItemData;
+        // The serialised item, either in the mapped index file or in ItemData.
+        const uint8_t* SerialisedItem = nullptr;
+        size_t SerialisedItemLength = 0;
+        bool Valid = false;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -96,32 +139,41 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries and directories and loads the index. Items of files that have not changed since the
+     * index was written are loaded from the index, only added or changed files are indexed again.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        std::unique_ptr<OpenRCT2::MemoryMappedFile> mappedFile;
+        auto [upToDate, files] = ReadIndexFile(language, scanResult, mappedFile);
+        if (!upToDate)
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            // The index file is about to be rewritten, the items still needed were copied out of it.
+            mappedFile = nullptr;
+
+            // Only index files that are new or have changed, removed files are dropped when the index is written.
+            std::vector<size_t> outdated;
+            for (size_t i = 0; i < files.size(); i++)
+            {
+                if (!files[i].Valid)
+                {
+                    outdated.push_back(i);
+                }
+            }
+            Build(language, scanResult, files, outdated);
         }
-        return items;
+        return GetItems(files);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
-        return items;
+        std::vector<IndexedFile> files(scanResult.Files.size());
+        std::vector<size_t> outdated(files.size());
+        std::iota(outdated.begin(), outdated.end(), 0);
+        Build(language, scanResult, files, outdated);
+        return GetItems(files);
     }
 
 protected:
@@ -139,7 +191,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<ScannedFile> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -159,20 +211,20 @@ private:
                 stats.FileDateModifiedChecksum = Numerics::ror32(stats.FileDateModifiedChecksum, 5);
                 stats.PathChecksum += GetPathChecksum(path);
 
-                files.push_back(std::move(path));
+                files.push_back({ std::move(path), fileInfo->Size, fileInfo->LastModified });
             }
         }
         return ScanResult(stats, std::move(files));
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, const ScanResult& scanResult, const std::vector<size_t>& outdated, size_t rangeStart,
+        size_t rangeEnd, std::vector<IndexedFile>& files, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            const auto fileIndex = outdated[i];
+            const auto& filePath = scanResult.Files[fileIndex].Path;
 
             if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
             {
@@ -180,145 +232,288 @@ private:
                 LOG_VERBOSE("FileIndex:Indexing '%s'", filePath.c_str());
             }
 
-            if (auto item = Create(language, filePath); item.has_value())
+            auto& file = files[fileIndex];
+            file.Item = Create(language, filePath);
+            file.ItemData.clear();
+            file.SerialisedItem = nullptr;
+            file.SerialisedItemLength = 0;
+            if (file.Item.has_value())
             {
-                items.push_back(std::move(item.value()));
+                DataSerialiser ds(true);
+                Serialise(ds, *file.Item);
+                const auto& stream = ds.GetStream();
+                const auto* data = static_cast<const uint8_t*>(stream.GetData());
+                file.ItemData.assign(data, data + stream.GetLength());
+                file.SerialisedItem = file.ItemData.data();
+                file.SerialisedItemLength = file.ItemData.size();
             }
+            file.Valid = true;
 
             ++processed;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Indexes the outdated files and writes the index file.
+     */
+    void Build(
+        int32_t language, const ScanResult& scanResult, std::vector<IndexedFile>& files,
+        const std::vector<size_t>& outdated) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        Console::WriteLine("Building %s (%zu of %zu items)", _name.c_str(), outdated.size(), scanResult.Files.size());
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
+        const size_t totalCount = outdated.size();
         if (totalCount > 0)
         {
-            JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
-
-            size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
+            constexpr size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
             std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
 
-            auto reportProgress = [&]() {
+            // Each range writes to a distinct set of files, no locking is required.
+            OpenRCT2::Parallel::ForRange(totalCount, stepSize, [&](size_t rangeStart, size_t rangeEnd) {
+                PROFILED_FUNCTION();
+
+                BuildRange(language, scanResult, outdated, rangeStart, rangeEnd, files, processed, printLock);
+
+                std::lock_guard<std::mutex> lock(printLock);
                 const size_t completed = processed;
                 Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, totalCount, completed * 100 / totalCount);
-            };
+            });
+        }
 
-            for (size_t rangeStart = 0; rangeStart < totalCount; rangeStart += stepSize)
-            {
-                if (rangeStart + stepSize > totalCount)
-                {
-                    stepSize = totalCount - rangeStart;
-                }
+        WriteIndexFile(language, scanResult, files);
 
-                auto& items = containers.emplace_back();
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration<float>(endTime - startTime);
+        Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+    }
 
-                jobPool.AddTask([&, rangeStart, stepSize]() {
-                    BuildRange(language, scanResult, rangeStart, rangeStart + stepSize, items, processed, printLock);
-                });
+    /**
+     * Deserialises the items that were read from the index, in parallel, and returns all items.
+     */
+    std::vector<TItem> GetItems(std::vector<IndexedFile>& files) const
+    {
+        OpenRCT2::Parallel::For(
+            files.size(),
+            [this, &files](size_t i) {
+                auto& file = files[i];
+                if (file.Item.has_value() || file.SerialisedItemLength == 0)
+                    return;
+
+                OpenRCT2::MemoryStream stream(file.SerialisedItem, file.SerialisedItemLength);
+                DataSerialiser ds(false, stream);
+                TItem item;
+                Serialise(ds, item);
+                file.Item = std::move(item);
+            },
+            256);
 
-                reportProgress();
+        std::vector<TItem> items;
+        items.reserve(files.size());
+        for (auto& file : files)
+        {
+            if (file.Item.has_value())
+            {
+                items.push_back(std::move(*file.Item));
             }
+        }
+        return items;
+    }
 
-            jobPool.Join(reportProgress);
+    bool IsHeaderValid(const FileIndexHeader& header, int32_t language, size_t fileSize) const
+    {
+        if (header.HeaderSize != sizeof(FileIndexHeader) || header.MagicNumber != _magicNumber
+            || header.VersionA != FILE_INDEX_VERSION || header.VersionB != _version || header.LanguageId != language)
+        {
+            return false;
+        }
+        const uint64_t expectedSize = sizeof(FileIndexHeader) + (uint64_t{ header.NumFiles } * sizeof(FileIndexRecord))
+            + header.PathDataSize + header.ItemDataSize;
+        return expectedSize == fileSize;
+    }
 
-            for (const auto& itr : containers)
+    /**
+     * Maps the index file and matches its records against the scanned files. Files with an unchanged
+     * size and modification date refer to their serialised item, which is only deserialised by
+     * GetItems. All other files are returned as not valid. Returns true if the index matched the
+     * scanned files exactly and does not need to be written, in which case the items are left in
+     * the mapped file, otherwise they are copied so the index can be rewritten.
+     */
+    std::tuple<bool, std::vector<IndexedFile>> ReadIndexFile(
+        int32_t language, const ScanResult& scanResult, std::unique_ptr<OpenRCT2::MemoryMappedFile>& mappedFile) const
+    {
+        bool upToDate = false;
+        std::vector<IndexedFile> files(scanResult.Files.size());
+        if (!File::Exists(_indexPath))
+        {
+            return std::make_tuple(upToDate, std::move(files));
+        }
+
+        try
+        {
+            LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
+            mappedFile = std::make_unique<OpenRCT2::MemoryMappedFile>(_indexPath);
+            const auto* data = mappedFile->GetData();
+
+            FileIndexHeader header;
+            if (mappedFile->GetSize() < sizeof(header))
             {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
+                throw IOException("Index file is truncated.");
+            }
+            std::memcpy(&header, data, sizeof(header));
+            if (!IsHeaderValid(header, language, mappedFile->GetSize()))
+            {
+                Console::WriteLine("%s out of date", _name.c_str());
+                return std::make_tuple(upToDate, std::move(files));
             }
-        }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+            const auto* recordData = data + sizeof(FileIndexHeader);
+            const auto* pathData = recordData + (header.NumFiles * sizeof(FileIndexRecord));
+            const auto* itemData = pathData + header.PathDataSize;
 
-        auto endTime = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration<float>(endTime - startTime);
-        Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+            std::unordered_map<std::string_view, FileIndexRecord> recordsByPath;
+            recordsByPath.reserve(header.NumFiles);
+            for (uint32_t i = 0; i < header.NumFiles; i++)
+            {
+                FileIndexRecord record;
+                std::memcpy(&record, recordData + (i * sizeof(FileIndexRecord)), sizeof(record));
+                if (record.PathOffset + record.PathLength > header.PathDataSize
+                    || record.ItemOffset + record.ItemLength > header.ItemDataSize)
+                {
+                    throw IOException("Invalid index record.");
+                }
 
-        return allItems;
-    }
+                auto path = std::string_view(reinterpret_cast<const char*>(pathData + record.PathOffset), record.PathLength);
+                recordsByPath.emplace(path, record);
+            }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
-    {
-        bool loadedItems = false;
-        std::vector<TItem> items;
-        if (File::Exists(_indexPath))
-        {
-            try
+            // Match the records first so the serialised items only need to be copied if the index is rewritten.
+            std::vector<const FileIndexRecord*> matches(scanResult.Files.size());
+            size_t numMatches = 0;
+            for (size_t i = 0; i < scanResult.Files.size(); i++)
             {
-                LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
-                auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
-
-                // Read header, check if we need to re-scan
-                auto header = fs.ReadValue<FileIndexHeader>();
-                if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                const auto& scannedFile = scanResult.Files[i];
+                auto it = recordsByPath.find(scannedFile.Path);
+                if (it != recordsByPath.end() && it->second.Size == scannedFile.Size
+                    && it->second.LastModified == scannedFile.LastModified)
                 {
-                    items.reserve(header.NumItems);
-                    DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
-                    {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
-                    }
-                    loadedItems = true;
+                    matches[i] = &it->second;
+                    numMatches++;
                 }
-                else
+            }
+            upToDate = numMatches == scanResult.Files.size() && numMatches == recordsByPath.size();
+
+            for (size_t i = 0; i < matches.size(); i++)
+            {
+                const auto* record = matches[i];
+                if (record == nullptr)
+                    continue;
+
+                auto& file = files[i];
+                if (record->ItemLength != 0)
                 {
-                    Console::WriteLine("%s out of date", _name.c_str());
+                    const auto* itemBytes = itemData + record->ItemOffset;
+                    if (upToDate)
+                    {
+                        file.SerialisedItem = itemBytes;
+                    }
+                    else
+                    {
+                        file.ItemData.assign(itemBytes, itemBytes + record->ItemLength);
+                        file.SerialisedItem = file.ItemData.data();
+                    }
+                    file.SerialisedItemLength = record->ItemLength;
                 }
+                file.Valid = true;
             }
-            catch (const std::exception& e)
+
+            if (!upToDate)
             {
-                Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
-                Console::Error::WriteLine("%s", e.what());
+                Console::WriteLine("%s out of date", _name.c_str());
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
+            Console::Error::WriteLine("%s", e.what());
+            upToDate = false;
+            files = std::vector<IndexedFile>(scanResult.Files.size());
+            mappedFile = nullptr;
+        }
+        return std::make_tuple(upToDate, std::move(files));
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, const ScanResult& scanResult, const std::vector<IndexedFile>& files) const
     {
+        // The index is written next to the old one and then replaces it, so an interrupted write or another instance
+        // reading the index never sees a partly written file
+        auto tempPath = _indexPath + "." + std::to_string(std::random_device{}()) + ".tmp";
         try
         {
             LOG_VERBOSE("FileIndex:Writing index: '%s'", _indexPath.c_str());
-            Path::CreateDirectory(Path::GetDirectory(_indexPath));
-            auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_WRITE);
 
-            // Write header
+            std::vector<FileIndexRecord> records;
+            records.reserve(files.size());
+
             FileIndexHeader header;
             header.MagicNumber = _magicNumber;
             header.VersionA = FILE_INDEX_VERSION;
             header.VersionB = _version;
             header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
-            fs.WriteValue(header);
+            header.Stats = scanResult.Stats;
+            for (size_t i = 0; i < files.size(); i++)
+            {
+                const auto& path = scanResult.Files[i].Path;
+                const auto& file = files[i];
+
+                FileIndexRecord record;
+                record.Size = scanResult.Files[i].Size;
+                record.LastModified = scanResult.Files[i].LastModified;
+                record.PathOffset = header.PathDataSize;
+                record.PathLength = static_cast<uint32_t>(path.size());
+                record.ItemOffset = header.ItemDataSize;
+                record.ItemLength = static_cast<uint32_t>(file.ItemData.size());
+                records.push_back(record);
+
+                header.PathDataSize += path.size();
+                header.ItemDataSize += file.ItemData.size();
+                if (file.Item.has_value())
+                {
+                    header.NumItems++;
+                }
+            }
+            header.NumFiles = static_cast<uint32_t>(records.size());
 
-            DataSerialiser ds(true, fs);
-            // Write items
-            for (const auto& item : items)
+            Path::CreateDirectory(Path::GetDirectory(_indexPath));
             {
-                Serialise(ds, item);
+                auto fs = OpenRCT2::FileStream(tempPath, OpenRCT2::FILE_MODE_WRITE);
+                fs.WriteValue(header);
+                fs.Write(records.data(), records.size() * sizeof(FileIndexRecord));
+                for (const auto& scannedFile : scanResult.Files)
+                {
+                    fs.Write(scannedFile.Path.data(), scannedFile.Path.size());
+                }
+                for (const auto& file : files)
+                {
+                    fs.Write(file.ItemData.data(), file.ItemData.size());
+                }
+            }
+
+            if (!File::Move(tempPath, _indexPath))
+            {
+                File::Delete(tempPath);
+                Console::Error::WriteLine("Unable to replace index: '%s'.", _indexPath.c_str());
             }
         }
         catch (const std::exception& e)
         {
             Console::Error::WriteLine("Unable to save index: '%s'.", _indexPath.c_str());
             Console::Error::WriteLine("%s", e.what());
+            File::Delete(tempPath);
         }
     }
 
@@ -96,6 +96,11 @@ size_t JobPool::CountPending()
     return _pending.size();
 }
 
+size_t JobPool::GetThreadCount() const
+{
+    return _threads.size();
+}
+
 void JobPool::ProcessQueue()
 {
     unique_lock lock(_mutex);
@@ -117,7 +122,11 @@ void JobPool::ProcessQueue()
 
             lock.lock();
 
-            _completed.push_back(std::move(taskData));
+            // Only tasks with a completion callback have to be kept around for Join.
+            if (taskData.CompletionFn)
+            {
+                _completed.push_back(std::move(taskData));
+            }
 
             _processing--;
             _condComplete.notify_one();
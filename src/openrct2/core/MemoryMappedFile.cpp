@@ -0,0 +1,122 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryMappedFile.h"
+
+#include "IStream.hpp"
+#include "String.hpp"
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace OpenRCT2
+{
+    MemoryMappedFile::MemoryMappedFile(std::string_view path)
+    {
+        auto szPath = std::string(path);
+#ifdef _WIN32
+        auto pathW = String::ToWideChar(szPath);
+        auto file = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw IOException(String::StdFormat("Unable to open '%s'", szPath.c_str()));
+        }
+        _file = file;
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            Close();
+            throw IOException(String::StdFormat("Unable to get size of '%s'", szPath.c_str()));
+        }
+        _size = static_cast<size_t>(fileSize.QuadPart);
+        if (_size == 0)
+        {
+            return;
+        }
+
+        _mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mapping != nullptr)
+        {
+            _data = static_cast<const uint8_t*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        }
+#else
+        auto fd = open(szPath.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw IOException(String::StdFormat("Unable to open '%s'", szPath.c_str()));
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+        {
+            close(fd);
+            throw IOException(String::StdFormat("Unable to open '%s'", szPath.c_str()));
+        }
+        _size = static_cast<size_t>(fileStat.st_size);
+        if (_size == 0)
+        {
+            close(fd);
+            return;
+        }
+
+        // The mapping stays valid after the descriptor is closed.
+        auto data = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (data != MAP_FAILED)
+        {
+            _data = static_cast<const uint8_t*>(data);
+        }
+#endif
+        if (_data == nullptr)
+        {
+            Close();
+            throw IOException(String::StdFormat("Unable to map '%s'", szPath.c_str()));
+        }
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Close();
+    }
+
+    void MemoryMappedFile::Close() noexcept
+    {
+#ifdef _WIN32
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+        }
+        if (_mapping != nullptr)
+        {
+            CloseHandle(_mapping);
+        }
+        if (_file != nullptr)
+        {
+            CloseHandle(_file);
+        }
+        _mapping = nullptr;
+        _file = nullptr;
+#else
+        if (_data != nullptr)
+        {
+            munmap(const_cast<uint8_t*>(_data), _size);
+        }
+#endif
+        _data = nullptr;
+        _size = 0;
+    }
+} // namespace OpenRCT2
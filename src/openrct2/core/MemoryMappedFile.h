@@ -0,0 +1,51 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string_view>
+
+namespace OpenRCT2
+{
+    /**
+     * A read-only view of a file mapped into memory. Pages are loaded on demand and shared
+     * between all processes that map the same file.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+        const uint8_t* _data = nullptr;
+        size_t _size = 0;
+#ifdef _WIN32
+        void* _file = nullptr;
+        void* _mapping = nullptr;
+#endif
+
+    public:
+        explicit MemoryMappedFile(std::string_view path);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        ~MemoryMappedFile();
+
+        const uint8_t* GetData() const noexcept
+        {
+            return _data;
+        }
+
+        size_t GetSize() const noexcept
+        {
+            return _size;
+        }
+
+    private:
+        void Close() noexcept;
+    };
+} // namespace OpenRCT2
@@ -0,0 +1,146 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Parallel.h"
+
+#include "JobPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace OpenRCT2::Parallel
+{
+    struct LoopState
+    {
+        const std::function<void(size_t, size_t)>* Fn{};
+        size_t Count{};
+        size_t ChunkSize{};
+        size_t NumChunks{};
+        std::atomic<size_t> NextChunk{};
+        std::atomic<size_t> CompletedChunks{};
+        std::atomic<bool> Failed{};
+        std::exception_ptr Exception;
+        std::mutex Mutex;
+        std::condition_variable Completed;
+    };
+
+    static std::mutex _poolMutex;
+    static std::unique_ptr<JobPool> _pool;
+    static size_t _threadCount;
+
+    // _poolMutex must be held
+    static size_t ResolveThreadCount()
+    {
+        auto hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        return _threadCount == 0 ? hardwareThreads : std::min(_threadCount, hardwareThreads);
+    }
+
+    void SetThreadCount(size_t count)
+    {
+        std::lock_guard<std::mutex> lock(_poolMutex);
+        _threadCount = count;
+    }
+
+    size_t GetThreadCount()
+    {
+        std::lock_guard<std::mutex> lock(_poolMutex);
+        return ResolveThreadCount();
+    }
+
+    static JobPool& GetPool()
+    {
+        std::lock_guard<std::mutex> lock(_poolMutex);
+        if (_pool == nullptr)
+        {
+            // The calling thread of a loop takes part in it, so the pool needs one thread less
+            _pool = std::make_unique<JobPool>(ResolveThreadCount() - 1);
+        }
+        return *_pool;
+    }
+
+    static void RunChunks(LoopState& state)
+    {
+        size_t chunk;
+        while ((chunk = state.NextChunk++) < state.NumChunks)
+        {
+            // Once a chunk failed the remaining ones are only counted as completed
+            if (!state.Failed)
+            {
+                auto begin = chunk * state.ChunkSize;
+                auto end = std::min(begin + state.ChunkSize, state.Count);
+                try
+                {
+                    (*state.Fn)(begin, end);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(state.Mutex);
+                    if (!state.Failed)
+                    {
+                        state.Exception = std::current_exception();
+                        state.Failed = true;
+                    }
+                }
+            }
+
+            if (++state.CompletedChunks == state.NumChunks)
+            {
+                std::lock_guard<std::mutex> lock(state.Mutex);
+                state.Completed.notify_all();
+            }
+        }
+    }
+
+    void ForRange(size_t count, size_t chunkSize, const std::function<void(size_t begin, size_t end)>& fn)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Tasks that only start after all chunks have been taken return immediately, they hold on to the state but
+        // never call fn.
+        auto state = std::make_shared<LoopState>();
+        state->Fn = &fn;
+        state->Count = count;
+        state->ChunkSize = std::max<size_t>(chunkSize, 1);
+        state->NumChunks = (count + state->ChunkSize - 1) / state->ChunkSize;
+
+        auto& pool = GetPool();
+        auto numTasks = std::min(state->NumChunks - 1, pool.GetThreadCount());
+        for (size_t i = 0; i < numTasks; i++)
+        {
+            pool.AddTask([state]() { RunChunks(*state); });
+        }
+
+        RunChunks(*state);
+
+        std::unique_lock<std::mutex> lock(state->Mutex);
+        state->Completed.wait(lock, [&state]() { return state->CompletedChunks == state->NumChunks; });
+        if (state->Exception != nullptr)
+        {
+            std::rethrow_exception(state->Exception);
+        }
+    }
+
+    void For(size_t count, const std::function<void(size_t index)>& fn, size_t chunkSize)
+    {
+        ForRange(count, chunkSize, [&fn](size_t begin, size_t end) {
+            for (auto i = begin; i < end; i++)
+            {
+                fn(i);
+            }
+        });
+    }
+} // namespace OpenRCT2::Parallel
@@ -0,0 +1,39 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * Process wide parallel runtime, all parallel loops share a single job pool so the number of threads used by the game
+ * can be capped in one place.
+ */
+namespace OpenRCT2::Parallel
+{
+    /**
+     * Sets the number of threads of the shared job pool, 0 uses one thread per hardware thread. Only has an effect
+     * before the pool is first used.
+     */
+    void SetThreadCount(size_t count);
+    size_t GetThreadCount();
+
+    /**
+     * Calls fn for consecutive ranges of at most chunkSize indices covering [0, count). Ranges are handed out to the
+     * pool threads and the calling thread as they become free, so a few slow ranges do not hold up the others.
+     * Returns once every call has returned, the first exception thrown by fn is rethrown on the calling thread.
+     */
+    void ForRange(size_t count, size_t chunkSize, const std::function<void(size_t begin, size_t end)>& fn);
+
+    /**
+     * Calls fn for each index in [0, count), see ForRange.
+     */
+    void For(size_t count, const std::function<void(size_t index)>& fn, size_t chunkSize = 1);
+} // namespace OpenRCT2::Parallel
@@ -20,6 +20,7 @@
 #include "../sprites.h"
 #include "../ui/UiContext.h"
 #include "../util/Util.h"
+#include "Image.h"
 #include "ScrollingText.h"
 
 #include <algorithm>
@@ -194,9 +195,8 @@ bool gTinyFontAntiAliased = false;
  *
  *  rct2: 0x00678998
  */
-bool GfxLoadG1(const IPlatformEnvironment& env)
+static bool LoadG1(const IPlatformEnvironment& env, bool headersOnly)
 {
-    LOG_VERBOSE("GfxLoadG1(...)");
     try
     {
         auto path = env.FindFile(DIRBASE::RCT2, DIRID::DATA, u8"g1.dat");
@@ -216,6 +216,15 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
         ReadAndConvertGxDat(&fs, _g1.header.num_entries, is_rctc, _g1.elements.data());
         gTinyFontAntiAliased = is_rctc;
 
+        if (headersOnly)
+        {
+            for (auto& element : _g1.elements)
+            {
+                element.offset = nullptr;
+            }
+            return true;
+        }
+
         // Read element data
         _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
 
@@ -241,6 +250,22 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
     }
 }
 
+bool GfxLoadG1(const IPlatformEnvironment& env)
+{
+    LOG_VERBOSE("GfxLoadG1(...)");
+    return LoadG1(env, false);
+}
+
+/**
+ * Loads only the element headers of g1.dat. Headless instances need them to follow the zoom images of objects that use
+ * g1.dat images, so their image ids are allocated the same way as with graphics.
+ */
+bool GfxLoadG1Headers(const IPlatformEnvironment& env)
+{
+    LOG_VERBOSE("GfxLoadG1Headers(...)");
+    return LoadG1(env, true);
+}
+
 void GfxUnloadG1()
 {
     _g1.data.reset();
@@ -320,10 +345,8 @@ bool GfxLoadG2()
     return false;
 }
 
-bool GfxLoadCsg()
+static bool LoadCsg(bool headersOnly)
 {
-    LOG_VERBOSE("GfxLoadCsg()");
-
     if (gConfigGeneral.RCT1Path.empty())
     {
         LOG_VERBOSE("  unable to load CSG, RCT1 path not set");
@@ -353,12 +376,22 @@ bool GfxLoadCsg()
         ReadAndConvertGxDat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        if (!headersOnly)
+        {
+            _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        }
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
+            if (headersOnly)
+            {
+                _csg.elements[i].offset = nullptr;
+            }
+            else
+            {
+                _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
+            }
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
@@ -378,6 +411,21 @@ bool GfxLoadCsg()
     }
 }
 
+bool GfxLoadCsg()
+{
+    LOG_VERBOSE("GfxLoadCsg()");
+    return LoadCsg(false);
+}
+
+/**
+ * Loads only the element headers of csg1i.dat, see GfxLoadG1Headers.
+ */
+bool GfxLoadCsgHeaders()
+{
+    LOG_VERBOSE("GfxLoadCsgHeaders()");
+    return LoadCsg(true);
+}
+
 std::optional<Gx> GfxLoadGx(const std::vector<uint8_t>& buffer)
 {
     try
@@ -755,12 +803,39 @@ const G1Element* GfxGetG1Element(ImageIndex image_id)
         size_t idx = offset - SPR_IMAGE_LIST_BEGIN;
         if (idx < _imageListElements.size())
         {
+            // Loads the image data if the image belongs to a deferred image list
+            GfxObjectUseImage(static_cast<ImageIndex>(offset));
             return &_imageListElements[idx];
         }
     }
     return nullptr;
 }
 
+/**
+ * Returns the header of a g1.dat or csg1.dat element. Unlike GfxGetG1Element this can be called on headless
+ * instances, the image data is not loaded there.
+ */
+const G1Element* GfxGetG1ElementHeader(ImageIndex imageId)
+{
+    auto offset = static_cast<size_t>(imageId);
+    if (offset < SPR_RCTC_G1_END)
+    {
+        if (offset < _g1.elements.size())
+        {
+            return &_g1.elements[offset];
+        }
+    }
+    else if (offset >= SPR_CSG_BEGIN && offset < SPR_CSG_END)
+    {
+        size_t idx = offset - SPR_CSG_BEGIN;
+        if (IsCsgLoaded() && idx < _csg.elements.size())
+        {
+            return &_csg.elements[idx];
+        }
+    }
+    return nullptr;
+}
+
 void GfxSetG1Element(ImageIndex imageId, const G1Element* g1)
 {
     bool isTemp = imageId == SPR_TEMP;
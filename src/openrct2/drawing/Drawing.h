@@ -152,6 +152,7 @@ enum
     G1_FLAG_PALETTE = (1 << 3),         // Image data is a sequence of palette entries R8G8B8
     G1_FLAG_HAS_ZOOM_SPRITE = (1 << 4), // Use a different sprite for higher zoom levels
     G1_FLAG_NO_ZOOM_DRAW = (1 << 5),    // Does not get drawn at higher zoom levels (only zoom 0)
+    G1_FLAG_DEFERRED = (1 << 6),        // Image data has not been loaded yet, see GfxObjectAllocateDeferredImages
 };
 
 using DrawBlendOp = uint8_t;
@@ -495,13 +496,16 @@ void GfxFilterRect(DrawPixelInfo* dpi, const ScreenRect& rect, FilterPaletteID p
 
 // sprite
 bool GfxLoadG1(const OpenRCT2::IPlatformEnvironment& env);
+bool GfxLoadG1Headers(const OpenRCT2::IPlatformEnvironment& env);
 bool GfxLoadG2();
 bool GfxLoadCsg();
+bool GfxLoadCsgHeaders();
 void GfxUnloadG1();
 void GfxUnloadG2();
 void GfxUnloadCsg();
 const G1Element* GfxGetG1Element(const ImageId imageId);
 const G1Element* GfxGetG1Element(ImageIndex image_id);
+const G1Element* GfxGetG1ElementHeader(ImageIndex imageId);
 void GfxSetG1Element(ImageIndex imageId, const G1Element* g1);
 std::optional<Gx> GfxLoadGx(const std::vector<uint8_t>& buffer);
 bool IsCsgLoaded();
@@ -10,22 +10,48 @@
 #include "Image.h"
 
 #include "../OpenRCT2.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/Guard.hpp"
 #include "../sprites.h"
 #include "Drawing.h"
 
 #include <algorithm>
+#include <atomic>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 constexpr uint32_t BASE_IMAGE_ID = SPR_IMAGE_LIST_BEGIN;
 constexpr uint32_t MAX_IMAGES = SPR_IMAGE_LIST_END - BASE_IMAGE_ID;
 constexpr uint32_t INVALID_IMAGE_ID = UINT32_MAX;
 
+struct DeferredImageList
+{
+    ImageList Range;
+    IDeferredImageSource* Source{};
+    // Held while the image data is read, so the source is only loaded by one thread at a time
+    std::mutex LoadMutex;
+    std::atomic<bool> Loaded{};
+    std::atomic<uint32_t> LastUsed{};
+    size_t DataSize{};
+};
+
 static bool _initialised = false;
 static std::list<ImageList> _freeLists;
 static uint32_t _allocatedImageCount;
 
+// Images can be requested from multiple drawing threads. Changes to the deferred image lists and the G1 elements of
+// their images are serialised by this mutex, the image data itself is read outside of it.
+static std::mutex _deferredListsMutex;
+static std::vector<std::unique_ptr<DeferredImageList>> _deferredLists;
+// Deferred image list of each image of the image list range, read by drawing threads without taking the mutex.
+// Lists are only added or removed while nothing is drawn.
+static std::atomic<DeferredImageList*> _deferredListByImage[MAX_IMAGES];
+static std::atomic<uint32_t> _deferredImageClock;
+static size_t _deferredImageDataSize;
+
 #ifdef DEBUG_LEVEL_1
 static std::list<ImageList> _allocatedLists;
 
@@ -211,24 +237,217 @@ uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count)
     return baseImageId;
 }
 
+static void SetDeferredPlaceholders(const ImageList& range)
+{
+    G1Element placeholder = {};
+    placeholder.flags = G1_FLAG_DEFERRED;
+    for (auto imageId = range.BaseId; imageId < range.GetEnd(); imageId++)
+    {
+        GfxSetG1Element(imageId, &placeholder);
+    }
+}
+
+/**
+ * Reserves image ids for an image list without loading its image data. The data is requested from the source when
+ * one of the images is first used, see GfxObjectUseImage.
+ */
+uint32_t GfxObjectAllocateDeferredImages(IDeferredImageSource& source, uint32_t count)
+{
+    if (count == 0)
+    {
+        return INVALID_IMAGE_ID;
+    }
+
+    uint32_t baseImageId = AllocateImageList(count);
+    if (baseImageId == INVALID_IMAGE_ID)
+    {
+        LOG_ERROR("Reached maximum image limit.");
+        return INVALID_IMAGE_ID;
+    }
+
+    // Headless instances never draw, only reserve the ids so they match those of an instance with graphics
+    if (gOpenRCT2NoGraphics)
+    {
+        return baseImageId;
+    }
+
+    std::lock_guard<std::mutex> lock(_deferredListsMutex);
+
+    auto list = std::make_unique<DeferredImageList>();
+    list->Range = { baseImageId, count };
+    list->Source = &source;
+    list->LastUsed = _deferredImageClock.load(std::memory_order_relaxed);
+
+    // The placeholders have to be in place before the list can be found
+    SetDeferredPlaceholders({ baseImageId, count });
+    auto index = baseImageId - BASE_IMAGE_ID;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        _deferredListByImage[index + i].store(list.get(), std::memory_order_release);
+    }
+    _deferredLists.push_back(std::move(list));
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        DrawingEngineInvalidateImage(baseImageId + i);
+    }
+    return baseImageId;
+}
+
+static void RemoveDeferredList(uint32_t baseImageId, uint32_t count)
+{
+    std::lock_guard<std::mutex> lock(_deferredListsMutex);
+
+    auto index = baseImageId - BASE_IMAGE_ID;
+    auto* list = _deferredListByImage[index].load(std::memory_order_relaxed);
+    if (list == nullptr)
+    {
+        return;
+    }
+
+    if (list->Loaded)
+    {
+        _deferredImageDataSize -= list->DataSize;
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        _deferredListByImage[index + i].store(nullptr, std::memory_order_relaxed);
+    }
+    auto it = std::find_if(_deferredLists.begin(), _deferredLists.end(), [list](const auto& item) {
+        return item.get() == list;
+    });
+    if (it != _deferredLists.end())
+    {
+        _deferredLists.erase(it);
+    }
+}
+
 void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count)
 {
     if (baseImageId != 0 && baseImageId != INVALID_IMAGE_ID)
     {
-        // Zero the G1 elements so we don't have invalid pointers
-        // and data lying about
-        for (uint32_t i = 0; i < count; i++)
+        if (!gOpenRCT2NoGraphics)
         {
-            uint32_t imageId = baseImageId + i;
-            G1Element g1 = {};
-            GfxSetG1Element(imageId, &g1);
-            DrawingEngineInvalidateImage(imageId);
+            RemoveDeferredList(baseImageId, count);
+
+            // Zero the G1 elements so we don't have invalid pointers
+            // and data lying about
+            for (uint32_t i = 0; i < count; i++)
+            {
+                uint32_t imageId = baseImageId + i;
+                G1Element g1 = {};
+                GfxSetG1Element(imageId, &g1);
+                DrawingEngineInvalidateImage(imageId);
+            }
         }
 
         FreeImageList(baseImageId, count);
     }
 }
 
+static void LoadDeferredList(DeferredImageList& list)
+{
+    std::lock_guard<std::mutex> loadLock(list.LoadMutex);
+    if (list.Loaded.load(std::memory_order_acquire))
+    {
+        // Loaded by another thread while waiting for the lock
+        return;
+    }
+
+    // Reading the object again can take a while and may allocate images itself, so other lists stay available
+    const auto* images = list.Source->LoadImages();
+    auto dataSize = images != nullptr ? list.Source->GetImageDataSize() : 0;
+
+    std::lock_guard<std::mutex> lock(_deferredListsMutex);
+    G1Element empty = {};
+    for (uint32_t i = 0; i < list.Range.Count; i++)
+    {
+        GfxSetG1Element(list.Range.BaseId + i, images != nullptr ? &images[i] : &empty);
+    }
+
+    list.DataSize = dataSize;
+    _deferredImageDataSize += dataSize;
+    list.Loaded.store(true, std::memory_order_release);
+}
+
+/**
+ * Called for every image list image that is requested, loads the image data of deferred image lists on first use and
+ * tracks when they were last used.
+ */
+void GfxObjectUseImage(ImageIndex imageId)
+{
+    auto index = static_cast<size_t>(imageId) - BASE_IMAGE_ID;
+    if (index >= MAX_IMAGES)
+    {
+        return;
+    }
+
+    auto* deferredList = _deferredListByImage[index].load(std::memory_order_acquire);
+    if (deferredList == nullptr)
+    {
+        return;
+    }
+
+    auto& list = *deferredList;
+    auto clock = _deferredImageClock.load(std::memory_order_relaxed);
+    if (list.LastUsed.load(std::memory_order_relaxed) != clock)
+    {
+        list.LastUsed.store(clock, std::memory_order_relaxed);
+    }
+    if (!list.Loaded.load(std::memory_order_acquire))
+    {
+        LoadDeferredList(list);
+    }
+}
+
+/**
+ * Unloads the image data of deferred image lists that were not used since the last call, least recently used first,
+ * until the loaded image data fits within the memory budget set by the object_image_memory_budget option. Must not be
+ * called while drawing.
+ */
+void GfxObjectUnloadUnusedImages()
+{
+    std::lock_guard<std::mutex> lock(_deferredListsMutex);
+
+    auto clock = _deferredImageClock.fetch_add(1, std::memory_order_relaxed);
+    if (gConfigGeneral.ObjectImageMemoryBudget <= 0)
+    {
+        return;
+    }
+    const auto budget = static_cast<size_t>(gConfigGeneral.ObjectImageMemoryBudget) * 1024 * 1024;
+    if (_deferredImageDataSize <= budget)
+    {
+        return;
+    }
+
+    std::vector<DeferredImageList*> unusedLists;
+    for (auto& list : _deferredLists)
+    {
+        if (list->Loaded && list->LastUsed != clock)
+        {
+            unusedLists.push_back(list.get());
+        }
+    }
+    std::sort(unusedLists.begin(), unusedLists.end(), [](const DeferredImageList* a, const DeferredImageList* b) {
+        return a->LastUsed < b->LastUsed;
+    });
+
+    for (auto* list : unusedLists)
+    {
+        if (_deferredImageDataSize <= budget)
+        {
+            break;
+        }
+
+        // The drawing engine does not need to be invalidated, the same image data is loaded again on next use
+        SetDeferredPlaceholders(list->Range);
+        list->Source->UnloadImages();
+        _deferredImageDataSize -= list->DataSize;
+        list->DataSize = 0;
+        list->Loaded = false;
+    }
+}
+
 void GfxObjectCheckAllImagesFreed()
 {
     if (_allocatedImageCount != 0)
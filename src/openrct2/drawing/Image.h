@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "../common.h"
 #include "ImageId.hpp"
 
 #include <cstddef>
@@ -55,8 +56,26 @@ constexpr bool operator!=(const ImageList& lhs, const ImageList& rhs)
     return !(lhs == rhs);
 }
 
+/**
+ * Provides the image data for an image list that is only loaded once one of its images is used.
+ */
+struct IDeferredImageSource
+{
+    virtual ~IDeferredImageSource() = default;
+
+    /**
+     * Loads the image data, returns nullptr if the images could not be loaded.
+     */
+    virtual const G1Element* LoadImages() abstract;
+    virtual void UnloadImages() abstract;
+    virtual size_t GetImageDataSize() const abstract;
+};
+
 uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count);
+uint32_t GfxObjectAllocateDeferredImages(IDeferredImageSource& source, uint32_t count);
 void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count);
+void GfxObjectUseImage(ImageIndex imageId);
+void GfxObjectUnloadUnusedImages();
 void GfxObjectCheckAllImagesFreed();
 size_t ImageListGetUsedCount();
 size_t ImageListGetMaximum();
@@ -23,6 +23,7 @@
 #include "../profiling/Profiling.h"
 #include "../ride/Vehicle.h"
 #include "../scenario/Scenario.h"
+#include "../world/World.h"
 #include "Balloon.h"
 #include "Duck.h"
 #include "EntityTweener.h"
@@ -46,16 +47,44 @@ union Entity
     }
 };
 
-static Entity _entities[MAX_ENTITIES]{};
-static std::array<std::list<EntityId>, EnumValue(EntityType::Count)> gEntityLists;
-static std::vector<EntityId> _freeIdList;
-
-static bool _entityFlashingList[MAX_ENTITIES];
-
 constexpr const uint32_t SPATIAL_INDEX_SIZE = (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL) + 1;
 constexpr const uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 
-static std::array<std::vector<EntityId>, SPATIAL_INDEX_SIZE> gEntitySpatialIndex;
+struct EntityRegistryState
+{
+    Entity Entities[MAX_ENTITIES]{};
+    std::array<std::list<EntityId>, EnumValue(EntityType::Count)> Lists;
+    std::vector<EntityId> FreeIdList;
+    bool FlashingList[MAX_ENTITIES]{};
+    std::array<std::vector<EntityId>, SPATIAL_INDEX_SIZE> SpatialIndex;
+};
+
+static thread_local std::vector<DeferredEntityMove>* _deferredMoves = nullptr;
+
+static EntityRegistryState& GetState()
+{
+    return OpenRCT2::GetCurrentWorld().GetEntityRegistry();
+}
+
+EntityRegistryState* CreateEntityRegistryState()
+{
+    auto* state = new EntityRegistryState();
+    for (EntityId::UnderlyingType i = 0; i < MAX_ENTITIES; i++)
+    {
+        auto& entity = state->Entities[i].base;
+        entity.Type = EntityType::Null;
+        entity.Id = EntityId::FromUnderlying(i);
+
+        // List needs to be back to front to simplify removing
+        state->FreeIdList.push_back(EntityId::FromUnderlying(static_cast<EntityId::UnderlyingType>(MAX_ENTITIES - 1 - i)));
+    }
+    return state;
+}
+
+void DestroyEntityRegistryState(EntityRegistryState* state)
+{
+    delete state;
+}
 
 static void FreeEntity(EntityBase& entity);
 
@@ -95,12 +124,12 @@ constexpr bool EntityTypeIsMiscEntity(const EntityType type)
 
 uint16_t GetEntityListCount(EntityType type)
 {
-    return static_cast<uint16_t>(gEntityLists[EnumValue(type)].size());
+    return static_cast<uint16_t>(GetState().Lists[EnumValue(type)].size());
 }
 
 uint16_t GetNumFreeEntities()
 {
-    return static_cast<uint16_t>(_freeIdList.size());
+    return static_cast<uint16_t>(GetState().FreeIdList.size());
 }
 
 std::string EntitiesChecksum::ToString() const
@@ -121,7 +150,7 @@ std::string EntitiesChecksum::ToString() const
 EntityBase* TryGetEntity(EntityId entityIndex)
 {
     const auto idx = entityIndex.ToUnderlying();
-    return idx >= MAX_ENTITIES ? nullptr : &_entities[idx].base;
+    return idx >= MAX_ENTITIES ? nullptr : &GetState().Entities[idx].base;
 }
 
 EntityBase* GetEntity(EntityId entityIndex)
@@ -136,12 +165,12 @@ EntityBase* GetEntity(EntityId entityIndex)
 
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos)
 {
-    return gEntitySpatialIndex[GetSpatialIndexOffset(spritePos)];
+    return GetState().SpatialIndex[GetSpatialIndexOffset(spritePos)];
 }
 
 static void ResetEntityLists()
 {
-    for (auto& list : gEntityLists)
+    for (auto& list : GetState().Lists)
     {
         list.clear();
     }
@@ -149,12 +178,13 @@ static void ResetEntityLists()
 
 static void ResetFreeIds()
 {
-    _freeIdList.clear();
-    _freeIdList.resize(MAX_ENTITIES);
+    auto& freeIdList = GetState().FreeIdList;
+    freeIdList.clear();
+    freeIdList.resize(MAX_ENTITIES);
 
     // List needs to be back to front to simplify removing
     auto nextId = 0;
-    std::for_each(std::rbegin(_freeIdList), std::rend(_freeIdList), [&](auto& elem) {
+    std::for_each(std::rbegin(freeIdList), std::rend(freeIdList), [&](auto& elem) {
         elem = EntityId::FromUnderlying(nextId);
         nextId++;
     });
@@ -162,7 +192,7 @@ static void ResetFreeIds()
 
 const std::list<EntityId>& GetEntityList(const EntityType id)
 {
-    return gEntityLists[EnumValue(id)];
+    return GetState().Lists[EnumValue(id)];
 }
 
 /**
@@ -184,7 +214,8 @@ void ResetAllEntities()
         FreeEntity(*spr);
     }
 
-    std::fill(std::begin(_entities), std::end(_entities), Entity());
+    auto& state = GetState();
+    std::fill(std::begin(state.Entities), std::end(state.Entities), Entity());
     OpenRCT2::RideUse::GetHistory().Clear();
     OpenRCT2::RideUse::GetTypeHistory().Clear();
     for (int32_t i = 0; i < MAX_ENTITIES; ++i)
@@ -197,7 +228,7 @@ void ResetAllEntities()
         spr->Type = EntityType::Null;
         spr->Id = EntityId::FromUnderlying(i);
 
-        _entityFlashingList[i] = false;
+        state.FlashingList[i] = false;
     }
     ResetEntityLists();
     ResetFreeIds();
@@ -214,7 +245,7 @@ static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
  */
 void ResetEntitySpatialIndices()
 {
-    for (auto& vec : gEntitySpatialIndex)
+    for (auto& vec : GetState().SpatialIndex)
     {
         vec.clear();
     }
@@ -266,7 +297,7 @@ static void EntityReset(EntityBase* entity)
 {
     // Need to retain how the sprite is linked in lists
     auto entityIndex = entity->Id;
-    _entityFlashingList[entityIndex.ToUnderlying()] = false;
+    GetState().FlashingList[entityIndex.ToUnderlying()] = false;
 
     Entity* spr = reinterpret_cast<Entity*>(entity);
     *spr = Entity();
@@ -278,7 +309,7 @@ static void EntityReset(EntityBase* entity)
 static constexpr uint16_t MAX_MISC_SPRITES = 300;
 static void AddToEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
+    auto& list = GetState().Lists[EnumValue(entity->Type)];
     // Entity list must be in sprite_index order to prevent desync issues
     list.insert(std::lower_bound(std::begin(list), std::end(list), entity->Id), entity->Id);
 }
@@ -286,12 +317,13 @@ static void AddToEntityList(EntityBase* entity)
 static void AddToFreeList(EntityId index)
 {
     // Free list must be in reverse sprite_index order to prevent desync issues
-    _freeIdList.insert(std::upper_bound(std::rbegin(_freeIdList), std::rend(_freeIdList), index).base(), index);
+    auto& freeIdList = GetState().FreeIdList;
+    freeIdList.insert(std::upper_bound(std::rbegin(freeIdList), std::rend(freeIdList), index).base(), index);
 }
 
 static void RemoveFromEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
+    auto& list = GetState().Lists[EnumValue(entity->Type)];
     auto ptr = BinaryFind(std::begin(list), std::end(list), entity->Id);
     if (ptr != std::end(list))
     {
@@ -333,7 +365,8 @@ static void PrepareNewEntity(EntityBase* base, const EntityType type)
 
 EntityBase* CreateEntity(EntityType type)
 {
-    if (_freeIdList.size() == 0)
+    auto& freeIdList = GetState().FreeIdList;
+    if (freeIdList.size() == 0)
     {
         // No free sprites.
         return nullptr;
@@ -345,18 +378,18 @@ EntityBase* CreateEntity(EntityType type)
         // free it will fail to keep slots for more relevant sprites.
         // Also there can't be more than MAX_MISC_SPRITES sprites in this list.
         uint16_t miscSlotsRemaining = MAX_MISC_SPRITES - GetMiscEntityCount();
-        if (miscSlotsRemaining >= _freeIdList.size())
+        if (miscSlotsRemaining >= freeIdList.size())
         {
             return nullptr;
         }
     }
 
-    auto* entity = GetEntity(_freeIdList.back());
+    auto* entity = GetEntity(freeIdList.back());
     if (entity == nullptr)
     {
         return nullptr;
     }
-    _freeIdList.pop_back();
+    freeIdList.pop_back();
 
     PrepareNewEntity(entity, type);
 
@@ -365,8 +398,9 @@ EntityBase* CreateEntity(EntityType type)
 
 EntityBase* CreateEntityAt(const EntityId index, const EntityType type)
 {
-    auto id = BinaryFind(std::rbegin(_freeIdList), std::rend(_freeIdList), index);
-    if (id == std::rend(_freeIdList))
+    auto& freeIdList = GetState().FreeIdList;
+    auto id = BinaryFind(std::rbegin(freeIdList), std::rend(freeIdList), index);
+    if (id == std::rend(freeIdList))
     {
         return nullptr;
     }
@@ -377,7 +411,7 @@ EntityBase* CreateEntityAt(const EntityId index, const EntityType type)
         return nullptr;
     }
 
-    _freeIdList.erase(std::next(id).base());
+    freeIdList.erase(std::next(id).base());
 
     PrepareNewEntity(entity, type);
     return entity;
@@ -413,15 +447,15 @@ void UpdateAllMiscEntities()
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc)
 {
     size_t newIndex = GetSpatialIndexOffset(newLoc);
-    auto& spatialVector = gEntitySpatialIndex[newIndex];
+    auto& spatialVector = GetState().SpatialIndex[newIndex];
     auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), entity->Id);
     spatialVector.insert(index, entity->Id);
 }
 
-static void EntitySpatialRemove(EntityBase* entity)
+static void EntitySpatialRemove(EntityBase* entity, const CoordsXY& indexedLoc)
 {
-    size_t currentIndex = GetSpatialIndexOffset({ entity->x, entity->y });
-    auto& spatialVector = gEntitySpatialIndex[currentIndex];
+    size_t currentIndex = GetSpatialIndexOffset(indexedLoc);
+    auto& spatialVector = GetState().SpatialIndex[currentIndex];
     auto index = BinaryFind(std::begin(spatialVector), std::end(spatialVector), entity->Id);
     if (index != std::end(spatialVector))
     {
@@ -434,6 +468,11 @@ static void EntitySpatialRemove(EntityBase* entity)
     }
 }
 
+static void EntitySpatialRemove(EntityBase* entity)
+{
+    EntitySpatialRemove(entity, { entity->x, entity->y });
+}
+
 static void EntitySpatialMove(EntityBase* entity, const CoordsXY& newLoc)
 {
     size_t newIndex = GetSpatialIndexOffset(newLoc);
@@ -441,10 +480,45 @@ static void EntitySpatialMove(EntityBase* entity, const CoordsXY& newLoc)
     if (newIndex == currentIndex)
         return;
 
+    if (_deferredMoves != nullptr)
+    {
+        // Only the first move matters, that is where the entity is still indexed
+        auto it = std::find_if(_deferredMoves->begin(), _deferredMoves->end(), [entity](const DeferredEntityMove& move) {
+            return move.Id == entity->Id;
+        });
+        if (it == _deferredMoves->end())
+        {
+            _deferredMoves->push_back({ entity->Id, { entity->x, entity->y } });
+        }
+        return;
+    }
+
     EntitySpatialRemove(entity);
     EntitySpatialInsert(entity, newLoc);
 }
 
+void EntitySpatialDeferMoves(std::vector<DeferredEntityMove>* moves)
+{
+    _deferredMoves = moves;
+}
+
+void EntitySpatialApplyMoves(const std::vector<DeferredEntityMove>& moves)
+{
+    for (const auto& move : moves)
+    {
+        auto* entity = GetEntity(move.Id);
+        if (entity == nullptr)
+            continue;
+
+        const CoordsXY newLoc = { entity->x, entity->y };
+        if (GetSpatialIndexOffset(newLoc) == GetSpatialIndexOffset(move.IndexedLoc))
+            continue;
+
+        EntitySpatialRemove(entity, move.IndexedLoc);
+        EntitySpatialInsert(entity, newLoc);
+    }
+}
+
 void EntityBase::MoveTo(const CoordsXYZ& newLocation)
 {
     if (x != LOCATION_NULL)
@@ -551,11 +625,11 @@ uint16_t RemoveFloatingEntities()
 void EntitySetFlashing(EntityBase* entity, bool flashing)
 {
     assert(entity->Id.ToUnderlying() < MAX_ENTITIES);
-    _entityFlashingList[entity->Id.ToUnderlying()] = flashing;
+    GetState().FlashingList[entity->Id.ToUnderlying()] = flashing;
 }
 
 bool EntityGetFlashing(EntityBase* entity)
 {
     assert(entity->Id.ToUnderlying() < MAX_ENTITIES);
-    return _entityFlashingList[entity->Id.ToUnderlying()];
+    return GetState().FlashingList[entity->Id.ToUnderlying()];
 }
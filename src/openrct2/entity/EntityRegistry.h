@@ -13,9 +13,15 @@
 #include "EntityBase.h"
 
 #include <array>
+#include <vector>
 
 constexpr uint16_t MAX_ENTITIES = 65535;
 
+// Storage of all entities of a world, see OpenRCT2::World::GetEntityRegistry
+struct EntityRegistryState;
+EntityRegistryState* CreateEntityRegistryState();
+void DestroyEntityRegistryState(EntityRegistryState* state);
+
 EntityBase* GetEntity(EntityId sprite_idx);
 
 template<typename T> T* GetEntity(EntityId sprite_idx)
@@ -51,6 +57,21 @@ void ResetAllEntities();
 void ResetEntitySpatialIndices();
 void UpdateAllMiscEntities();
 void EntitySetCoordinates(const CoordsXYZ& entityPos, EntityBase* entity);
+
+// An entity moved while spatial index updates were deferred, with the location it is still indexed at
+struct DeferredEntityMove
+{
+    EntityId Id;
+    CoordsXY IndexedLoc;
+};
+
+/**
+ * Records the entities moved by the calling thread instead of updating the spatial index, so entities that do not look
+ * each other up can be moved from several threads. nullptr updates the index directly again.
+ */
+void EntitySpatialDeferMoves(std::vector<DeferredEntityMove>* moves);
+void EntitySpatialApplyMoves(const std::vector<DeferredEntityMove>& moves);
+
 void EntityRemove(EntityBase* entity);
 uint16_t RemoveFloatingEntities();
 
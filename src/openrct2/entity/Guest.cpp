@@ -1749,7 +1749,7 @@ void Guest::OnExitRide(Ride& ride)
     if (PeepFlags & PEEP_FLAGS_RIDE_SHOULD_BE_MARKED_AS_FAVOURITE)
     {
         PeepFlags &= ~PEEP_FLAGS_RIDE_SHOULD_BE_MARKED_AS_FAVOURITE;
-        FavouriteRide = ride.id;
+        SetFavouriteRide(ride.id);
         // TODO fix this flag name or add another one
         WindowInvalidateFlags |= PEEP_INVALIDATE_STAFF_STATS;
     }
@@ -7451,6 +7451,28 @@ static bool IsThoughtShopItemRelated(const PeepThoughtType type)
     return false;
 }
 
+void Guest::SetFavouriteRide(RideId rideId)
+{
+    if (FavouriteRide == rideId)
+        return;
+
+    auto* oldRide = GetRide(FavouriteRide);
+    if (oldRide != nullptr && oldRide->guests_favourite > 0)
+    {
+        oldRide->guests_favourite--;
+        oldRide->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
+    }
+
+    FavouriteRide = rideId;
+
+    auto* newRide = GetRide(rideId);
+    if (newRide != nullptr)
+    {
+        newRide->guests_favourite++;
+        newRide->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
+    }
+}
+
 void Guest::RemoveRideFromMemory(RideId rideId)
 {
     if (State == PeepState::Watching)
@@ -7511,7 +7533,7 @@ void Guest::RemoveRideFromMemory(RideId rideId)
     }
     if (FavouriteRide == rideId)
     {
-        FavouriteRide = RideId::GetNull();
+        SetFavouriteRide(RideId::GetNull());
     }
 
     // Erase all thoughts that contain the ride.
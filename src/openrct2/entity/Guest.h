@@ -377,6 +377,8 @@ public:
     // Removes the ride from the guests memory, this includes
     // the history, thoughts, etc.
     void RemoveRideFromMemory(RideId rideId);
+    // Changes the favourite ride, keeping the favourite counts of the rides up to date
+    void SetFavouriteRide(RideId rideId);
 
 private:
     void UpdateRide();
@@ -688,6 +688,7 @@ void PeepEntityRemove(Peep* peep)
     if (guest != nullptr)
     {
         guest->RemoveFromRide();
+        guest->SetFavouriteRide(RideId::GetNull());
     }
     peep->Invalidate();
 
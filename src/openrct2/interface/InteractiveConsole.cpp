@@ -53,6 +53,9 @@
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/Vehicle.h"
+#include "../scripting/HookEngine.h"
+#include "../scripting/Plugin.h"
+#include "../scripting/ScriptEngine.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
@@ -62,6 +65,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cinttypes>
 #include <cmath>
 #include <cstdarg>
 #include <cstdlib>
@@ -1567,7 +1571,7 @@ static int32_t ConsoleCommandReplayStartRecord(InteractiveConsole& console, cons
 
     if (argv.size() < 1)
     {
-        console.WriteFormatLine("Parameters required <replay_name> [<max_ticks = 0xFFFFFFFF>]");
+        console.WriteFormatLine("Parameters required <replay_name> [<max_ticks = 0xFFFFFFFF>] [<keyframe_interval = 0>]");
         return 0;
     }
 
@@ -1588,8 +1592,15 @@ static int32_t ConsoleCommandReplayStartRecord(InteractiveConsole& console, cons
         maxTicks = atol(argv[1].c_str());
     }
 
+    // Keyframes allow the replay to be seeked and verified in segments
+    uint32_t keyframeInterval = 0;
+    if (argv.size() >= 3)
+    {
+        keyframeInterval = atol(argv[2].c_str());
+    }
+
     auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
-    if (replayManager->StartRecording(name, maxTicks))
+    if (replayManager->StartRecording(name, maxTicks, OpenRCT2::IReplayManager::RecordType::NORMAL, keyframeInterval))
     {
         OpenRCT2::ReplayRecordInfo info;
         replayManager->GetCurrentReplayInfo(info);
@@ -1670,10 +1681,14 @@ static int32_t ConsoleCommandReplayStart(InteractiveConsole& console, const argu
                              "  Date Recorded: %s\n"
                              "  Ticks: %u\n"
                              "  Commands: %u\n"
-                             "  Checksums: %u";
+                             "  Checksums: %u\n"
+                             "  Keyframes: %u";
 
-        console.WriteFormatLine(logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums);
-        Console::WriteLine(logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums);
+        auto numKeyframes = static_cast<uint32_t>(info.KeyframeTicks.size());
+        console.WriteFormatLine(
+            logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums, numKeyframes);
+        Console::WriteLine(
+            logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums, numKeyframes);
 
         return 1;
     }
@@ -1699,6 +1714,38 @@ static int32_t ConsoleCommandReplayStop(InteractiveConsole& console, const argum
     return 0;
 }
 
+static int32_t ConsoleCommandReplaySeek(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (NetworkGetMode() != NETWORK_MODE_NONE)
+    {
+        console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+        return 0;
+    }
+
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Parameters required <replay_tick>");
+        return 0;
+    }
+
+    auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (!replayManager->IsReplaying())
+    {
+        console.WriteFormatLine("Replay currently not playing");
+        return 0;
+    }
+
+    uint32_t replayTick = atol(argv[0].c_str());
+    if (replayManager->SeekPlayback(replayTick))
+    {
+        console.WriteFormatLine("Replay seeked to tick %u", replayTick);
+        return 1;
+    }
+
+    console.WriteFormatLine("Unable to seek to tick %u", replayTick);
+    return 0;
+}
+
 static int32_t ConsoleCommandReplayNormalise(InteractiveConsole& console, const arguments_t& argv)
 {
     if (NetworkGetMode() != NETWORK_MODE_NONE)
@@ -1921,6 +1968,88 @@ static int32_t ConsoleCommandProfilerStop(
     return 0;
 }
 
+static int32_t ConsoleCommandTraceStart(InteractiveConsole& console, const arguments_t& argv)
+{
+    double slowTickThresholdMs = 0;
+    if (argv.size() >= 1)
+    {
+        slowTickThresholdMs = atof(argv[0].c_str());
+    }
+
+    OpenRCT2::Profiling::Tracing::Start(slowTickThresholdMs);
+    if (slowTickThresholdMs > 0)
+        console.WriteFormatLine("Started tracing ticks slower than %.2f ms", slowTickThresholdMs);
+    else
+        console.WriteLine("Started tracing");
+    return 0;
+}
+
+static int32_t ConsoleCommandTraceExport(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (argv.size() < 1)
+    {
+        console.WriteLineError("Missing argument: <file path>");
+        return 1;
+    }
+
+    const auto& traceFilePath = argv[0];
+    if (!OpenRCT2::Profiling::Tracing::Export(traceFilePath))
+    {
+        console.WriteFormatLine("Unable to export trace to %s", traceFilePath.c_str());
+        return 1;
+    }
+
+    console.WriteFormatLine("Wrote trace file: \"%s\"", traceFilePath.c_str());
+    return 0;
+}
+
+static int32_t ConsoleCommandTraceStop(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (OpenRCT2::Profiling::Tracing::IsEnabled())
+        console.WriteLine("Stopped tracing");
+    OpenRCT2::Profiling::Tracing::Stop();
+
+    // Export if argument is provided.
+    if (argv.size() >= 1)
+    {
+        return ConsoleCommandTraceExport(console, argv);
+    }
+
+    return 0;
+}
+
+static int32_t ConsoleCommandPluginProfile(InteractiveConsole& console, const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    auto& hookEngine = OpenRCT2::GetContext()->GetScriptEngine().GetHookEngine();
+    if (!argv.empty() && argv[0] == "reset")
+    {
+        hookEngine.ResetStatistics();
+        console.WriteLine("Plugin hook statistics reset");
+        return 0;
+    }
+
+    console.WriteFormatLine(
+        "%-24s %-24s %10s %10s %10s %12s %8s", "Plugin", "Hook", "Calls", "Total ms", "Max ms", "Heap growth", "Over");
+    for (const auto& hookList : hookEngine.GetHookLists())
+    {
+        for (const auto& hook : hookList.Hooks)
+        {
+            const auto& statistics = hook.Statistics;
+            console.WriteFormatLine(
+                "%-24s %-24s %10" PRIu64 " %10.2f %10.2f %12" PRId64 " %8" PRIu64 "%s",
+                hook.Owner->GetMetadata().Name.c_str(), std::string(OpenRCT2::Scripting::GetHookName(hookList.Type)).c_str(),
+                statistics.CallCount, statistics.TotalTime, statistics.MaxTime, statistics.HeapGrowth,
+                statistics.OverBudgetCount, hook.Disabled ? " (disabled)" : "");
+        }
+    }
+    return 0;
+#else
+    console.WriteLineError("Plugins are not supported by this build.");
+    return 1;
+#endif
+}
+
 using console_command_func = int32_t (*)(InteractiveConsole& console, const arguments_t& argv);
 struct ConsoleCommand
 {
@@ -2019,10 +2148,12 @@ static constexpr const ConsoleCommand console_command_table[] = {
       "variables" },
     { "windows", ConsoleCommandWindows, "Lists all the windows that can be opened.", "windows" },
     { "replay_startrecord", ConsoleCommandReplayStartRecord, "Starts recording a new replay.",
-      "replay_startrecord <name> [max_ticks]" },
+      "replay_startrecord <name> [max_ticks] [keyframe_interval]" },
     { "replay_stoprecord", ConsoleCommandReplayStopRecord, "Stops recording a new replay.", "replay_stoprecord" },
     { "replay_start", ConsoleCommandReplayStart, "Starts a replay", "replay_start <name>" },
     { "replay_stop", ConsoleCommandReplayStop, "Stops the replay", "replay_stop" },
+    { "replay_seek", ConsoleCommandReplaySeek, "Seeks the replay to the given tick, using the nearest keyframe",
+      "replay_seek <tick>" },
     { "replay_normalise", ConsoleCommandReplayNormalise, "Normalises the replay to remove all gaps",
       "replay_normalise <input file> <output file>" },
     { "mp_desync", ConsoleCommandMpDesync, "Forces a multiplayer desync",
@@ -2032,6 +2163,13 @@ static constexpr const ConsoleCommand console_command_table[] = {
     { "profiler_stop", ConsoleCommandProfilerStop, "Stops the profiler.", "profiler_stop [<output file>]" },
     { "profiler_exportcsv", ConsoleCommandProfilerExportCSV, "Exports the current profiler data.",
       "profiler_exportcsv <output file>" },
+    { "trace_start", ConsoleCommandTraceStart,
+      "Starts recording a timeline of profiled functions, only keeping ticks slower than the given milliseconds.",
+      "trace_start [<slow tick threshold>]" },
+    { "trace_stop", ConsoleCommandTraceStop, "Stops recording the timeline.", "trace_stop [<output file>]" },
+    { "trace_export", ConsoleCommandTraceExport,
+      "Exports the timeline as Chrome trace JSON, or as a Perfetto trace for .pftrace files.", "trace_export <output file>" },
+    { "plugin_profile", ConsoleCommandPluginProfile, "Shows the time spent in each plugin hook.", "plugin_profile [reset]" },
 };
 
 static int32_t ConsoleCommandWindows(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
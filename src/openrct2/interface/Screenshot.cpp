@@ -284,17 +284,17 @@ static Viewport GetGiantViewport(int32_t rotation, ZoomLevel zoom)
         {
             // Map corners
             { 1, 1 },
-            { gMapSize.x - 2, gMapSize.y - 2 },
-            { 1, gMapSize.y - 2 },
-            { gMapSize.x - 2, 1 },
+            { GetMapSize().x - 2, GetMapSize().y - 2 },
+            { 1, GetMapSize().y - 2 },
+            { GetMapSize().x - 2, 1 },
         },
         {
             // Horizontal view clipping corners
             TileCoordsXY{ CoordsXY{ std::max(gClipSelectionA.x, 32), std::max(gClipSelectionA.y, 32) } },
-            TileCoordsXY{ CoordsXY{ std::min(gClipSelectionB.x, (gMapSize.x - 2) * 32),
-                                    std::min(gClipSelectionB.y, (gMapSize.y - 2) * 32) } },
-            TileCoordsXY{ CoordsXY{ std::max(gClipSelectionA.x, 32), std::min(gClipSelectionB.y, (gMapSize.y - 2) * 32) } },
-            TileCoordsXY{ CoordsXY{ std::min(gClipSelectionB.x, (gMapSize.x - 2) * 32), std::max(gClipSelectionA.y, 32) } },
+            TileCoordsXY{ CoordsXY{ std::min(gClipSelectionB.x, (GetMapSize().x - 2) * 32),
+                                    std::min(gClipSelectionB.y, (GetMapSize().y - 2) * 32) } },
+            TileCoordsXY{ CoordsXY{ std::max(gClipSelectionA.x, 32), std::min(gClipSelectionB.y, (GetMapSize().y - 2) * 32) } },
+            TileCoordsXY{ CoordsXY{ std::min(gClipSelectionB.x, (GetMapSize().x - 2) * 32), std::max(gClipSelectionA.y, 32) } },
         },
     };
 
@@ -646,7 +646,7 @@ int32_t CmdlineForScreenshot(const char** argv, int32_t argc, ScreenshotOptions*
                 customRotation = std::atoi(argv[7]) & 3;
             }
 
-            const auto& mapSize = gMapSize;
+            const auto& mapSize = GetMapSize();
             if (resolutionWidth == 0 || resolutionHeight == 0)
             {
                 resolutionWidth = (mapSize.x * COORDS_XY_STEP * 2) >> customZoom;
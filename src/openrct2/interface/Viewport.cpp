@@ -15,7 +15,7 @@
 #include "../OpenRCT2.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
-#include "../core/JobPool.h"
+#include "../core/Parallel.h"
 #include "../drawing/Drawing.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../entity/EntityList.h"
@@ -36,6 +36,7 @@
 #include "../util/Math.hpp"
 #include "../world/Climate.h"
 #include "../world/Map.h"
+#include "../world/World.h"
 #include "Colour.h"
 #include "Window.h"
 #include "Window_internal.h"
@@ -59,9 +60,9 @@ uint8_t gShowLandRightsRefCount;
 uint8_t gShowConstructionRightsRefCount;
 
 static std::list<Viewport> _viewports;
+static thread_local ViewportInvalidationList* _deferredInvalidations = nullptr;
 Viewport* g_music_tracking_viewport;
 
-static std::unique_ptr<JobPool> _paintJobs;
 static std::vector<PaintSession*> _paintColumns;
 
 ScreenCoordsXY gSavedView;
@@ -233,6 +234,12 @@ void ViewportRemove(Viewport* viewport)
 
 void ViewportsInvalidate(const ScreenRect& screenRect, ZoomLevel maxZoom)
 {
+    if (_deferredInvalidations != nullptr)
+    {
+        _deferredInvalidations->emplace_back(screenRect, maxZoom);
+        return;
+    }
+
     for (auto& vp : _viewports)
     {
         if (maxZoom == ZoomLevel{ -1 } || vp.zoom <= ZoomLevel{ maxZoom })
@@ -242,6 +249,19 @@ void ViewportsInvalidate(const ScreenRect& screenRect, ZoomLevel maxZoom)
     }
 }
 
+void ViewportsDeferInvalidations(ViewportInvalidationList* invalidations)
+{
+    _deferredInvalidations = invalidations;
+}
+
+void ViewportsApplyInvalidations(const ViewportInvalidationList& invalidations)
+{
+    for (const auto& [screenRect, maxZoom] : invalidations)
+    {
+        ViewportsInvalidate(screenRect, maxZoom);
+    }
+}
+
 /**
  *
  *  rct2: 0x00689174
@@ -1005,15 +1025,6 @@ void ViewportPaint(
     _paintColumns.clear();
 
     bool useMultithreading = gConfigGeneral.MultiThreading;
-    if (useMultithreading && _paintJobs == nullptr)
-    {
-        _paintJobs = std::make_unique<JobPool>();
-    }
-    else if (useMultithreading == false && _paintJobs != nullptr)
-    {
-        _paintJobs.reset();
-    }
-
     bool useParallelDrawing = false;
     if (useMultithreading && (dpi->DrawingEngine->GetFlags() & DEF_PARALLEL_DRAWING))
     {
@@ -1054,12 +1065,7 @@ void ViewportPaint(
         }
         dpi2.width = paintRight - dpi2.x;
 
-        if (useMultithreading)
-        {
-            _paintJobs->AddTask(
-                [session, recorded_sessions, index]() -> void { ViewportFillColumn(*session, recorded_sessions, index); });
-        }
-        else
+        if (!useMultithreading)
         {
             ViewportFillColumn(*session, recorded_sessions, index);
         }
@@ -1067,25 +1073,26 @@ void ViewportPaint(
 
     if (useMultithreading)
     {
-        _paintJobs->Join();
+        // Columns are filled from the world the viewport is painted from, e.g. a track design preview
+        auto& world = GetCurrentWorld();
+        Parallel::For(_paintColumns.size(), [recorded_sessions, &world](size_t columnIndex) {
+            WorldScope worldScope(world);
+            ViewportFillColumn(*_paintColumns[columnIndex], recorded_sessions, columnIndex);
+        });
     }
 
     // Paint columns.
-    for (auto* session : _paintColumns)
+    if (useParallelDrawing)
     {
-        if (useParallelDrawing)
-        {
-            _paintJobs->AddTask([session]() -> void { ViewportPaintColumn(*session); });
-        }
-        else
+        Parallel::For(_paintColumns.size(), [](size_t columnIndex) { ViewportPaintColumn(*_paintColumns[columnIndex]); });
+    }
+    else
+    {
+        for (auto* session : _paintColumns)
         {
             ViewportPaintColumn(*session);
         }
     }
-    if (useParallelDrawing)
-    {
-        _paintJobs->Join();
-    }
 
     // Release resources.
     for (auto* session : _paintColumns)
@@ -14,6 +14,7 @@
 
 #include <limits>
 #include <optional>
+#include <utility>
 #include <vector>
 
 struct PaintSession;
@@ -125,6 +126,15 @@ std::optional<ScreenCoordsXY> centre_2d_coordinates(const CoordsXYZ& loc, Viewpo
 void ViewportCreate(WindowBase* w, const ScreenCoordsXY& screenCoords, int32_t width, int32_t height, const Focus& focus);
 void ViewportRemove(Viewport* viewport);
 void ViewportsInvalidate(const ScreenRect& screenRect, ZoomLevel maxZoom = ZoomLevel{ -1 });
+
+using ViewportInvalidationList = std::vector<std::pair<ScreenRect, ZoomLevel>>;
+
+/**
+ * Collects the viewport invalidations made by the calling thread into the given list instead of applying them, used
+ * while the park is updated from worker threads. nullptr applies invalidations directly again.
+ */
+void ViewportsDeferInvalidations(ViewportInvalidationList* invalidations);
+void ViewportsApplyInvalidations(const ViewportInvalidationList& invalidations);
 void ViewportUpdatePosition(WindowBase* window);
 void ViewportUpdateFollowSprite(WindowBase* window);
 void ViewportUpdateSmartFollowEntity(WindowBase* window);
@@ -37,13 +37,14 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
 
-#define NETWORK_STREAM_VERSION "6"
+#define NETWORK_STREAM_VERSION "7"
 
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
@@ -56,6 +57,13 @@ static int32_t _pickup_peep_old_x = LOCATION_NULL;
 // with uint16_t and needs some spare room for other data in the packet.
 static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 
+// Game actions executed on the server are collected into a single batch packet, the batch is sent
+// once it would exceed this size or before any other packet so the order of actions is preserved.
+static constexpr uint32_t GameActionBatchMaxSize = 1024 * 60;
+
+// Batches of at least this size are compressed before sending.
+static constexpr uint32_t GameActionBatchCompressionThreshold = 1024;
+
 // If data is sent fast enough it would halt the entire server, process only a maximum amount.
 // This limit is per connection, the current value was determined by tests with fuzzing.
 static constexpr uint32_t MaxPacketsPerUpdate = 100;
@@ -122,6 +130,7 @@ NetworkBase::NetworkBase(OpenRCT2::IContext& context)
     client_command_handlers[NetworkCommand::Map] = &NetworkBase::Client_Handle_MAP;
     client_command_handlers[NetworkCommand::Chat] = &NetworkBase::Client_Handle_CHAT;
     client_command_handlers[NetworkCommand::GameAction] = &NetworkBase::Client_Handle_GAME_ACTION;
+    client_command_handlers[NetworkCommand::GameActionBatch] = &NetworkBase::Client_Handle_GAME_ACTION_BATCH;
     client_command_handlers[NetworkCommand::Tick] = &NetworkBase::Client_Handle_TICK;
     client_command_handlers[NetworkCommand::PlayerList] = &NetworkBase::Client_Handle_PLAYERLIST;
     client_command_handlers[NetworkCommand::PlayerInfo] = &NetworkBase::Client_Handle_PLAYERINFO;
@@ -196,6 +205,8 @@ void NetworkBase::Close()
         CloseConnection();
 
         client_connection_list.clear();
+        _gameActionBatch.Clear();
+        _gameActionBatchCount = 0;
         GameActions::ClearQueue();
         GameActions::ResumeQueue();
         player_list.clear();
@@ -501,6 +512,7 @@ void NetworkBase::Flush()
     }
     else
     {
+        ServerFlushGameActionBatch();
         for (auto& it : client_connection_list)
         {
             it->SendQueuedPackets();
@@ -510,6 +522,9 @@ void NetworkBase::Flush()
 
 void NetworkBase::UpdateServer()
 {
+    // Actions from the previous update must be queued before any connection changes state.
+    ServerFlushGameActionBatch();
+
     for (auto& connection : client_connection_list)
     {
         // This can be called multiple times before the connection is removed.
@@ -723,8 +738,15 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
     return formatted.c_str();
 }
 
-void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd) const
+void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd)
 {
+    if (packet.GetCommand() != NetworkCommand::GameActionBatch)
+    {
+        ServerFlushGameActionBatch();
+    }
+
+    // Encode once, all connections share the same buffer.
+    auto buffer = NetworkConnection::EncodePacket(packet);
     for (auto& client_connection : client_connection_list)
     {
         if (gameCmd)
@@ -738,7 +760,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        client_connection->QueuePacket(packet, front);
+        client_connection->QueuePacket(packet.GetCommand(), buffer, front);
     }
 }
 
@@ -1387,6 +1409,9 @@ void NetworkBase::ServerSendMap(NetworkConnection* connection)
         objects = objManager.GetPackableObjects();
     }
 
+    // Actions that have already been applied to the map must not be sent after it.
+    ServerFlushGameActionBatch();
+
     auto header = SaveForNetwork(objects);
     if (header.empty())
     {
@@ -1484,12 +1509,66 @@ void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
 
 void NetworkBase::ServerSendGameAction(const GameAction* action)
 {
-    NetworkPacket packet(NetworkCommand::GameAction);
-
     DataSerialiser stream(true);
     action->Serialise(stream);
 
-    packet << gCurrentTicks << action->GetType() << stream;
+    const auto& actionData = stream.GetStream();
+    const auto actionSize = static_cast<uint32_t>(actionData.GetLength());
+    const auto recordSize = sizeof(uint32_t) + sizeof(GameCommand) + sizeof(uint32_t) + actionSize;
+
+    if (_gameActionBatchCount > 0
+        && (_gameActionBatch.Data.size() + recordSize > GameActionBatchMaxSize
+            || _gameActionBatchCount == std::numeric_limits<uint16_t>::max()))
+    {
+        ServerFlushGameActionBatch();
+    }
+
+    if (recordSize > GameActionBatchMaxSize)
+    {
+        // Too large to be batched, send it on its own.
+        NetworkPacket packet(NetworkCommand::GameAction);
+        packet << gCurrentTicks << action->GetType() << stream;
+        SendPacketToClients(packet);
+        return;
+    }
+
+    _gameActionBatch << gCurrentTicks << action->GetType() << actionSize;
+    _gameActionBatch.Write(actionData.GetData(), actionSize);
+    _gameActionBatchCount++;
+}
+
+void NetworkBase::ServerFlushGameActionBatch()
+{
+    if (_gameActionBatchCount == 0)
+        return;
+
+    const auto& records = _gameActionBatch.Data;
+
+    uint8_t flags = 0;
+    std::vector<uint8_t> compressed;
+    if (records.size() >= GameActionBatchCompressionThreshold)
+    {
+        compressed = Gzip(records.data(), records.size());
+        if (compressed.size() < records.size())
+        {
+            flags |= NETWORK_GAME_ACTION_BATCH_FLAG_COMPRESSED;
+        }
+    }
+
+    NetworkPacket packet(NetworkCommand::GameActionBatch);
+    packet << flags << _gameActionBatchCount;
+    if (flags & NETWORK_GAME_ACTION_BATCH_FLAG_COMPRESSED)
+    {
+        packet << static_cast<uint32_t>(records.size());
+        packet.Write(compressed.data(), compressed.size());
+    }
+    else
+    {
+        packet.Write(records.data(), records.size());
+    }
+
+    _gameActionBatch.Clear();
+    _gameActionBatchCount = 0;
 
     SendPacketToClients(packet);
 }
@@ -2850,9 +2929,59 @@ void NetworkBase::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection&
     GameCommand actionType;
     packet >> tick >> actionType;
 
-    MemoryStream stream;
     const size_t size = packet.Header.Size - packet.BytesRead;
-    stream.WriteArray(packet.Read(size), size);
+    ClientEnqueueGameAction(tick, actionType, packet.Read(size), size);
+}
+
+void NetworkBase::Client_Handle_GAME_ACTION_BATCH([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint8_t flags;
+    uint16_t count;
+    packet >> flags >> count;
+
+    // Records are read through a packet so the same byte order is used as for the outer packet.
+    NetworkPacket records;
+    if (flags & NETWORK_GAME_ACTION_BATCH_FLAG_COMPRESSED)
+    {
+        uint32_t uncompressedSize;
+        packet >> uncompressedSize;
+
+        const size_t size = packet.Header.Size - packet.BytesRead;
+        records.Data = Ungzip(packet.Read(size), size);
+        if (records.Data.size() != uncompressedSize)
+        {
+            LOG_ERROR("Received corrupt game action batch, expected %u bytes got %zu", uncompressedSize, records.Data.size());
+            return;
+        }
+    }
+    else
+    {
+        const size_t size = packet.Header.Size - packet.BytesRead;
+        records.Write(packet.Read(size), size);
+    }
+    records.Header.Size = static_cast<uint16_t>(records.Data.size());
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        uint32_t tick;
+        GameCommand actionType;
+        uint32_t size;
+        records >> tick >> actionType >> size;
+
+        const uint8_t* data = records.Read(size);
+        if (data == nullptr)
+        {
+            LOG_ERROR("Received truncated game action batch, %u of %u actions read", i, count);
+            return;
+        }
+        ClientEnqueueGameAction(tick, actionType, data, size);
+    }
+}
+
+void NetworkBase::ClientEnqueueGameAction(uint32_t tick, GameCommand actionType, const uint8_t* data, size_t size)
+{
+    MemoryStream stream;
+    stream.WriteArray(data, size);
     stream.SetPosition(0);
 
     DataSerialiser ds(false, stream);
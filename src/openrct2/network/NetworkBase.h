@@ -88,6 +88,7 @@ public: // Server
     void ServerSendMap(NetworkConnection* connection = nullptr);
     void ServerSendChat(const char* text, const std::vector<uint8_t>& playerIds = {});
     void ServerSendGameAction(const GameAction* action);
+    void ServerFlushGameActionBatch();
     void ServerSendTick();
     void ServerSendPlayerInfo(int32_t playerId);
     void ServerSendPlayerList();
@@ -123,7 +124,7 @@ public: // Client
     void ProcessPlayerInfo();
     void ProcessDisconnectedClients();
     static const char* FormatChat(NetworkPlayer* fromplayer, const char* text);
-    void SendPacketToClients(const NetworkPacket& packet, bool front = false, bool gameCmd = false) const;
+    void SendPacketToClients(const NetworkPacket& packet, bool front = false, bool gameCmd = false);
     bool CheckSRAND(uint32_t tick, uint32_t srand0);
     bool CheckDesynchronizaton();
     void RequestStateSnapshot();
@@ -150,6 +151,8 @@ public: // Client
     void Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_GAME_ACTION_BATCH(NetworkConnection& connection, NetworkPacket& packet);
+    void ClientEnqueueGameAction(uint32_t tick, GameCommand actionType, const uint8_t* data, size_t size);
     void Client_Handle_TICK(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERINFO(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERLIST(NetworkConnection& connection, NetworkPacket& packet);
@@ -201,6 +204,8 @@ private: // Server Data
     std::string _serverLogPath;
     std::string _serverLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
     std::ofstream _server_log_fs;
+    NetworkPacket _gameActionBatch;
+    uint16_t _gameActionBatchCount = 0;
     uint16_t listening_port = 0;
     bool _playerListInvalidated = false;
 
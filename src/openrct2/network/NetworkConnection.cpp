@@ -86,7 +86,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
             // Received complete packet.
             _lastPacketTime = Platform::GetTicks();
 
-            RecordPacketStats(InboundPacket, false);
+            RecordPacketStats(InboundPacket.GetCommand(), InboundPacket.BytesTransferred, false);
 
             return NetworkReadPacket::Success;
         }
@@ -95,12 +95,9 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+std::shared_ptr<const std::vector<uint8_t>> NetworkConnection::EncodePacket(const NetworkPacket& packet)
 {
-    auto header = packet.Header;
-
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
+    PacketHeader header{ static_cast<uint16_t>(packet.Data.size()), packet.GetCommand() };
 
     // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
     // Previously the Id field was not part of the header rather part of the body.
@@ -108,8 +105,16 @@ bool NetworkConnection::SendPacket(NetworkPacket& packet)
     header.Size = Convert::HostToNetwork(header.Size);
     header.Id = ByteSwapBE(header.Id);
 
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
+    auto buffer = std::make_shared<std::vector<uint8_t>>();
+    buffer->reserve(sizeof(header) + packet.Data.size());
+    buffer->insert(buffer->end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+    buffer->insert(buffer->end(), packet.Data.begin(), packet.Data.end());
+    return buffer;
+}
+
+bool NetworkConnection::SendPacket(NetworkOutboundPacket& packet)
+{
+    const auto& buffer = *packet.Buffer;
 
     size_t bufferSize = buffer.size() - packet.BytesTransferred;
     size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
@@ -121,35 +126,45 @@ bool NetworkConnection::SendPacket(NetworkPacket& packet)
     bool sendComplete = packet.BytesTransferred == buffer.size();
     if (sendComplete)
     {
-        RecordPacketStats(packet, true);
+        RecordPacketStats(packet.Id, packet.BytesTransferred, true);
     }
     return sendComplete;
 }
 
-void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
+void NetworkConnection::QueuePacket(const NetworkPacket& packet, bool front)
 {
     if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
-        if (front)
+        QueuePacket(packet.GetCommand(), EncodePacket(packet), front);
+    }
+}
+
+void NetworkConnection::QueuePacket(NetworkCommand id, const std::shared_ptr<const std::vector<uint8_t>>& buffer, bool front)
+{
+    if (AuthStatus != NetworkAuth::Ok && NetworkPacket::CommandRequiresAuth(id))
+    {
+        return;
+    }
+
+    NetworkOutboundPacket packet{ id, buffer };
+    if (front)
+    {
+        // If the first packet was already partially sent add new packet to second position
+        if (!_outboundPackets.empty() && _outboundPackets.front().BytesTransferred > 0)
         {
-            // If the first packet was already partially sent add new packet to second position
-            if (!_outboundPackets.empty() && _outboundPackets.front().BytesTransferred > 0)
-            {
-                auto it = _outboundPackets.begin();
-                it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
-            }
-            else
-            {
-                _outboundPackets.push_front(std::move(packet));
-            }
+            auto it = _outboundPackets.begin();
+            it++; // Second position
+            _outboundPackets.insert(it, std::move(packet));
         }
         else
         {
-            _outboundPackets.push_back(std::move(packet));
+            _outboundPackets.push_front(std::move(packet));
         }
     }
+    else
+    {
+        _outboundPackets.push_back(std::move(packet));
+    }
 }
 
 void NetworkConnection::Disconnect() noexcept
@@ -203,14 +218,14 @@ void NetworkConnection::SetLastDisconnectReason(const StringId string_id, void*
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+void NetworkConnection::RecordPacketStats(NetworkCommand id, size_t packetSize, bool sending)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
     NetworkStatisticsGroup trafficGroup;
 
-    switch (packet.GetCommand())
+    switch (id)
     {
         case NetworkCommand::GameAction:
+        case NetworkCommand::GameActionBatch:
             trafficGroup = NetworkStatisticsGroup::Commands;
             break;
         case NetworkCommand::Map:
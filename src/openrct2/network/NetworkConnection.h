@@ -24,6 +24,15 @@
 class NetworkPlayer;
 struct ObjectRepositoryItem;
 
+// A packet that has been framed for sending, the buffer is shared between all connections the
+// packet has been queued on so broadcasting does not copy the payload per connection.
+struct NetworkOutboundPacket
+{
+    NetworkCommand Id = NetworkCommand::Invalid;
+    std::shared_ptr<const std::vector<uint8_t>> Buffer;
+    size_t BytesTransferred = 0;
+};
+
 class NetworkConnection final
 {
 public:
@@ -41,12 +50,10 @@ public:
     NetworkConnection() noexcept;
 
     NetworkReadPacket ReadPacket();
-    void QueuePacket(NetworkPacket&& packet, bool front = false);
-    void QueuePacket(const NetworkPacket& packet, bool front = false)
-    {
-        auto copy = packet;
-        return QueuePacket(std::move(copy), front);
-    }
+    void QueuePacket(const NetworkPacket& packet, bool front = false);
+    void QueuePacket(NetworkCommand id, const std::shared_ptr<const std::vector<uint8_t>>& buffer, bool front = false);
+
+    static std::shared_ptr<const std::vector<uint8_t>> EncodePacket(const NetworkPacket& packet);
 
     // This will not immediately disconnect the client. The disconnect
     // will happen post-tick.
@@ -62,12 +69,12 @@ public:
     void SetLastDisconnectReason(const StringId string_id, void* args = nullptr);
 
 private:
-    std::deque<NetworkPacket> _outboundPackets;
+    std::deque<NetworkOutboundPacket> _outboundPackets;
     uint32_t _lastPacketTime = 0;
     std::string _lastDisconnectReason;
 
-    void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    void RecordPacketStats(NetworkCommand id, size_t packetSize, bool sending);
+    bool SendPacket(NetworkOutboundPacket& packet);
 };
 
 #endif // DISABLE_NETWORK
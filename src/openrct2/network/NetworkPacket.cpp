@@ -44,7 +44,12 @@ void NetworkPacket::Clear() noexcept
 
 bool NetworkPacket::CommandRequiresAuth() const noexcept
 {
-    switch (GetCommand())
+    return CommandRequiresAuth(GetCommand());
+}
+
+bool NetworkPacket::CommandRequiresAuth(NetworkCommand id) noexcept
+{
+    switch (id)
     {
         case NetworkCommand::Ping:
         case NetworkCommand::Auth:
@@ -37,6 +37,7 @@ struct NetworkPacket final
 
     void Clear() noexcept;
     bool CommandRequiresAuth() const noexcept;
+    static bool CommandRequiresAuth(NetworkCommand id) noexcept;
 
     const uint8_t* Read(size_t size);
     std::string_view ReadString();
@@ -297,7 +297,7 @@ private:
             { "players", numPlayers },
         };
 
-        json_t mapSize = { { "x", gMapSize.x - 2 }, { "y", gMapSize.y - 2 } };
+        json_t mapSize = { { "x", GetMapSize().x - 2 }, { "y", GetMapSize().y - 2 } };
         json_t gameInfo = {
             { "mapSize", mapSize },         { "day", gDateMonthTicks },  { "month", gDateMonthsElapsed },
             { "guests", gNumGuestsInPark }, { "parkValue", gParkValue },
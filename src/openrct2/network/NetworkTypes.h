@@ -25,6 +25,11 @@ enum
     NETWORK_TICK_FLAG_CHECKSUMS = 1 << 0,
 };
 
+enum
+{
+    NETWORK_GAME_ACTION_BATCH_FLAG_COMPRESSED = 1 << 0,
+};
+
 enum
 {
     NETWORK_MODE_NONE,
@@ -83,6 +88,7 @@ enum class NetworkCommand : uint32_t
     GameState,
     Scripts,
     Heartbeat,
+    GameActionBatch,
     Max,
     Invalid = static_cast<uint32_t>(-1),
 };
@@ -62,7 +62,7 @@ void BannerObject::Load()
 {
     GetStringTable().Sort();
     _legacyType.name = LanguageAllocateObjectString(GetName());
-    _legacyType.image = GfxObjectAllocateImages(GetImageTable().GetImages(), GetImageTable().GetCount());
+    _legacyType.image = GfxObjectAllocateImages(GetImageTable());
 }
 
 void BannerObject::Unload()
@@ -30,7 +30,7 @@ void EntranceObject::Load()
 {
     GetStringTable().Sort();
     _legacyType.string_idx = LanguageAllocateObjectString(GetName());
-    _legacyType.image_id = GfxObjectAllocateImages(GetImageTable().GetImages(), GetImageTable().GetCount());
+    _legacyType.image_id = GfxObjectAllocateImages(GetImageTable());
 }
 
 void EntranceObject::Unload()
@@ -66,7 +66,7 @@ void FootpathItemObject::Load()
 {
     GetStringTable().Sort();
     _legacyType.name = LanguageAllocateObjectString(GetName());
-    _legacyType.image = GfxObjectAllocateImages(GetImageTable().GetImages(), GetImageTable().GetCount());
+    _legacyType.image = GfxObjectAllocateImages(GetImageTable());
 
     _legacyType.scenery_tab_id = OBJECT_ENTRY_INDEX_NULL;
 }
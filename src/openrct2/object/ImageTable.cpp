@@ -16,10 +16,12 @@
 #include "../core/FileScanner.h"
 #include "../core/IStream.hpp"
 #include "../core/Json.hpp"
+#include "../core/MemoryMappedFile.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/ImageImporter.h"
 #include "../sprites.h"
+#include "ImageTableCache.h"
 #include "Object.h"
 #include "ObjectFactory.h"
 
@@ -307,7 +309,7 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectIm
     {
         auto objectPath = FindLegacyObject(name);
         auto tmp = ObjectFactory::CreateObjectFromLegacyFile(
-            context->GetObjectRepository(), objectPath.c_str(), !gOpenRCT2NoGraphics);
+            context->GetObjectRepository(), objectPath.c_str(), context->GetImageLoadMode());
         auto inserted = _objDataCache.insert({ name, std::move(tmp) });
         obj = inserted.first->second.get();
     }
@@ -351,6 +353,129 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectIm
     return result;
 }
 
+uint32_t ImageTable::CountImages(IReadObjectContext* context, const std::string& s)
+{
+    // Must produce the same number of images as ParseImages, including the zoom images appended by ReadJson
+    if (String::StartsWith(s, "$CSG"))
+    {
+        auto range = ParseRange(s.substr(4));
+        auto count = static_cast<uint32_t>(range.size());
+        if (IsCsgLoaded())
+        {
+            for (auto i : range)
+            {
+                count += CountZoomImages(
+                    static_cast<uint32_t>(SPR_CSG_BEGIN + i),
+                    [](uint32_t idx) -> const G1Element* { return GfxGetG1ElementHeader(idx); });
+            }
+        }
+        return count;
+    }
+    if (String::StartsWith(s, "$G1"))
+    {
+        auto range = ParseRange(s.substr(3));
+        auto count = static_cast<uint32_t>(range.size());
+        for (auto i : range)
+        {
+            // Only the headers are loaded on headless instances, they are enough to follow the zoom images
+            count += CountZoomImages(
+                static_cast<uint32_t>(i), [](uint32_t idx) -> const G1Element* { return GfxGetG1ElementHeader(idx); });
+        }
+        return count;
+    }
+    if (String::StartsWith(s, "$RCT2:OBJDATA/"))
+    {
+        auto name = s.substr(14);
+        auto rangeStart = name.find('[');
+        if (rangeStart == std::string::npos)
+        {
+            return 0;
+        }
+        auto range = ParseRange(name.substr(rangeStart));
+        name = name.substr(0, rangeStart);
+        return CountObjectImages(context, name, range);
+    }
+    if (String::StartsWith(s, "$LGX:"))
+    {
+        auto name = s.substr(5);
+        auto rangeStart = name.find('[');
+        if (rangeStart != std::string::npos)
+        {
+            return static_cast<uint32_t>(ParseRange(name.substr(rangeStart)).size());
+        }
+
+        // Only the header of the archive is needed to know how many images it contains
+        auto gxRaw = context->GetData(name);
+        RCTG1Header header;
+        if (gxRaw.size() >= sizeof(header))
+        {
+            std::memcpy(&header, gxRaw.data(), sizeof(header));
+            auto gxSize = sizeof(header) + (static_cast<uint64_t>(header.num_entries) * 16) + header.total_size;
+            if (gxRaw.size() >= gxSize)
+            {
+                return header.num_entries;
+            }
+        }
+        return 0;
+    }
+    return 1;
+}
+
+uint32_t ImageTable::CountZoomImages(uint32_t idx, std::function<const G1Element*(uint32_t)> getter)
+{
+    uint32_t count = 0;
+    auto g1 = getter(idx);
+    while (g1 != nullptr && (g1->flags & G1_FLAG_HAS_ZOOM_SPRITE) && g1->zoomed_offset != 0)
+    {
+        idx = static_cast<uint32_t>(idx - g1->zoomed_offset);
+        g1 = getter(idx);
+        if (g1 != nullptr)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+uint32_t ImageTable::CountObjectImages(
+    IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range)
+{
+    Object* obj;
+
+    auto cached = _objDataCache.find(name);
+    if (cached != _objDataCache.end())
+    {
+        obj = cached->second.get();
+    }
+    else
+    {
+        // The image headers are enough to follow the zoom images
+        auto objectPath = FindLegacyObject(name);
+        auto tmp = ObjectFactory::CreateObjectFromLegacyFile(
+            context->GetObjectRepository(), objectPath.c_str(), ObjectImageLoadMode::Deferred);
+        auto inserted = _objDataCache.insert({ name, std::move(tmp) });
+        obj = inserted.first->second.get();
+    }
+
+    auto count = static_cast<uint32_t>(range.size());
+    if (obj != nullptr)
+    {
+        auto& imgTable = static_cast<const Object*>(obj)->GetImageTable();
+        auto numImages = imgTable.GetCount();
+        auto images = imgTable.GetImages();
+        for (auto i : range)
+        {
+            if (i >= 0 && static_cast<uint32_t>(i) < numImages)
+            {
+                count += CountZoomImages(static_cast<uint32_t>(i), [images, numImages](uint32_t idx) -> const G1Element* {
+                    return idx < numImages ? &images[idx] : nullptr;
+                });
+            }
+        }
+    }
+    return count;
+}
+
 std::vector<int32_t> ImageTable::ParseRange(std::string s)
 {
     // Currently only supports [###] or [###..###]
@@ -427,23 +552,57 @@ std::string ImageTable::FindLegacyObject(const std::string& name)
 }
 
 ImageTable::~ImageTable()
+{
+    FreeImageData();
+}
+
+bool ImageTable::IsMappedImageData(const uint8_t* data) const
+{
+    if (_mappedFile == nullptr)
+    {
+        return false;
+    }
+    const auto* begin = _mappedFile->GetData();
+    return data >= begin && data < begin + _mappedFile->GetSize();
+}
+
+void ImageTable::FreeImageData()
 {
     if (_data == nullptr)
     {
         for (auto& entry : _entries)
         {
-            delete[] entry.offset;
+            if (!IsMappedImageData(entry.offset))
+            {
+                delete[] entry.offset;
+            }
         }
     }
+    _data = nullptr;
+    _mappedFile = nullptr;
 }
 
-void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
+static G1Element ReadElementHeader(OpenRCT2::IStream* stream, uint8_t* imageData)
 {
-    if (gOpenRCT2NoGraphics)
+    G1Element g1Element{};
+
+    auto imageDataOffset = stream->ReadValue<uint32_t>();
+    if (imageData != nullptr)
     {
-        return;
+        g1Element.offset = imageData + imageDataOffset;
     }
 
+    g1Element.width = stream->ReadValue<int16_t>();
+    g1Element.height = stream->ReadValue<int16_t>();
+    g1Element.x_offset = stream->ReadValue<int16_t>();
+    g1Element.y_offset = stream->ReadValue<int16_t>();
+    g1Element.flags = stream->ReadValue<uint16_t>();
+    g1Element.zoomed_offset = stream->ReadValue<uint16_t>();
+    return g1Element;
+}
+
+void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
+{
     try
     {
         uint32_t numImages = stream->ReadValue<uint32_t>();
@@ -457,6 +616,16 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
             imageDataSize = static_cast<uint32_t>(remainingBytes);
         }
 
+        if (context->GetImageLoadMode() != ObjectImageLoadMode::Full || gOpenRCT2NoGraphics)
+        {
+            // Only the headers are needed to size the table, the image data is read once the images are used
+            for (uint32_t i = 0; i < numImages; i++)
+            {
+                _entries.push_back(ReadElementHeader(stream, nullptr));
+            }
+            return;
+        }
+
         auto dataSize = static_cast<size_t>(imageDataSize);
         auto data = std::make_unique<uint8_t[]>(dataSize);
         if (data == nullptr)
@@ -466,23 +635,10 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
         }
 
         // Read g1 element headers
-        uintptr_t imageDataBase = reinterpret_cast<uintptr_t>(data.get());
         std::vector<G1Element> newEntries;
         for (uint32_t i = 0; i < numImages; i++)
         {
-            G1Element g1Element{};
-
-            uintptr_t imageDataOffset = static_cast<uintptr_t>(stream->ReadValue<uint32_t>());
-            g1Element.offset = reinterpret_cast<uint8_t*>(imageDataBase + imageDataOffset);
-
-            g1Element.width = stream->ReadValue<int16_t>();
-            g1Element.height = stream->ReadValue<int16_t>();
-            g1Element.x_offset = stream->ReadValue<int16_t>();
-            g1Element.y_offset = stream->ReadValue<int16_t>();
-            g1Element.flags = stream->ReadValue<uint16_t>();
-            g1Element.zoomed_offset = stream->ReadValue<uint16_t>();
-
-            newEntries.push_back(std::move(g1Element));
+            newEntries.push_back(ReadElementHeader(stream, data.get()));
         }
 
         // Read g1 element data
@@ -531,73 +687,183 @@ std::vector<std::pair<std::string, Image>> ImageTable::GetImageSources(IReadObje
     return result;
 }
 
-bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
+std::string ImageTable::GetCacheKey(IReadObjectContext* context, json_t& jsonImages)
 {
-    Guard::Assert(root.is_object(), "ImageTable::ReadJson expects parameter root to be object");
-
-    bool usesFallbackSprites = false;
-
-    if (context->ShouldLoadImages())
+    // The key covers the image definitions and the content of every file the images are decoded from
+    std::string key = jsonImages.dump();
+    std::vector<std::string> hashedSources;
+    try
     {
-        // First gather all the required images from inspecting the JSON
-        std::vector<std::unique_ptr<RequiredImage>> allImages;
-        auto jsonImages = root["images"];
-        if (!IsCsgLoaded() && root.contains("noCsgImages"))
-        {
-            jsonImages = root["noCsgImages"];
-            usesFallbackSprites = true;
-        }
-
-        auto imageSources = GetImageSources(context, jsonImages);
-
         for (auto& jsonImage : jsonImages)
         {
+            std::string source;
             if (jsonImage.is_string())
             {
-                auto strImage = jsonImage.get<std::string>();
-                auto images = ParseImages(context, strImage);
-                allImages.insert(
-                    allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
+                source = jsonImage.get<std::string>();
+                if (source.empty())
+                {
+                    continue;
+                }
+                if (String::StartsWith(source, "$CSG") || String::StartsWith(source, "$G1"))
+                {
+                    // Copied from the loaded graphics, these are not worth caching
+                    return {};
+                }
+                if (String::StartsWith(source, "$RCT2:OBJDATA/") || String::StartsWith(source, "$LGX:"))
+                {
+                    source = source.substr(0, source.find('['));
+                }
             }
             else if (jsonImage.is_object())
             {
-                auto images = ParseImages(context, imageSources, jsonImage);
-                allImages.insert(
-                    allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
+                source = Json::GetString(jsonImage["path"]);
+            }
+
+            if (std::find(hashedSources.begin(), hashedSources.end(), source) != hashedSources.end())
+            {
+                continue;
+            }
+
+            std::vector<uint8_t> data;
+            if (String::StartsWith(source, "$RCT2:OBJDATA/"))
+            {
+                auto objectPath = FindLegacyObject(source.substr(14));
+                if (File::Exists(objectPath))
+                {
+                    data = File::ReadAllBytes(objectPath);
+                }
+            }
+            else if (String::StartsWith(source, "$LGX:"))
+            {
+                data = context->GetData(source.substr(5));
+            }
+            else
+            {
+                data = context->GetData(source);
             }
+            key += '\n' + source + ':' + ImageTableCache::GetContentHash(data.data(), data.size());
+            hashedSources.push_back(std::move(source));
         }
+    }
+    catch (const std::exception&)
+    {
+        return {};
+    }
+    return key;
+}
+
+bool ImageTable::ReadCachedImages(const std::string& key)
+{
+    auto cached = ImageTableCache::Read(key);
+    if (!cached.has_value())
+    {
+        return false;
+    }
+    _mappedFile = std::move(cached->File);
+    _entries = std::move(cached->Entries);
+    return true;
+}
 
-        // Now add all the images to the image table
-        auto imagesStartIndex = GetCount();
-        for (const auto& img : allImages)
+void ImageTable::ReadJsonImages(IReadObjectContext* context, json_t& jsonImages)
+{
+    // First gather all the required images from inspecting the JSON
+    std::vector<std::unique_ptr<RequiredImage>> allImages;
+    auto imageSources = GetImageSources(context, jsonImages);
+
+    for (auto& jsonImage : jsonImages)
+    {
+        if (jsonImage.is_string())
         {
-            const auto& g1 = img->g1;
-            AddImage(&g1);
+            auto strImage = jsonImage.get<std::string>();
+            auto images = ParseImages(context, strImage);
+            allImages.insert(allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
         }
+        else if (jsonImage.is_object())
+        {
+            auto images = ParseImages(context, imageSources, jsonImage);
+            allImages.insert(allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
+        }
+    }
 
-        // Add all the zoom images at the very end of the image table.
-        // This way it should not affect the offsets used within the object logic.
-        for (size_t j = 0; j < allImages.size(); j++)
+    // Now add all the images to the image table
+    auto imagesStartIndex = GetCount();
+    for (const auto& img : allImages)
+    {
+        const auto& g1 = img->g1;
+        AddImage(&g1);
+    }
+
+    // Add all the zoom images at the very end of the image table.
+    // This way it should not affect the offsets used within the object logic.
+    for (size_t j = 0; j < allImages.size(); j++)
+    {
+        const auto tableIndex = imagesStartIndex + j;
+        const auto* img = allImages[j].get();
+        if (img->next_zoom != nullptr)
         {
-            const auto tableIndex = imagesStartIndex + j;
-            const auto* img = allImages[j].get();
-            if (img->next_zoom != nullptr)
+            img = img->next_zoom.get();
+
+            // Set old image zoom offset to zoom image which we are about to add
+            auto g1a = const_cast<G1Element*>(&GetImages()[tableIndex]);
+            g1a->zoomed_offset = static_cast<int32_t>(tableIndex) - static_cast<int32_t>(GetCount());
+
+            while (img != nullptr)
             {
+                auto g1b = img->g1;
+                if (img->next_zoom != nullptr)
+                {
+                    g1b.zoomed_offset = -1;
+                }
+                AddImage(&g1b);
                 img = img->next_zoom.get();
+            }
+        }
+    }
+}
 
-                // Set old image zoom offset to zoom image which we are about to add
-                auto g1a = const_cast<G1Element*>(&GetImages()[tableIndex]);
-                g1a->zoomed_offset = static_cast<int32_t>(tableIndex) - static_cast<int32_t>(GetCount());
+bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
+{
+    Guard::Assert(root.is_object(), "ImageTable::ReadJson expects parameter root to be object");
+
+    bool usesFallbackSprites = false;
 
-                while (img != nullptr)
+    auto imageLoadMode = context->GetImageLoadMode();
+    if (imageLoadMode != ObjectImageLoadMode::None)
+    {
+        auto jsonImages = root["images"];
+        if (!IsCsgLoaded() && root.contains("noCsgImages"))
+        {
+            jsonImages = root["noCsgImages"];
+            usesFallbackSprites = true;
+        }
+
+        if (imageLoadMode == ObjectImageLoadMode::Deferred)
+        {
+            // Only size the table, the images are read once they are used
+            uint32_t numImages = 0;
+            for (auto& jsonImage : jsonImages)
+            {
+                if (jsonImage.is_string())
                 {
-                    auto g1b = img->g1;
-                    if (img->next_zoom != nullptr)
-                    {
-                        g1b.zoomed_offset = -1;
-                    }
-                    AddImage(&g1b);
-                    img = img->next_zoom.get();
+                    numImages += CountImages(context, jsonImage.get<std::string>());
+                }
+                else if (jsonImage.is_object())
+                {
+                    numImages++;
+                }
+            }
+            _entries.resize(_entries.size() + numImages);
+        }
+        else
+        {
+            // Decoded images are shared through the cache when they are decoded from files
+            auto cacheKey = _entries.empty() ? GetCacheKey(context, jsonImages) : std::string();
+            if (cacheKey.empty() || !ReadCachedImages(cacheKey))
+            {
+                ReadJsonImages(context, jsonImages);
+                if (!cacheKey.empty())
+                {
+                    ImageTableCache::Write(cacheKey, _entries.data(), _entries.size());
                 }
             }
         }
@@ -623,3 +889,78 @@ void ImageTable::AddImage(const G1Element* g1)
     }
     _entries.push_back(std::move(newg1));
 }
+
+void ImageTable::SetDeferredLoader(std::function<std::unique_ptr<Object>()> loader)
+{
+    _deferredLoader = std::move(loader);
+}
+
+const G1Element* ImageTable::LoadImages()
+{
+    auto object = _deferredLoader != nullptr ? _deferredLoader() : nullptr;
+    if (object == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (object->GetNumImages() != GetCount())
+    {
+        std::string identifier(object->GetIdentifier());
+        LOG_WARNING("Object %s has %u images but %u were reserved", identifier.c_str(), object->GetNumImages(), GetCount());
+    }
+
+    object->MoveImagesTo(*this);
+    return _entries.data();
+}
+
+void ImageTable::TakeImages(ImageTable& source)
+{
+    auto numReserved = _entries.size();
+
+    FreeImageData();
+    _data = std::move(source._data);
+    _mappedFile = std::move(source._mappedFile);
+    _entries = std::move(source._entries);
+    source._entries.clear();
+
+    // The table must keep the reserved size as the image ids have already been allocated
+    if (_data == nullptr)
+    {
+        for (size_t i = numReserved; i < _entries.size(); i++)
+        {
+            if (!IsMappedImageData(_entries[i].offset))
+            {
+                delete[] _entries[i].offset;
+            }
+        }
+    }
+    _entries.resize(numReserved);
+
+    _loadedDataSize = 0;
+    for (const auto& entry : _entries)
+    {
+        _loadedDataSize += G1CalculateDataSize(&entry);
+    }
+}
+
+void ImageTable::UnloadImages()
+{
+    auto numEntries = _entries.size();
+    FreeImageData();
+    _entries.assign(numEntries, G1Element{});
+    _loadedDataSize = 0;
+}
+
+size_t ImageTable::GetImageDataSize() const
+{
+    return _loadedDataSize;
+}
+
+uint32_t GfxObjectAllocateImages(ImageTable& imageTable)
+{
+    if (imageTable.IsDeferred() || gOpenRCT2NoGraphics)
+    {
+        return GfxObjectAllocateDeferredImages(imageTable, imageTable.GetCount());
+    }
+    return GfxObjectAllocateImages(imageTable.GetImages(), imageTable.GetCount());
+}
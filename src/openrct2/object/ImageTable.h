@@ -12,22 +12,30 @@
 #include "../common.h"
 #include "../core/JsonFwd.hpp"
 #include "../drawing/Drawing.h"
+#include "../drawing/Image.h"
 
+#include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 struct Image;
 struct IReadObjectContext;
+class Object;
 namespace OpenRCT2
 {
     struct IStream;
-}
+    class MemoryMappedFile;
+} // namespace OpenRCT2
 
-class ImageTable
+class ImageTable final : public IDeferredImageSource
 {
 private:
     std::unique_ptr<uint8_t[]> _data;
     std::vector<G1Element> _entries;
+    std::function<std::unique_ptr<Object>()> _deferredLoader;
+    size_t _loadedDataSize{};
+    std::shared_ptr<OpenRCT2::MemoryMappedFile> _mappedFile;
 
     /**
      * Container for a G1 image, additional information and RAII. Used by ReadJson
@@ -47,6 +55,15 @@ private:
     [[nodiscard]] static std::string FindLegacyObject(const std::string& name);
     [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> LoadImageArchiveImages(
         IReadObjectContext* context, const std::string& path, const std::vector<int32_t>& range = {});
+    [[nodiscard]] static uint32_t CountImages(IReadObjectContext* context, const std::string& s);
+    [[nodiscard]] static uint32_t CountZoomImages(uint32_t idx, std::function<const G1Element*(uint32_t)> getter);
+    [[nodiscard]] static uint32_t CountObjectImages(
+        IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range);
+    [[nodiscard]] static std::string GetCacheKey(IReadObjectContext* context, json_t& jsonImages);
+    bool ReadCachedImages(const std::string& key);
+    void ReadJsonImages(IReadObjectContext* context, json_t& jsonImages);
+    bool IsMappedImageData(const uint8_t* data) const;
+    void FreeImageData();
 
 public:
     ImageTable() = default;
@@ -68,4 +85,28 @@ public:
         return static_cast<uint32_t>(_entries.size());
     }
     void AddImage(const G1Element* g1);
+
+    /**
+     * Marks the entries of the table as placeholders, the image data is loaded by reading the object again with the
+     * given loader once the images are first used.
+     */
+    void SetDeferredLoader(std::function<std::unique_ptr<Object>()> loader);
+    bool IsDeferred() const
+    {
+        return _deferredLoader != nullptr;
+    }
+
+    /**
+     * Takes the images of source, keeping the number of entries of this table.
+     */
+    void TakeImages(ImageTable& source);
+
+    const G1Element* LoadImages() override;
+    void UnloadImages() override;
+    size_t GetImageDataSize() const override;
 };
+
+/**
+ * Allocates image ids for the image table, deferred image tables are only loaded once they are used.
+ */
+uint32_t GfxObjectAllocateImages(ImageTable& imageTable);
@@ -0,0 +1,298 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ImageTableCache.h"
+
+#include "../Context.h"
+#include "../Diagnostic.h"
+#include "../PlatformEnvironment.h"
+#include "../core/Crypt.h"
+#include "../core/File.h"
+#include "../core/FileStream.h"
+#include "../core/FileSystem.hpp"
+#include "../core/MemoryMappedFile.h"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+
+namespace ImageTableCache
+{
+    constexpr uint32_t MAGIC_NUMBER = 0x43544749; // IGTC
+    // Increment when the file layout or the way images are decoded changes
+    constexpr uint32_t VERSION = 1;
+    constexpr uint64_t NO_DATA = UINT64_MAX;
+    // Least recently used entries are removed once the cache grows over this size
+    constexpr uint64_t MAX_CACHE_SIZE = 1024ULL * 1024 * 1024;
+    // Temporary files this old were left behind by a process that stopped while writing
+    constexpr auto STALE_TEMP_FILE_AGE = std::chrono::hours(24);
+
+    struct CacheHeader
+    {
+        uint32_t MagicNumber = MAGIC_NUMBER;
+        uint32_t Version = VERSION;
+        uint32_t KeyLength = 0;
+        uint32_t NumImages = 0;
+        uint64_t DataSize = 0;
+    };
+
+    // One record per image, followed by the key and then by the image data
+    struct CacheRecord
+    {
+        uint64_t DataOffset = NO_DATA;
+        uint64_t DataLength = 0;
+        int32_t ZoomedOffset = 0;
+        int16_t Width = 0;
+        int16_t Height = 0;
+        int16_t XOffset = 0;
+        int16_t YOffset = 0;
+        uint16_t Flags = 0;
+        uint16_t Reserved = 0;
+    };
+    static_assert(sizeof(CacheRecord) == 32);
+
+    static std::string ToHex(const uint8_t* data, size_t dataLen)
+    {
+        std::string result;
+        result.reserve(dataLen * 2);
+        for (size_t i = 0; i < dataLen; i++)
+        {
+            result += String::StdFormat("%02x", data[i]);
+        }
+        return result;
+    }
+
+    struct CacheFile
+    {
+        fs::path Path;
+        uint64_t Size{};
+        fs::file_time_type LastUsed;
+    };
+
+    static void Prune(const u8string& directory)
+    {
+        std::vector<CacheFile> files;
+        uint64_t totalSize = 0;
+        try
+        {
+            const auto now = fs::file_time_type::clock::now();
+            std::error_code ec;
+            for (const auto& entry : fs::directory_iterator(fs::u8path(directory), ec))
+            {
+                auto lastWriteTime = entry.last_write_time(ec);
+                if (ec || !entry.is_regular_file(ec))
+                {
+                    continue;
+                }
+                if (entry.path().extension() == ".tmp")
+                {
+                    if (now - lastWriteTime > STALE_TEMP_FILE_AGE)
+                    {
+                        fs::remove(entry.path(), ec);
+                    }
+                    continue;
+                }
+
+                auto size = entry.file_size(ec);
+                if (!ec)
+                {
+                    files.push_back({ entry.path(), size, lastWriteTime });
+                    totalSize += size;
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to prune image table cache '%s': %s", directory.c_str(), e.what());
+            return;
+        }
+
+        if (totalSize <= MAX_CACHE_SIZE)
+        {
+            return;
+        }
+        std::sort(
+            files.begin(), files.end(), [](const CacheFile& a, const CacheFile& b) { return a.LastUsed < b.LastUsed; });
+        for (const auto& file : files)
+        {
+            if (totalSize <= MAX_CACHE_SIZE)
+            {
+                break;
+            }
+
+            // Entries mapped by another process may not be removable, they are tried again next time
+            std::error_code ec;
+            if (fs::remove(file.Path, ec))
+            {
+                totalSize -= file.Size;
+            }
+        }
+    }
+
+    static u8string GetCachePath(std::string_view key)
+    {
+        auto env = GetContext()->GetPlatformEnvironment();
+        auto directory = env->GetDirectoryPath(DIRBASE::CACHE, DIRID::OBJECT_CACHE);
+
+        // Before this process maps any of its entries
+        static std::once_flag pruneFlag;
+        std::call_once(pruneFlag, [&directory]() { Prune(directory); });
+
+        return Path::Combine(directory, GetContentHash(key.data(), key.size()) + u8".dat");
+    }
+
+    std::string GetContentHash(const void* data, size_t dataLen)
+    {
+        auto hash = Crypt::FNV1a(data, dataLen);
+        return ToHex(hash.data(), hash.size());
+    }
+
+    std::optional<CachedImages> Read(std::string_view key)
+    {
+        auto path = GetCachePath(key);
+        if (!File::Exists(path))
+        {
+            return std::nullopt;
+        }
+
+        try
+        {
+            // The modification time tells when the entry was last used, see Prune
+            std::error_code ec;
+            fs::last_write_time(fs::u8path(path), fs::file_time_type::clock::now(), ec);
+
+            auto file = std::make_shared<MemoryMappedFile>(path);
+            const auto* fileData = file->GetData();
+            const auto fileSize = file->GetSize();
+
+            CacheHeader header;
+            if (fileSize < sizeof(header))
+            {
+                return std::nullopt;
+            }
+            std::memcpy(&header, fileData, sizeof(header));
+
+            const uint64_t recordsSize = uint64_t{ header.NumImages } * sizeof(CacheRecord);
+            const uint64_t expectedSize = sizeof(header) + recordsSize + header.KeyLength + header.DataSize;
+            if (header.MagicNumber != MAGIC_NUMBER || header.Version != VERSION || header.KeyLength != key.size()
+                || expectedSize != fileSize)
+            {
+                return std::nullopt;
+            }
+
+            // Different keys can share a file name, only use the images if the full key matches
+            const auto* keyData = fileData + sizeof(header) + recordsSize;
+            if (std::memcmp(keyData, key.data(), key.size()) != 0)
+            {
+                return std::nullopt;
+            }
+
+            const auto* imageData = keyData + header.KeyLength;
+            CachedImages result;
+            result.Entries.reserve(header.NumImages);
+            for (uint32_t i = 0; i < header.NumImages; i++)
+            {
+                CacheRecord record;
+                std::memcpy(&record, fileData + sizeof(header) + (i * sizeof(CacheRecord)), sizeof(record));
+
+                G1Element g1;
+                if (record.DataOffset != NO_DATA)
+                {
+                    if (record.DataOffset > header.DataSize || record.DataLength > header.DataSize - record.DataOffset)
+                    {
+                        return std::nullopt;
+                    }
+                    // The mapping is read-only, image data is never written to after it has been loaded
+                    g1.offset = const_cast<uint8_t*>(imageData + record.DataOffset);
+                }
+                g1.width = record.Width;
+                g1.height = record.Height;
+                g1.x_offset = record.XOffset;
+                g1.y_offset = record.YOffset;
+                g1.flags = record.Flags;
+                g1.zoomed_offset = record.ZoomedOffset;
+                result.Entries.push_back(g1);
+            }
+            result.File = std::move(file);
+            return result;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to read image table cache '%s': %s", path.c_str(), e.what());
+            return std::nullopt;
+        }
+    }
+
+    void Write(std::string_view key, const G1Element* entries, size_t numEntries)
+    {
+        auto path = GetCachePath(key);
+        auto tempPath = path + u8"." + std::to_string(std::random_device{}()) + u8".tmp";
+        try
+        {
+            CacheHeader header;
+            header.KeyLength = static_cast<uint32_t>(key.size());
+            header.NumImages = static_cast<uint32_t>(numEntries);
+
+            std::vector<CacheRecord> records;
+            records.reserve(numEntries);
+            for (size_t i = 0; i < numEntries; i++)
+            {
+                const auto& g1 = entries[i];
+
+                CacheRecord record;
+                if (g1.offset != nullptr)
+                {
+                    record.DataOffset = header.DataSize;
+                    record.DataLength = G1CalculateDataSize(&g1);
+                    header.DataSize += record.DataLength;
+                }
+                record.Width = g1.width;
+                record.Height = g1.height;
+                record.XOffset = g1.x_offset;
+                record.YOffset = g1.y_offset;
+                record.Flags = g1.flags;
+                record.ZoomedOffset = g1.zoomed_offset;
+                records.push_back(record);
+            }
+
+            Path::CreateDirectory(Path::GetDirectory(path));
+            {
+                auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+                fs.WriteValue(header);
+                fs.Write(records.data(), records.size() * sizeof(CacheRecord));
+                fs.Write(key.data(), key.size());
+                for (size_t i = 0; i < numEntries; i++)
+                {
+                    if (records[i].DataOffset != NO_DATA)
+                    {
+                        fs.Write(entries[i].offset, static_cast<size_t>(records[i].DataLength));
+                    }
+                }
+            }
+
+            // Another process may have written the same entry in the meantime, either copy is valid
+            if (!File::Move(tempPath, path))
+            {
+                File::Delete(tempPath);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to write image table cache '%s': %s", path.c_str(), e.what());
+            File::Delete(tempPath);
+        }
+    }
+} // namespace ImageTableCache
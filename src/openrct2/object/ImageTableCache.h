@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../drawing/Drawing.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace OpenRCT2
+{
+    class MemoryMappedFile;
+}
+
+/**
+ * An on-disk cache of decoded image tables. Entries are keyed by the content of everything the images were decoded
+ * from and are memory mapped read-only when loaded, so processes loading the same objects share the image data. The
+ * first time a process uses the cache, the least recently used entries are removed if the cache has grown over 1 GiB.
+ */
+namespace ImageTableCache
+{
+    struct CachedImages
+    {
+        std::shared_ptr<OpenRCT2::MemoryMappedFile> File;
+        std::vector<G1Element> Entries;
+    };
+
+    /**
+     * Returns a short digest of the given data, used to identify the files an image table was decoded from.
+     */
+    [[nodiscard]] std::string GetContentHash(const void* data, size_t dataLen);
+
+    /**
+     * Maps the images cached for the given key, the entries point into the mapped file.
+     */
+    [[nodiscard]] std::optional<CachedImages> Read(std::string_view key);
+
+    /**
+     * Stores the decoded images under the given key. The file is written under a temporary name and renamed once
+     * complete, so other processes never map a partially written entry.
+     */
+    void Write(std::string_view key, const G1Element* entries, size_t numEntries);
+} // namespace ImageTableCache
@@ -114,7 +114,7 @@ void LargeSceneryObject::Load()
 {
     GetStringTable().Sort();
     _legacyType.name = LanguageAllocateObjectString(GetName());
-    _baseImageId = GfxObjectAllocateImages(GetImageTable().GetImages(), GetImageTable().GetCount());
+    _baseImageId = GfxObjectAllocateImages(GetImageTable());
     _legacyType.image = _baseImageId;
 
     _legacyType.tiles = _tiles.data();
@@ -74,7 +74,7 @@ void MusicObject::Load()
     }
 
     _hasPreview = !!GetImageTable().GetCount();
-    _previewImageId = GfxObjectAllocateImages(GetImageTable().GetImages(), GetImageTable().GetCount());
+    _previewImageId = GfxObjectAllocateImages(GetImageTable());
 }
 
 void MusicObject::Unload()
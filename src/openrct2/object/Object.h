@@ -18,6 +18,7 @@
 #include "ObjectTypes.h"
 #include "StringTable.h"
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string_view>
@@ -163,13 +164,20 @@ enum class ObjectError : uint32_t
     UnexpectedEOF,
 };
 
+enum class ObjectImageLoadMode : uint8_t
+{
+    None,     // Image table is left empty, e.g. when indexing objects
+    Deferred, // Image table is sized but image data is only loaded once the images are used
+    Full,
+};
+
 struct IReadObjectContext
 {
     virtual ~IReadObjectContext() = default;
 
     virtual std::string_view GetObjectIdentifier() abstract;
     virtual IObjectRepository& GetObjectRepository() abstract;
-    virtual bool ShouldLoadImages() abstract;
+    virtual ObjectImageLoadMode GetImageLoadMode() abstract;
     virtual std::vector<uint8_t> GetData(std::string_view path) abstract;
     virtual ObjectAsset GetAsset(std::string_view path) abstract;
 
@@ -314,6 +322,14 @@ public:
     {
         return _imageTable;
     }
+    void SetDeferredImageLoader(std::function<std::unique_ptr<Object>()> loader)
+    {
+        _imageTable.SetDeferredLoader(std::move(loader));
+    }
+    void MoveImagesTo(ImageTable& imageTable)
+    {
+        imageTable.TakeImages(_imageTable);
+    }
 
     ObjectEntryDescriptor GetScgWallsHeader() const;
     ObjectEntryDescriptor GetScgPathXHeader() const;
@@ -115,7 +115,7 @@ private:
     const IFileDataRetriever* _fileDataRetriever;
 
     std::string _identifier;
-    bool _loadImages;
+    ObjectImageLoadMode _imageLoadMode;
     std::string _basePath;
     bool _wasVerbose = false;
     bool _wasWarning = false;
@@ -136,12 +136,12 @@ public:
     }
 
     ReadObjectContext(
-        IObjectRepository& objectRepository, const std::string& identifier, bool loadImages,
+        IObjectRepository& objectRepository, const std::string& identifier, ObjectImageLoadMode imageLoadMode,
         const IFileDataRetriever* fileDataRetriever)
         : _objectRepository(objectRepository)
         , _fileDataRetriever(fileDataRetriever)
         , _identifier(identifier)
-        , _loadImages(loadImages)
+        , _imageLoadMode(imageLoadMode)
     {
     }
 
@@ -155,9 +155,9 @@ public:
         return _objectRepository;
     }
 
-    bool ShouldLoadImages() override
+    ObjectImageLoadMode GetImageLoadMode() override
     {
-        return _loadImages;
+        return _imageLoadMode;
     }
 
     std::vector<uint8_t> GetData(std::string_view path) override
@@ -216,7 +216,8 @@ namespace ObjectFactory
      * @note jRoot is deliberately left non-const: json_t behaviour changes when const
      */
     static std::unique_ptr<Object> CreateObjectFromJson(
-        IObjectRepository& objectRepository, json_t& jRoot, const IFileDataRetriever* fileRetriever, bool loadImageTable);
+        IObjectRepository& objectRepository, json_t& jRoot, const IFileDataRetriever* fileRetriever,
+        ObjectImageLoadMode imageLoadMode);
 
     static ObjectSourceGame ParseSourceGame(const std::string& s)
     {
@@ -251,7 +252,8 @@ namespace ObjectFactory
         }
     }
 
-    std::unique_ptr<Object> CreateObjectFromLegacyFile(IObjectRepository& objectRepository, const utf8* path, bool loadImages)
+    std::unique_ptr<Object> CreateObjectFromLegacyFile(
+        IObjectRepository& objectRepository, const utf8* path, ObjectImageLoadMode imageLoadMode)
     {
         LOG_VERBOSE("CreateObjectFromLegacyFile(..., \"%s\")", path);
 
@@ -276,13 +278,20 @@ namespace ObjectFactory
                 LOG_VERBOSE("  size: %zu", chunk->GetLength());
 
                 auto chunkStream = OpenRCT2::MemoryStream(chunk->GetData(), chunk->GetLength());
-                auto readContext = ReadObjectContext(objectRepository, objectName, loadImages, nullptr);
+                auto readContext = ReadObjectContext(objectRepository, objectName, imageLoadMode, nullptr);
                 ReadObjectLegacy(*result, &readContext, &chunkStream);
                 if (readContext.WasError())
                 {
                     throw std::runtime_error("Object has errors");
                 }
                 result->SetSourceGames({ entry.GetSourceGame() });
+
+                if (imageLoadMode == ObjectImageLoadMode::Deferred)
+                {
+                    result->SetDeferredImageLoader([&objectRepository, objectPath = std::string(path)]() {
+                        return CreateObjectFromLegacyFile(objectRepository, objectPath.c_str(), ObjectImageLoadMode::Full);
+                    });
+                }
             }
         }
         catch (const std::exception& e)
@@ -306,7 +315,8 @@ namespace ObjectFactory
             utf8 objectName[DAT_NAME_LENGTH + 1];
             ObjectEntryGetNameFixed(objectName, sizeof(objectName), entry);
 
-            auto readContext = ReadObjectContext(objectRepository, objectName, !gOpenRCT2NoGraphics, nullptr);
+            auto imageLoadMode = gOpenRCT2NoGraphics ? ObjectImageLoadMode::Deferred : ObjectImageLoadMode::Full;
+            auto readContext = ReadObjectContext(objectRepository, objectName, imageLoadMode, nullptr);
             auto chunkStream = OpenRCT2::MemoryStream(data, dataSize);
             ReadObjectLegacy(*result, &readContext, &chunkStream);
 
@@ -423,7 +433,8 @@ namespace ObjectFactory
         return ObjectType::None;
     }
 
-    std::unique_ptr<Object> CreateObjectFromZipFile(IObjectRepository& objectRepository, std::string_view path, bool loadImages)
+    std::unique_ptr<Object> CreateObjectFromZipFile(
+        IObjectRepository& objectRepository, std::string_view path, ObjectImageLoadMode imageLoadMode)
     {
         try
         {
@@ -439,7 +450,14 @@ namespace ObjectFactory
             if (jRoot.is_object())
             {
                 auto fileDataRetriever = ZipDataRetriever(path, *archive);
-                return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, loadImages);
+                auto result = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, imageLoadMode);
+                if (result != nullptr && imageLoadMode == ObjectImageLoadMode::Deferred)
+                {
+                    result->SetDeferredImageLoader([&objectRepository, objectPath = std::string(path)]() {
+                        return CreateObjectFromZipFile(objectRepository, objectPath, ObjectImageLoadMode::Full);
+                    });
+                }
+                return result;
             }
         }
         catch (const std::exception& e)
@@ -450,7 +468,7 @@ namespace ObjectFactory
     }
 
     std::unique_ptr<Object> CreateObjectFromJsonFile(
-        IObjectRepository& objectRepository, const std::string& path, bool loadImages)
+        IObjectRepository& objectRepository, const std::string& path, ObjectImageLoadMode imageLoadMode)
     {
         LOG_VERBOSE("CreateObjectFromJsonFile(\"%s\")", path.c_str());
 
@@ -458,7 +476,14 @@ namespace ObjectFactory
         {
             json_t jRoot = Json::ReadFromFile(path.c_str());
             auto fileDataRetriever = FileSystemDataRetriever(Path::GetDirectory(path));
-            return CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, loadImages);
+            auto result = CreateObjectFromJson(objectRepository, jRoot, &fileDataRetriever, imageLoadMode);
+            if (result != nullptr && imageLoadMode == ObjectImageLoadMode::Deferred)
+            {
+                result->SetDeferredImageLoader([&objectRepository, path]() {
+                    return CreateObjectFromJsonFile(objectRepository, path, ObjectImageLoadMode::Full);
+                });
+            }
+            return result;
         }
         catch (const std::runtime_error& err)
         {
@@ -501,7 +526,8 @@ namespace ObjectFactory
     }
 
     std::unique_ptr<Object> CreateObjectFromJson(
-        IObjectRepository& objectRepository, json_t& jRoot, const IFileDataRetriever* fileRetriever, bool loadImageTable)
+        IObjectRepository& objectRepository, json_t& jRoot, const IFileDataRetriever* fileRetriever,
+        ObjectImageLoadMode imageLoadMode)
     {
         if (!jRoot.is_object())
         {
@@ -546,7 +572,7 @@ namespace ObjectFactory
             result->SetIdentifier(id);
             result->SetDescriptor(descriptor);
             result->MarkAsJsonObject();
-            auto readContext = ReadObjectContext(objectRepository, id, loadImageTable, fileRetriever);
+            auto readContext = ReadObjectContext(objectRepository, id, imageLoadMode, fileRetriever);
             result->ReadJson(&readContext, jRoot);
             if (readContext.WasError())
             {
@@ -14,7 +14,9 @@
 #include "../audio/audio.h"
 #include "../core/Console.hpp"
 #include "../core/Memory.hpp"
+#include "../core/Parallel.h"
 #include "../localisation/StringIds.h"
+#include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
 #include "../ride/RideAudio.h"
 #include "../util/Util.h"
@@ -33,7 +35,6 @@
 #include <array>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <unordered_set>
 
 /**
@@ -548,30 +549,6 @@ private:
         return requiredObjects;
     }
 
-    template<typename T, typename TFunc> static void ParallelFor(const std::vector<T>& items, TFunc func)
-    {
-        auto partitions = std::thread::hardware_concurrency();
-        auto partitionSize = (items.size() + (partitions - 1)) / partitions;
-        std::vector<std::thread> threads;
-        for (size_t n = 0; n < partitions; n++)
-        {
-            auto begin = n * partitionSize;
-            auto end = std::min(items.size(), begin + partitionSize);
-            threads.emplace_back(
-                [func](size_t pbegin, size_t pend) {
-                    for (size_t i = pbegin; i < pend; i++)
-                    {
-                        func(i);
-                    }
-                },
-                begin, end);
-        }
-        for (auto& t : threads)
-        {
-            t.join();
-        }
-    }
-
     void LoadObjects(std::vector<ObjectToLoad>& requiredObjects)
     {
         std::vector<Object*> objects;
@@ -580,7 +557,9 @@ private:
 
         // Read objects
         std::mutex commonMutex;
-        ParallelFor(requiredObjects, [&](size_t i) {
+        OpenRCT2::Parallel::For(requiredObjects.size(), [&](size_t i) {
+            PROFILED_FUNCTION();
+
             auto& otl = requiredObjects[i];
             auto* requiredObject = otl.RepositoryItem;
             if (requiredObject != nullptr)
@@ -590,7 +569,8 @@ private:
                 {
                     // Object requires to be loaded, if the object successfully loads it will register it
                     // as a loaded object otherwise placed into the badObjects list.
-                    auto newObject = _objectRepository.LoadObject(requiredObject);
+                    // Images are only loaded once they are drawn, most of them are never used in a session.
+                    auto newObject = _objectRepository.LoadObject(requiredObject, ObjectImageLoadMode::Deferred);
                     std::lock_guard<std::mutex> guard(commonMutex);
                     if (newObject == nullptr)
                     {
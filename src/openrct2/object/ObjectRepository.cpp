@@ -103,15 +103,15 @@ public:
         auto extension = Path::GetExtension(path);
         if (String::Equals(extension, ".json", true))
         {
-            object = ObjectFactory::CreateObjectFromJsonFile(_objectRepository, path, false);
+            object = ObjectFactory::CreateObjectFromJsonFile(_objectRepository, path, ObjectImageLoadMode::None);
         }
         else if (String::Equals(extension, ".parkobj", true))
         {
-            object = ObjectFactory::CreateObjectFromZipFile(_objectRepository, path, false);
+            object = ObjectFactory::CreateObjectFromZipFile(_objectRepository, path, ObjectImageLoadMode::None);
         }
         else
         {
-            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str(), false);
+            object = ObjectFactory::CreateObjectFromLegacyFile(_objectRepository, path.c_str(), ObjectImageLoadMode::None);
         }
 
         if (object != nullptr)
@@ -260,20 +260,31 @@ public:
     }
 
     std::unique_ptr<Object> LoadObject(const ObjectRepositoryItem* ori) override
+    {
+        return LoadObject(ori, ObjectImageLoadMode::Full);
+    }
+
+    std::unique_ptr<Object> LoadObject(const ObjectRepositoryItem* ori, ObjectImageLoadMode imageLoadMode) override
     {
         Guard::ArgumentNotNull(ori, GUARD_LINE);
 
+        // Headless instances never draw, only the size of the image tables is needed for allocating image ids
+        if (gOpenRCT2NoGraphics)
+        {
+            imageLoadMode = ObjectImageLoadMode::Deferred;
+        }
+
         auto extension = Path::GetExtension(ori->Path);
         if (String::Equals(extension, ".json", true))
         {
-            return ObjectFactory::CreateObjectFromJsonFile(*this, ori->Path, !gOpenRCT2NoGraphics);
+            return ObjectFactory::CreateObjectFromJsonFile(*this, ori->Path, imageLoadMode);
         }
         if (String::Equals(extension, ".parkobj", true))
         {
-            return ObjectFactory::CreateObjectFromZipFile(*this, ori->Path, !gOpenRCT2NoGraphics);
+            return ObjectFactory::CreateObjectFromZipFile(*this, ori->Path, imageLoadMode);
         }
 
-        return ObjectFactory::CreateObjectFromLegacyFile(*this, ori->Path.c_str(), !gOpenRCT2NoGraphics);
+        return ObjectFactory::CreateObjectFromLegacyFile(*this, ori->Path.c_str(), imageLoadMode);
     }
 
     void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::unique_ptr<Object>&& object) override
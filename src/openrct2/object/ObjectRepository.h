@@ -85,6 +85,8 @@ struct IObjectRepository
     [[nodiscard]] virtual const ObjectRepositoryItem* FindObject(const ObjectEntryDescriptor& oed) const abstract;
 
     [[nodiscard]] virtual std::unique_ptr<Object> LoadObject(const ObjectRepositoryItem* ori) abstract;
+    [[nodiscard]] virtual std::unique_ptr<Object> LoadObject(
+        const ObjectRepositoryItem* ori, ObjectImageLoadMode imageLoadMode) abstract;
     virtual void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::unique_ptr<Object>&& object) abstract;
     virtual void UnregisterLoadedObject(const ObjectRepositoryItem* ori, Object* object) abstract;
 
@@ -30,6 +30,7 @@
 #include "../ride/ShopItem.h"
 #include "../ride/Track.h"
 #include "../ride/Vehicle.h"
+#include "../ride/VehiclePaint.h"
 #include "ObjectRepository.h"
 
 #include <algorithm>
@@ -206,7 +207,7 @@ void RideObject::Load()
     _legacyType.naming.Name = LanguageAllocateObjectString(GetName());
     _legacyType.naming.Description = LanguageAllocateObjectString(GetDescription());
     _legacyType.capacity = LanguageAllocateObjectString(GetCapacity());
-    _legacyType.images_offset = GfxObjectAllocateImages(GetImageTable().GetImages(), GetImageTable().GetCount());
+    _legacyType.images_offset = GfxObjectAllocateImages(GetImageTable());
     _legacyType.vehicle_preset_list = &_presetColours;
 
     int32_t currentCarImagesOffset = _legacyType.images_offset + RCT2::ObjectLimits::MaxRideTypesPerRideEntry;
@@ -266,6 +267,12 @@ void RideObject::Load()
             {
                 carEntry.peep_loading_waypoints = std::move(_peepLoadingWaypoints[i]);
             }
+
+            if (!gOpenRCT2NoGraphics)
+            {
+                auto spriteTable = VehicleSpriteTableCreate(_legacyType.Cars, i);
+                carEntry.SpriteTable = std::make_shared<const VehicleSpriteTable>(std::move(spriteTable));
+            }
         }
     }
 }
@@ -276,6 +283,10 @@ void RideObject::Unload()
     LanguageFreeObjectString(_legacyType.naming.Description);
     LanguageFreeObjectString(_legacyType.capacity);
     GfxObjectFreeImages(_legacyType.images_offset, GetImageTable().GetCount());
+    for (auto& carEntry : _legacyType.Cars)
+    {
+        carEntry.SpriteTable = nullptr;
+    }
 
     _legacyType.naming.Name = 0;
     _legacyType.naming.Description = 0;
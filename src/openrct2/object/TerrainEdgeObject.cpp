@@ -22,7 +22,7 @@ void TerrainEdgeObject::Load()
 {
     GetStringTable().Sort();
     NameStringId = LanguageAllocateObjectString(GetName());
-    IconImageId = GfxObjectAllocateImages(GetImageTable().GetImages(), GetImageTable().GetCount());
+    IconImageId = GfxObjectAllocateImages(GetImageTable());
 
     // First image is icon followed by edge images
     BaseImageId = IconImageId + 1;
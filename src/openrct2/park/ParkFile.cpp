@@ -992,12 +992,13 @@ namespace OpenRCT2
             auto found = os.ReadWriteChunk(
                 ParkFileChunkType::TILES,
                 [pathToSurfaceMap, pathToQueueSurfaceMap, pathToRailingsMap, &os](OrcaStream::ChunkStream& cs) {
-                    cs.ReadWrite(gMapSize.x);
-                    cs.ReadWrite(gMapSize.y);
+                    auto mapSize = GetMapSize();
+                    cs.ReadWrite(mapSize.x);
+                    cs.ReadWrite(mapSize.y);
 
                     if (cs.GetMode() == OrcaStream::Mode::READING)
                     {
-                        OpenRCT2::GetContext()->GetGameState()->InitAll(gMapSize);
+                        OpenRCT2::GetContext()->GetGameState()->InitAll(mapSize);
 
                         auto numElements = cs.Read<uint32_t>();
 
@@ -1056,9 +1057,10 @@ namespace OpenRCT2
 
         void UpdateTrackElementsRideType()
         {
-            for (int32_t y = 0; y < gMapSize.y; y++)
+            const auto mapSize = GetMapSize();
+            for (int32_t y = 0; y < mapSize.y; y++)
             {
-                for (int32_t x = 0; x < gMapSize.x; x++)
+                for (int32_t x = 0; x < mapSize.x; x++)
                 {
                     TileElement* tileElement = MapGetFirstElementAt(TileCoordsXY{ x, y });
                     if (tileElement == nullptr)
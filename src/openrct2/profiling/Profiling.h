@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ProfilingMacros.hpp"
+#include "Tracing.h"
 
 #include <array>
 #include <atomic>
@@ -137,7 +138,7 @@ namespace OpenRCT2::Profiling
             }
         };
 
-        template<typename TName> struct FunctionWrapper : FunctionInternal
+        template<typename TName> struct FunctionWrapper final : FunctionInternal
         {
             const char* GetName() const noexcept override
             {
@@ -162,20 +163,30 @@ namespace OpenRCT2::Profiling
     template<typename T> class ScopedProfiling
     {
         bool _enabled;
+        bool _tracing;
         T& _func;
 
     public:
         ScopedProfiling(T& func)
             : _enabled{ IsEnabled() }
+            , _tracing{ Tracing::IsEnabled() }
             , _func(func)
         {
             if (_enabled)
             {
                 Detail::FunctionEnter(_func);
             }
+            if (_tracing)
+            {
+                Tracing::Detail::Begin(_func.GetName());
+            }
         }
         ~ScopedProfiling()
         {
+            if (_tracing)
+            {
+                Tracing::Detail::End(_func.GetName());
+            }
             if (!_enabled)
                 return;
             Detail::FunctionExit(_func);
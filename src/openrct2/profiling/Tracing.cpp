@@ -0,0 +1,628 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Tracing.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OpenRCT2::Profiling::Tracing
+{
+    namespace Detail
+    {
+        std::atomic<bool> Enabled{};
+    }
+
+    // 32 bytes per event, so 1 MiB per thread
+    static constexpr size_t BufferSize = 1 << 15;
+
+    enum class EventType : uint8_t
+    {
+        Begin,
+        End,
+        Counter,
+        TickBegin,
+        TickEnd,
+    };
+
+    struct Event
+    {
+        const char* Name;
+        int64_t Value;
+        uint64_t Timestamp;
+        EventType Type;
+    };
+
+    // Exporters copy slots while their thread may overwrite them, so every field is a relaxed atomic and torn copies are
+    // detected afterwards, like in a seqlock.
+    struct EventSlot
+    {
+        std::atomic<const char*> Name{};
+        std::atomic<int64_t> Value{};
+        std::atomic<uint64_t> Timestamp{};
+        std::atomic<EventType> Type{};
+
+        void Store(const Event& event)
+        {
+            Name.store(event.Name, std::memory_order_relaxed);
+            Value.store(event.Value, std::memory_order_relaxed);
+            Timestamp.store(event.Timestamp, std::memory_order_relaxed);
+            Type.store(event.Type, std::memory_order_relaxed);
+        }
+
+        Event Load() const
+        {
+            return { Name.load(std::memory_order_relaxed), Value.load(std::memory_order_relaxed),
+                     Timestamp.load(std::memory_order_relaxed), Type.load(std::memory_order_relaxed) };
+        }
+    };
+
+    /**
+     * A ring buffer that is only written by its thread. Events are numbered by a running index and exporters read the
+     * committed ones, detecting the events that were overwritten while they were being copied by the highest index that
+     * was ever written. In slow tick mode the events of a tick are only committed at the end of the tick, if the tick
+     * was fast enough the buffer is rewound to where the tick started instead. Other threads record their events while
+     * any tick is running and exporters only keep those that fall within a slow tick.
+     */
+    struct ThreadBuffer
+    {
+        uint32_t Id{};
+        std::string Name;
+        bool InUse = true;
+        std::atomic<uint32_t> Generation{};
+        std::atomic<uint64_t> Committed{};
+        std::atomic<uint64_t> Written{};
+
+        // Only used by the owning thread.
+        uint64_t Head{};
+        bool InTick{};
+        uint64_t TickStartHead{};
+        uint64_t TickStartTime{};
+
+        std::array<EventSlot, BufferSize> Events{};
+
+        void Reset(uint32_t generation)
+        {
+            Head = 0;
+            InTick = false;
+            Committed.store(0, std::memory_order_relaxed);
+            Written.store(0, std::memory_order_relaxed);
+            Generation.store(generation, std::memory_order_release);
+        }
+
+        void Write(const Event& event)
+        {
+            const auto index = Head;
+            if (index + 1 > Written.load(std::memory_order_relaxed))
+            {
+                Written.store(index + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+            Events[index % BufferSize].Store(event);
+            Head = index + 1;
+            if (!InTick)
+            {
+                Committed.store(Head, std::memory_order_release);
+            }
+        }
+    };
+
+    static std::mutex _buffersMutex;
+    static std::vector<std::unique_ptr<ThreadBuffer>> _buffers;
+    static std::atomic<uint32_t> _generation{};
+    static std::atomic<uint64_t> _slowTickThresholdNs{};
+
+    // In slow tick mode, whether the game thread is in a tick, and the start and end time of the recent slow ticks
+    static std::atomic<bool> _tickInProgress{};
+    static std::mutex _slowTicksMutex;
+    static std::deque<std::pair<uint64_t, uint64_t>> _slowTicks;
+
+    // Hands the buffer to the next new thread once its thread exits.
+    struct ThreadBufferHandle
+    {
+        ThreadBuffer* Buffer{};
+
+        ~ThreadBufferHandle()
+        {
+            if (Buffer != nullptr)
+            {
+                std::scoped_lock lock(_buffersMutex);
+                Buffer->InUse = false;
+            }
+        }
+    };
+
+    static thread_local ThreadBufferHandle _threadBuffer;
+
+    static uint64_t GetTimestamp()
+    {
+        static const auto epoch = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+    }
+
+    static ThreadBuffer& GetThreadBuffer()
+    {
+        auto* buffer = _threadBuffer.Buffer;
+        if (buffer == nullptr)
+        {
+            std::scoped_lock lock(_buffersMutex);
+            for (auto& unusedBuffer : _buffers)
+            {
+                if (!unusedBuffer->InUse)
+                {
+                    buffer = unusedBuffer.get();
+                    break;
+                }
+            }
+            if (buffer == nullptr)
+            {
+                buffer = _buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+                buffer->Id = static_cast<uint32_t>(_buffers.size());
+            }
+            // The events of the previous thread are kept, the new thread continues after them
+            buffer->InUse = true;
+            buffer->Name.clear();
+            _threadBuffer.Buffer = buffer;
+        }
+
+        // Start clears the trace by moving to a new generation, each thread clears its own buffer
+        const auto generation = _generation.load(std::memory_order_acquire);
+        if (buffer->Generation.load(std::memory_order_relaxed) != generation)
+        {
+            buffer->Reset(generation);
+        }
+        return *buffer;
+    }
+
+    static void Write(EventType type, const char* name, int64_t value)
+    {
+        auto& buffer = GetThreadBuffer();
+        if (!buffer.InTick && _slowTickThresholdNs.load(std::memory_order_relaxed) != 0
+            && !_tickInProgress.load(std::memory_order_relaxed))
+            return;
+
+        buffer.Write({ name, value, GetTimestamp(), type });
+    }
+
+    namespace Detail
+    {
+        void Begin(const char* name)
+        {
+            Write(EventType::Begin, name, 0);
+        }
+
+        void End(const char* name)
+        {
+            Write(EventType::End, name, 0);
+        }
+
+        void TickBegin(uint32_t tick)
+        {
+            auto& buffer = GetThreadBuffer();
+            if (buffer.Name.empty())
+            {
+                SetThreadName("Game");
+            }
+
+            if (_slowTickThresholdNs.load(std::memory_order_relaxed) != 0)
+            {
+                buffer.InTick = true;
+                buffer.TickStartHead = buffer.Head;
+                buffer.TickStartTime = GetTimestamp();
+                _tickInProgress.store(true, std::memory_order_relaxed);
+            }
+            buffer.Write({ "Tick", tick, GetTimestamp(), EventType::TickBegin });
+        }
+
+        void TickEnd()
+        {
+            auto& buffer = GetThreadBuffer();
+            const auto threshold = _slowTickThresholdNs.load(std::memory_order_relaxed);
+            if (!buffer.InTick)
+            {
+                if (threshold == 0)
+                {
+                    buffer.Write({ "Tick", 0, GetTimestamp(), EventType::TickEnd });
+                }
+                return;
+            }
+
+            const auto timestamp = GetTimestamp();
+            buffer.Write({ "Tick", 0, timestamp, EventType::TickEnd });
+            buffer.InTick = false;
+            _tickInProgress.store(false, std::memory_order_relaxed);
+            if (timestamp - buffer.TickStartTime < threshold)
+            {
+                buffer.Head = buffer.TickStartHead;
+            }
+            else
+            {
+                buffer.Committed.store(buffer.Head, std::memory_order_release);
+
+                // The game thread can hold no more slow ticks than this, older ones have no use
+                std::scoped_lock lock(_slowTicksMutex);
+                _slowTicks.emplace_back(buffer.TickStartTime, timestamp);
+                if (_slowTicks.size() > BufferSize / 2)
+                {
+                    _slowTicks.pop_front();
+                }
+            }
+        }
+    } // namespace Detail
+
+    void Start(double slowTickThresholdMs)
+    {
+        _slowTickThresholdNs = static_cast<uint64_t>(std::max(slowTickThresholdMs, 0.0) * 1000000.0);
+        _tickInProgress = false;
+        {
+            std::scoped_lock lock(_slowTicksMutex);
+            _slowTicks.clear();
+        }
+        _generation++;
+        Detail::Enabled = true;
+    }
+
+    void Stop()
+    {
+        Detail::Enabled = false;
+    }
+
+    void SetThreadName(std::string_view name)
+    {
+        auto& buffer = GetThreadBuffer();
+        std::scoped_lock lock(_buffersMutex);
+        buffer.Name = name;
+    }
+
+    void Counter(const char* name, int64_t value)
+    {
+        if (IsEnabled())
+        {
+            Write(EventType::Counter, name, value);
+        }
+    }
+
+    struct ThreadEvents
+    {
+        uint32_t Id{};
+        std::string Name;
+        std::vector<Event> Events;
+    };
+
+    static bool IsInSlowTick(const std::vector<std::pair<uint64_t, uint64_t>>& slowTicks, uint64_t timestamp)
+    {
+        auto it = std::upper_bound(
+            slowTicks.begin(), slowTicks.end(), timestamp,
+            [](uint64_t value, const std::pair<uint64_t, uint64_t>& tick) { return value < tick.first; });
+        return it != slowTicks.begin() && timestamp <= std::prev(it)->second;
+    }
+
+    // Copies the committed events of every thread, without the slices that have lost their start to the ring buffer
+    static std::vector<ThreadEvents> GetThreadEvents()
+    {
+        std::vector<ThreadEvents> result;
+        const auto generation = _generation.load();
+        const bool slowTicksOnly = _slowTickThresholdNs.load() != 0;
+        std::vector<std::pair<uint64_t, uint64_t>> slowTicks;
+        if (slowTicksOnly)
+        {
+            std::scoped_lock lock(_slowTicksMutex);
+            slowTicks.assign(_slowTicks.begin(), _slowTicks.end());
+        }
+
+        std::scoped_lock lock(_buffersMutex);
+        for (auto& buffer : _buffers)
+        {
+            if (buffer->Generation.load(std::memory_order_acquire) != generation)
+                continue;
+
+            const auto committed = buffer->Committed.load(std::memory_order_acquire);
+            const auto begin = committed > BufferSize ? committed - BufferSize : 0;
+            std::vector<Event> events;
+            events.reserve(committed - begin);
+            for (auto i = begin; i < committed; i++)
+            {
+                events.push_back(buffer->Events[i % BufferSize].Load());
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const auto written = buffer->Written.load(std::memory_order_relaxed);
+            const auto firstValid = written > BufferSize ? written - BufferSize : 0;
+
+            ThreadEvents threadEvents;
+            threadEvents.Id = buffer->Id;
+            threadEvents.Name = buffer->Name.empty() ? "Thread " + std::to_string(buffer->Id) : buffer->Name;
+            size_t depth = 0;
+            for (auto i = std::max(begin, firstValid); i < committed; i++)
+            {
+                const auto& event = events[i - begin];
+                if (slowTicksOnly && !IsInSlowTick(slowTicks, event.Timestamp))
+                    continue;
+
+                if (event.Type == EventType::Begin || event.Type == EventType::TickBegin)
+                {
+                    depth++;
+                }
+                else if (event.Type == EventType::End || event.Type == EventType::TickEnd)
+                {
+                    if (depth == 0)
+                        continue;
+                    depth--;
+                }
+                threadEvents.Events.push_back(event);
+            }
+            if (!threadEvents.Events.empty())
+            {
+                result.push_back(std::move(threadEvents));
+            }
+        }
+        return result;
+    }
+
+    size_t GetEventCount()
+    {
+        size_t count = 0;
+        for (const auto& thread : GetThreadEvents())
+        {
+            count += thread.Events.size();
+        }
+        return count;
+    }
+
+    static void WriteJsonString(std::ostream& out, std::string_view str)
+    {
+        out << '"';
+        for (auto c : str)
+        {
+            if (c == '"' || c == '\\')
+                out << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 0x20)
+                out << ' ';
+            else
+                out << c;
+        }
+        out << '"';
+    }
+
+    void WriteChromeTrace(std::ostream& out)
+    {
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        out << std::fixed << std::setprecision(3);
+        out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"OpenRCT2\"}}";
+        for (const auto& thread : GetThreadEvents())
+        {
+            out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.Id << ",\"args\":{\"name\":";
+            WriteJsonString(out, thread.Name);
+            out << "}}";
+
+            for (const auto& event : thread.Events)
+            {
+                out << ",\n{\"name\":";
+                WriteJsonString(out, event.Name);
+                out << ",\"ts\":" << event.Timestamp / 1000.0 << ",\"pid\":1,\"tid\":" << thread.Id;
+                switch (event.Type)
+                {
+                    case EventType::Begin:
+                        out << ",\"ph\":\"B\"}";
+                        break;
+                    case EventType::End:
+                    case EventType::TickEnd:
+                        out << ",\"ph\":\"E\"}";
+                        break;
+                    case EventType::Counter:
+                        out << ",\"ph\":\"C\",\"args\":{\"value\":" << event.Value << "}}";
+                        break;
+                    case EventType::TickBegin:
+                        out << ",\"ph\":\"B\",\"args\":{\"tick\":" << event.Value << "}}";
+                        break;
+                }
+            }
+        }
+        out << "]}\n";
+    }
+
+    // Just enough of the protobuf wire format to write the trace packets Perfetto needs
+    class ProtoWriter
+    {
+        std::string _data;
+
+        void WriteVarint(uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                _data += static_cast<char>((value & 0x7F) | 0x80);
+                value >>= 7;
+            }
+            _data += static_cast<char>(value);
+        }
+
+    public:
+        void WriteUInt(uint32_t field, uint64_t value)
+        {
+            WriteVarint(field << 3);
+            WriteVarint(value);
+        }
+
+        void WriteInt(uint32_t field, int64_t value)
+        {
+            WriteUInt(field, static_cast<uint64_t>(value));
+        }
+
+        void WriteString(uint32_t field, std::string_view value)
+        {
+            WriteVarint((field << 3) | 2);
+            WriteVarint(value.size());
+            _data.append(value);
+        }
+
+        void WriteMessage(uint32_t field, const ProtoWriter& message)
+        {
+            WriteString(field, message._data);
+        }
+
+        const std::string& GetData() const
+        {
+            return _data;
+        }
+    };
+
+    namespace Perfetto
+    {
+        // Trace
+        constexpr uint32_t TracePacketField = 1;
+        // TracePacket
+        constexpr uint32_t TimestampField = 8;
+        constexpr uint32_t SequenceIdField = 10;
+        constexpr uint32_t TrackEventField = 11;
+        constexpr uint32_t TrackDescriptorField = 60;
+        // TrackDescriptor
+        constexpr uint32_t UuidField = 1;
+        constexpr uint32_t TrackNameField = 2;
+        constexpr uint32_t ProcessField = 3;
+        constexpr uint32_t ThreadField = 4;
+        constexpr uint32_t ParentUuidField = 5;
+        constexpr uint32_t CounterField = 8;
+        // ProcessDescriptor and ThreadDescriptor
+        constexpr uint32_t PidField = 1;
+        constexpr uint32_t TidField = 2;
+        constexpr uint32_t ThreadNameField = 5;
+        constexpr uint32_t ProcessNameField = 6;
+        // TrackEvent
+        constexpr uint32_t EventTypeField = 9;
+        constexpr uint32_t TrackUuidField = 11;
+        constexpr uint32_t EventNameField = 23;
+        constexpr uint32_t CounterValueField = 30;
+
+        constexpr uint64_t SliceBegin = 1;
+        constexpr uint64_t SliceEnd = 2;
+        constexpr uint64_t CounterType = 4;
+
+        constexpr uint64_t ProcessUuid = 1;
+        constexpr uint64_t ThreadUuidBase = 0x1000;
+        constexpr uint64_t CounterUuidBase = 0x100000;
+    } // namespace Perfetto
+
+    void WritePerfettoTrace(std::ostream& out)
+    {
+        using namespace Perfetto;
+
+        auto writePacket = [&out](const ProtoWriter& packet) {
+            ProtoWriter trace;
+            trace.WriteMessage(TracePacketField, packet);
+            out.write(trace.GetData().data(), trace.GetData().size());
+        };
+
+        {
+            ProtoWriter process;
+            process.WriteInt(PidField, 1);
+            process.WriteString(ProcessNameField, "OpenRCT2");
+            ProtoWriter descriptor;
+            descriptor.WriteUInt(UuidField, ProcessUuid);
+            descriptor.WriteMessage(ProcessField, process);
+            ProtoWriter packet;
+            packet.WriteMessage(TrackDescriptorField, descriptor);
+            writePacket(packet);
+        }
+
+        // Counters are process wide, each gets its own track the first time it is seen
+        std::map<std::string_view, uint64_t> counterTracks;
+        for (const auto& thread : GetThreadEvents())
+        {
+            const auto threadUuid = ThreadUuidBase + thread.Id;
+            {
+                ProtoWriter threadDescriptor;
+                threadDescriptor.WriteInt(PidField, 1);
+                threadDescriptor.WriteInt(TidField, thread.Id);
+                threadDescriptor.WriteString(ThreadNameField, thread.Name);
+                ProtoWriter descriptor;
+                descriptor.WriteUInt(UuidField, threadUuid);
+                descriptor.WriteUInt(ParentUuidField, ProcessUuid);
+                descriptor.WriteMessage(ThreadField, threadDescriptor);
+                ProtoWriter packet;
+                packet.WriteMessage(TrackDescriptorField, descriptor);
+                writePacket(packet);
+            }
+
+            for (const auto& event : thread.Events)
+            {
+                ProtoWriter trackEvent;
+                if (event.Type == EventType::Counter)
+                {
+                    auto [it, added] = counterTracks.emplace(event.Name, CounterUuidBase + counterTracks.size());
+                    if (added)
+                    {
+                        ProtoWriter descriptor;
+                        descriptor.WriteUInt(UuidField, it->second);
+                        descriptor.WriteString(TrackNameField, event.Name);
+                        descriptor.WriteUInt(ParentUuidField, ProcessUuid);
+                        descriptor.WriteMessage(CounterField, ProtoWriter());
+                        ProtoWriter packet;
+                        packet.WriteMessage(TrackDescriptorField, descriptor);
+                        writePacket(packet);
+                    }
+                    trackEvent.WriteUInt(EventTypeField, CounterType);
+                    trackEvent.WriteUInt(TrackUuidField, it->second);
+                    trackEvent.WriteInt(CounterValueField, event.Value);
+                }
+                else
+                {
+                    const bool isBegin = event.Type == EventType::Begin || event.Type == EventType::TickBegin;
+                    trackEvent.WriteUInt(EventTypeField, isBegin ? SliceBegin : SliceEnd);
+                    trackEvent.WriteUInt(TrackUuidField, threadUuid);
+                    if (event.Type == EventType::TickBegin)
+                    {
+                        trackEvent.WriteString(EventNameField, "Tick " + std::to_string(event.Value));
+                    }
+                    else if (isBegin)
+                    {
+                        trackEvent.WriteString(EventNameField, event.Name);
+                    }
+                }
+
+                // Events are only in order within a thread, so every thread is its own sequence
+                ProtoWriter packet;
+                packet.WriteUInt(TimestampField, event.Timestamp);
+                packet.WriteUInt(SequenceIdField, thread.Id);
+                packet.WriteMessage(TrackEventField, trackEvent);
+                writePacket(packet);
+            }
+        }
+    }
+
+    static bool EndsWith(std::string_view str, std::string_view suffix)
+    {
+        return str.size() >= suffix.size() && str.substr(str.size() - suffix.size()) == suffix;
+    }
+
+    bool Export(const std::string& filePath)
+    {
+        std::ofstream out(filePath, std::ios::binary);
+        if (!out.is_open())
+            return false;
+
+        if (EndsWith(filePath, ".pftrace") || EndsWith(filePath, ".perfetto-trace"))
+        {
+            WritePerfettoTrace(out);
+        }
+        else
+        {
+            WriteChromeTrace(out);
+        }
+        return out.good();
+    }
+} // namespace OpenRCT2::Profiling::Tracing
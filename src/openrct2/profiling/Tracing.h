@@ -0,0 +1,83 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+/**
+ * Records a timeline of profiled functions, counters and game ticks for viewing in chrome://tracing or Perfetto.
+ * Every thread writes into its own ring buffer without locking, so only the most recent events of each thread are kept.
+ */
+namespace OpenRCT2::Profiling::Tracing
+{
+    namespace Detail
+    {
+        extern std::atomic<bool> Enabled;
+
+        void Begin(const char* name);
+        void End(const char* name);
+        void TickBegin(uint32_t tick);
+        void TickEnd();
+    } // namespace Detail
+
+    inline bool IsEnabled()
+    {
+        return Detail::Enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Clears any previous trace and starts recording. With a threshold, only the events recorded during ticks that took
+     * at least that many milliseconds are kept, on the game thread and on any thread working for it during the tick.
+     * Anything that happens outside of a tick is not recorded.
+     */
+    void Start(double slowTickThresholdMs = 0);
+    void Stop();
+
+    // Names the calling thread in the exported trace.
+    void SetThreadName(std::string_view name);
+
+    // Records the value of a counter, names have to be string literals.
+    void Counter(const char* name, int64_t value);
+
+    // Returns the number of events currently held by all threads.
+    size_t GetEventCount();
+
+    void WriteChromeTrace(std::ostream& out);
+    void WritePerfettoTrace(std::ostream& out);
+
+    // Writes a Perfetto trace if the path ends in .pftrace or .perfetto-trace and a Chrome trace JSON file otherwise.
+    bool Export(const std::string& filePath);
+
+    // Marks the events recorded during its lifetime as one game tick.
+    class ScopedTick
+    {
+        bool _enabled;
+
+    public:
+        explicit ScopedTick(uint32_t tick)
+            : _enabled{ IsEnabled() }
+        {
+            if (_enabled)
+            {
+                Detail::TickBegin(tick);
+            }
+        }
+        ~ScopedTick()
+        {
+            if (_enabled)
+            {
+                Detail::TickEnd();
+            }
+        }
+    };
+} // namespace OpenRCT2::Profiling::Tracing
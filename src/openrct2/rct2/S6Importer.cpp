@@ -399,7 +399,7 @@ namespace RCT2
             gCash = ToMoney64(DECRYPT_MONEY(_s6.Cash));
             // Pad013587FC
             gParkRatingCasualtyPenalty = _s6.ParkRatingCasualtyPenalty;
-            gMapSize = { _s6.MapSize, _s6.MapSize };
+            SetMapSize({ _s6.MapSize, _s6.MapSize });
             gSamePriceThroughoutPark = _s6.SamePriceThroughout | (static_cast<uint64_t>(_s6.SamePriceThroughoutExtended) << 32);
             _suggestedGuestMaximum = _s6.SuggestedMaxGuests;
             gScenarioParkRatingWarningDays = _s6.ParkRatingWarningDays;
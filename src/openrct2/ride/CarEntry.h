@@ -15,6 +15,7 @@
 
 #include <array>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,8 @@ namespace OpenRCT2::Audio
     enum class SoundId : uint8_t;
 }
 
+struct VehicleSpriteTable;
+
 enum : uint32_t
 {
     CAR_ENTRY_FLAG_POWERED_RIDE_UNRESTRICTED_GRAVITY = 1
@@ -189,6 +192,8 @@ struct CarEntry
     uint8_t peep_loading_waypoint_segments;
     std::vector<std::array<CoordsXY, 3>> peep_loading_waypoints = {};
     std::vector<int8_t> peep_loading_positions = {};
+    // Built when the ride object loads, cars without one are painted by the pitch paint functions
+    std::shared_ptr<const VehicleSpriteTable> SpriteTable;
 
     uint32_t NumRotationSprites(SpriteGroupType rotationType) const;
     int32_t SpriteByYaw(int32_t yaw, SpriteGroupType rotationType) const;
@@ -337,7 +337,8 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
 }
 
 /**
- *
+ * Recounts the guests that have each ride as their favourite. The counts are kept up to date by
+ * Guest::SetFavouriteRide, this is only needed once a park has been loaded.
  *  rct2: 0x006AC916
  */
 void RideUpdateFavouritedStat()
@@ -361,6 +362,47 @@ void RideUpdateFavouritedStat()
     WindowInvalidateByClass(WindowClass::RideList);
 }
 
+/**
+ * Refreshes the cached queue statistics of every ride. Ride::Update keeps them up to date from then on, but they are
+ * not saved so they have to be filled in once a park has been loaded.
+ */
+void RideUpdateAnalyticsQueues()
+{
+    for (auto& ride : GetRideManager())
+    {
+        ride.Analytics.UpdateQueues(ride);
+    }
+}
+
+/**
+ * Checks the favourite counts kept by Guest::SetFavouriteRide against a full recount. Logs and returns false if any
+ * of them went out of sync, without changing them.
+ */
+bool RideValidateFavouritedStat()
+{
+    std::vector<uint16_t> counts(OpenRCT2::Limits::MaxRidesInPark);
+    for (auto peep : EntityList<Guest>())
+    {
+        if (!peep->FavouriteRide.IsNull() && GetRide(peep->FavouriteRide) != nullptr)
+        {
+            counts[peep->FavouriteRide.ToUnderlying()]++;
+        }
+    }
+
+    bool valid = true;
+    for (const auto& ride : GetRideManager())
+    {
+        const auto count = counts[ride.id.ToUnderlying()];
+        if (ride.guests_favourite != count)
+        {
+            LOG_ERROR(
+                "Ride %u is the favourite of %u guests, not %u", ride.id.ToUnderlying(), count, ride.guests_favourite);
+            valid = false;
+        }
+    }
+    return valid;
+}
+
 /**
  *
  *  rct2: 0x006AC3AB
@@ -1039,6 +1081,7 @@ void Ride::Update()
     if (!rtd.HasFlag(RIDE_TYPE_FLAG_IS_MAZE))
         for (StationIndex::UnderlyingType i = 0; i < OpenRCT2::Limits::MaxStationsPerRide; i++)
             RideUpdateStation(*this, StationIndex::FromUnderlying(i));
+    Analytics.UpdateQueues(*this);
 
     // Update financial statistics
     num_customers_timeout++;
@@ -1055,12 +1098,13 @@ void Ride::Update()
         }
         num_customers[0] = cur_num_customers;
 
-        cur_num_customers = 0;
-        window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
-
         income_per_hour = CalculateIncomePerHour();
         window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
+        Analytics.AddSample(*this);
+        cur_num_customers = 0;
+        window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
+
         if (upkeep_cost != MONEY16_UNDEFINED)
             profit = (income_per_hour - (static_cast<money32>(upkeep_cost * 16)));
     }
@@ -1490,6 +1534,7 @@ void RidePrepareBreakdown(Ride& ride, int32_t breakdownReason)
     ride.lifecycle_flags |= RIDE_LIFECYCLE_BREAKDOWN_PENDING;
 
     ride.breakdown_reason_pending = breakdownReason;
+    ride.Analytics.CurrentBreakdowns++;
     ride.breakdown_sound_modifier = 0;
     ride.not_fixed_timeout = 0;
     ride.inspection_station = StationIndex::FromUnderlying(0); // ensure set to something.
@@ -5121,6 +5166,7 @@ void Ride::Delete()
 {
     custom_name = {};
     measurement = {};
+    Analytics = {};
     type = RIDE_TYPE_NULL;
 }
 
@@ -5430,9 +5476,10 @@ void DetermineRideEntranceAndExitLocations()
             // Search the map to find it. Skip the outer ring of invisible tiles.
             bool alreadyFoundEntrance = false;
             bool alreadyFoundExit = false;
-            for (int32_t y = 1; y < gMapSize.y - 1; y++)
+            const auto mapSize = GetMapSize();
+            for (int32_t y = 1; y < mapSize.y - 1; y++)
             {
-                for (int32_t x = 1; x < gMapSize.x - 1; x++)
+                for (int32_t x = 1; x < mapSize.x - 1; x++)
                 {
                     TileElement* tileElement = MapGetFirstElementAt(TileCoordsXY{ x, y });
 
@@ -5516,9 +5563,10 @@ void DetermineRideEntranceAndExitLocations()
 
 void RideClearLeftoverEntrances(const Ride& ride)
 {
-    for (TileCoordsXY tilePos = {}; tilePos.x < gMapSize.x; ++tilePos.x)
+    const auto mapSize = GetMapSize();
+    for (TileCoordsXY tilePos = {}; tilePos.x < mapSize.x; ++tilePos.x)
     {
-        for (tilePos.y = 0; tilePos.y < gMapSize.y; ++tilePos.y)
+        for (tilePos.y = 0; tilePos.y < mapSize.y; ++tilePos.y)
         {
             for (auto* entrance : TileElementsView<EntranceElement>(tilePos.ToCoordsXY()))
             {
@@ -5595,9 +5643,10 @@ void Ride::IncreaseNumShelteredSections()
 
 void Ride::UpdateRideTypeForAllPieces()
 {
-    for (int32_t y = 0; y < gMapSize.y; y++)
+    const auto mapSize = GetMapSize();
+    for (int32_t y = 0; y < mapSize.y; y++)
     {
-        for (int32_t x = 0; x < gMapSize.x; x++)
+        for (int32_t x = 0; x < mapSize.x; x++)
         {
             auto* tileElement = MapGetFirstElementAt(TileCoordsXY(x, y));
             if (tileElement == nullptr)
@@ -17,6 +17,7 @@
 #include "../rct2/DATLimits.h"
 #include "../rct2/Limits.h"
 #include "../world/Map.h"
+#include "RideAnalytics.h"
 #include "RideColour.h"
 #include "RideEntry.h"
 #include "RideRatings.h"
@@ -279,6 +280,9 @@ struct Ride
     uint8_t current_issues;
     uint32_t last_issue_time;
 
+    // Runtime statistics history, does not require export/import.
+    RideAnalytics Analytics;
+
     // TO-DO: those friend functions are temporary, find a way to not access the private fields
     friend void UpdateSpiralSlide(Ride& ride);
     friend void UpdateChairlift(Ride& ride);
@@ -301,7 +305,6 @@ public:
     std::unique_ptr<RideMeasurement> measurement;
 
 private:
-    void Update();
     void UpdateQueueLength(StationIndex stationIndex);
     ResultWithMessage CreateVehicles(const CoordsXYE& element, bool isApplying);
     void MoveTrainsToBlockBrakes(TrackElement* firstBlock);
@@ -369,6 +372,8 @@ public:
     void FormatStatusTo(Formatter&) const;
 
     static void UpdateAll();
+    // Updates only this ride for one tick, as UpdateAll does for every ride
+    void Update();
     static bool NameExists(std::string_view name, RideId excludeRideId = RideId::GetNull());
 
     [[nodiscard]] std::unique_ptr<TrackDesign> SaveToTrackDesign(TrackDesignState& tds) const;
@@ -1009,6 +1014,8 @@ int32_t RideGetCount();
 void RideInitAll();
 void ResetAllRideBuildDates();
 void RideUpdateFavouritedStat();
+void RideUpdateAnalyticsQueues();
+bool RideValidateFavouritedStat();
 void RideCheckAllReachable();
 
 bool RideTryGetOriginElement(const Ride& ride, CoordsXYE* output);
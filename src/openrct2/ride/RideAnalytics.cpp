@@ -0,0 +1,50 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RideAnalytics.h"
+
+#include "Ride.h"
+
+#include <algorithm>
+#include <limits>
+
+static uint16_t RideAnalyticsClamp(int32_t value)
+{
+    return static_cast<uint16_t>(std::clamp<int32_t>(value, 0, std::numeric_limits<uint16_t>::max()));
+}
+
+void RideAnalytics::UpdateQueues(const Ride& ride)
+{
+    // Same as Ride::GetTotalQueueLength and Ride::GetMaxQueueTime but in a single pass over the stations
+    int32_t queueLength = 0;
+    uint8_t maxQueueTime = 0;
+    for (const auto& station : ride.GetStations())
+    {
+        if (!station.Entrance.IsNull())
+        {
+            queueLength += station.QueueLength;
+            maxQueueTime = std::max(maxQueueTime, station.QueueTime);
+        }
+    }
+    QueueLength = queueLength;
+    MaxQueueTime = maxQueueTime;
+}
+
+void RideAnalytics::AddSample(const Ride& ride)
+{
+    RideAnalyticsSample sample;
+    sample.Customers = ride.cur_num_customers;
+    sample.QueueLength = RideAnalyticsClamp(QueueLength);
+    sample.MaxQueueTime = RideAnalyticsClamp(MaxQueueTime);
+    sample.Breakdowns = CurrentBreakdowns;
+    sample.IncomePerHour = ride.income_per_hour;
+    History.push_back(sample);
+
+    CurrentBreakdowns = 0;
+}
@@ -0,0 +1,50 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../core/CircularBuffer.h"
+
+struct Ride;
+
+// Number of customer intervals (960 game ticks, about 30 seconds each) kept in the history
+constexpr size_t RideAnalyticsHistorySize = 64;
+
+/**
+ * The statistics of a ride over one customer interval.
+ */
+struct RideAnalyticsSample
+{
+    // Guests that entered the ride in the interval
+    uint16_t Customers{};
+    // Total queue length and longest queue time across all stations at the end of the interval
+    uint16_t QueueLength{};
+    uint16_t MaxQueueTime{};
+    // Breakdowns that started in the interval
+    uint16_t Breakdowns{};
+    money64 IncomePerHour{};
+};
+
+/**
+ * Runtime statistics of a ride, kept so the ride windows and plugins can read them without recalculating them. The
+ * queue values are refreshed every ride update and by RideUpdateAnalyticsQueues once a park is loaded, a sample is
+ * added to the history at the end of each customer interval. Not saved, the history starts empty when a park is loaded.
+ */
+struct RideAnalytics
+{
+    // Oldest sample first
+    CircularBuffer<RideAnalyticsSample, RideAnalyticsHistorySize> History;
+    int32_t QueueLength{};
+    int32_t MaxQueueTime{};
+    uint16_t CurrentBreakdowns{};
+
+    void UpdateQueues(const Ride& ride);
+    void AddSample(const Ride& ride);
+};
@@ -125,7 +125,8 @@ void RideRatingsUpdateAll()
         return;
 
     // NOTE: With the new save format more than one ride can be updated at once, but this has not yet been implemented.
-    // The SV6 format could store only a single state.
+    // The SV6 format could store only a single state. Updating more rides at once also changes when rides get their
+    // ratings, which would invalidate the recorded replays.
     ride_ratings_update_state(gRideRatingUpdateState);
 }
 
@@ -1480,9 +1481,10 @@ static int32_t ride_ratings_get_scenery_score(const Ride& ride)
     // Count surrounding scenery items
     int32_t numSceneryItems = 0;
     auto tileLocation = TileCoordsXY(location);
-    for (int32_t yy = std::max(tileLocation.y - 5, 0); yy <= std::min(tileLocation.y + 5, gMapSize.y - 1); yy++)
+    const auto mapSize = GetMapSize();
+    for (int32_t yy = std::max(tileLocation.y - 5, 0); yy <= std::min(tileLocation.y + 5, mapSize.y - 1); yy++)
     {
-        for (int32_t xx = std::max(tileLocation.x - 5, 0); xx <= std::min(tileLocation.x + 5, gMapSize.x - 1); xx++)
+        for (int32_t xx = std::max(tileLocation.x - 5, 0); xx <= std::min(tileLocation.x + 5, mapSize.x - 1); xx++)
         {
             // Count scenery items on this tile
             TileElement* tileElement = MapGetFirstElementAt(TileCoordsXY{ xx, yy });
@@ -57,6 +57,7 @@
 #include "../world/Scenery.h"
 #include "../world/Surface.h"
 #include "../world/Wall.h"
+#include "../world/World.h"
 #include "Ride.h"
 #include "RideData.h"
 #include "Track.h"
@@ -81,8 +82,6 @@ bool _trackDesignPlaceStateSceneryUnavailable = false;
 
 static bool _trackDesignPlaceStateEntranceExitPlaced{};
 
-static void TrackDesignPreviewClearMap();
-
 static uint8_t TrackDesignGetEntranceStyle(const Ride& ride)
 {
     const auto* stationObject = ride.GetStationObject();
@@ -2034,7 +2033,7 @@ static bool TrackDesignPlacePreview(TrackDesignState& tds, TrackDesign* td6, mon
     uint8_t backup_rotation = _currentTrackPieceDirection;
     uint32_t backup_park_flags = gParkFlags;
     gParkFlags &= ~PARK_FLAGS_FORBID_HIGH_CONSTRUCTION;
-    auto mapSize = TileCoordsXY{ gMapSize.x * 16, gMapSize.y * 16 };
+    auto mapSize = TileCoordsXY{ GetMapSize().x * 16, GetMapSize().y * 16 };
 
     _currentTrackPieceDirection = 0;
     int32_t z = TrackDesignGetZPlacement(
@@ -2085,13 +2084,38 @@ static bool TrackDesignPlacePreview(TrackDesignState& tds, TrackDesign* td6, mon
 
 #pragma region Track Design Preview
 
+/**
+ * Restores gCurrentRotation when drawing a preview ends, including when painting throws.
+ */
+class CurrentRotationScope final
+{
+public:
+    CurrentRotationScope()
+        : _previousRotation(gCurrentRotation)
+    {
+    }
+
+    ~CurrentRotationScope()
+    {
+        gCurrentRotation = _previousRotation;
+    }
+
+    CurrentRotationScope(const CurrentRotationScope&) = delete;
+    CurrentRotationScope& operator=(const CurrentRotationScope&) = delete;
+
+private:
+    uint8_t _previousRotation;
+};
+
 /**
  *
  *  rct2: 0x006D1EF0
  */
 void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels)
 {
-    StashMap();
+    // The design is placed on a scratch world so the park's map is left untouched
+    World previewWorld;
+    WorldScope previewWorldScope(previewWorld);
     TrackDesignPreviewClearMap();
 
     if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
@@ -2106,13 +2130,21 @@ void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels)
     uint8_t flags;
     if (!TrackDesignPlacePreview(tds, td6, &cost, &ride, &flags))
     {
-        std::fill_n(pixels, TRACK_PREVIEW_IMAGE_SIZE * 4, 0x00);
-        UnstashMap();
+        if (pixels != nullptr)
+        {
+            std::fill_n(pixels, TRACK_PREVIEW_IMAGE_SIZE * 4, 0x00);
+        }
         return;
     }
     td6->cost = cost;
     td6->track_flags = flags & 7;
 
+    if (pixels == nullptr)
+    {
+        ride->Delete();
+        return;
+    }
+
     CoordsXYZ centre = { (tds.PreviewMin.x + tds.PreviewMax.x) / 2 + 16, (tds.PreviewMin.y + tds.PreviewMax.y) / 2 + 16,
                          (tds.PreviewMin.z + tds.PreviewMax.z) / 2 };
 
@@ -2168,6 +2200,7 @@ void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels)
     auto drawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
     dpi.DrawingEngine = drawingEngine.get();
 
+    CurrentRotationScope rotationScope;
     const ScreenCoordsXY offset = { size_x / 2, size_y / 2 };
     for (uint8_t i = 0; i < 4; i++)
     {
@@ -2180,18 +2213,17 @@ void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels)
     }
 
     ride->Delete();
-    UnstashMap();
 }
 
 /**
  * Resets all the map elements to surface tiles for track preview.
  *  rct2: 0x006D1D9A
  */
-static void TrackDesignPreviewClearMap()
+void TrackDesignPreviewClearMap()
 {
     auto numTiles = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
 
-    gMapSize = TRACK_DESIGN_PREVIEW_MAP_SIZE;
+    SetMapSize(TRACK_DESIGN_PREVIEW_MAP_SIZE);
 
     // Reserve ~8 elements per tile
     std::vector<TileElement> tileElements;
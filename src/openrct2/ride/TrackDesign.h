@@ -233,7 +233,10 @@ int32_t TrackDesignGetZPlacement(TrackDesign* td6, Ride& ride, const CoordsXYZD&
 ///////////////////////////////////////////////////////////////////////////////
 // Track design preview
 ///////////////////////////////////////////////////////////////////////////////
+// Places the design to update its cost and flags, then draws it in all four rotations unless pixels is nullptr
 void TrackDesignDrawPreview(TrackDesign* td6, uint8_t* pixels);
+// Fills the current world with flat, owned surface tiles, without touching map animations or other park state
+void TrackDesignPreviewClearMap();
 
 ///////////////////////////////////////////////////////////////////////////////
 // Track design saving
@@ -0,0 +1,248 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackDesignEvaluator.h"
+
+#include "../Cheats.h"
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../actions/RideSetStatusAction.h"
+#include "../actions/TrackDesignAction.h"
+#include "../core/Json.hpp"
+#include "../object/ObjectManager.h"
+#include "../profiling/Profiling.h"
+#include "../rct12/RCT12.h"
+#include "../scenario/Scenario.h"
+#include "../world/Map.h"
+#include "../world/Park.h"
+#include "../world/Surface.h"
+#include "../world/World.h"
+#include "Ride.h"
+#include "TrackDesign.h"
+#include "Vehicle.h"
+
+#include <vector>
+
+using namespace OpenRCT2;
+
+/**
+ * Sets the park up for a test run without money, research or breakdowns, and restores the caller's settings, random
+ * number state and ticks when the evaluation ends. Objects loaded for the design are unloaded again and the tested
+ * ride is deleted.
+ */
+class TrackDesignEvaluationScope final
+{
+public:
+    TrackDesignEvaluationScope()
+        : _screenFlags(gScreenFlags)
+        , _parkFlags(gParkFlags)
+        , _sandboxMode(gCheatsSandboxMode)
+        , _ignoreResearchStatus(gCheatsIgnoreResearchStatus)
+        , _disableAllBreakdowns(gCheatsDisableAllBreakdowns)
+        , _currentTicks(gCurrentTicks)
+        , _randState(ScenarioRandState())
+    {
+        gScreenFlags = SCREEN_FLAGS_PLAYING;
+        gParkFlags |= PARK_FLAGS_NO_MONEY;
+
+        // Build anywhere and keep the test run free of breakdowns
+        gCheatsSandboxMode = true;
+        gCheatsIgnoreResearchStatus = true;
+        gCheatsDisableAllBreakdowns = true;
+    }
+
+    ~TrackDesignEvaluationScope()
+    {
+        auto* ride = GetRide(_rideId);
+        if (ride != nullptr)
+        {
+            ride->Delete();
+        }
+        if (!_loadedObjects.empty())
+        {
+            GetContext()->GetObjectManager().UnloadObjects(_loadedObjects);
+        }
+
+        gScreenFlags = _screenFlags;
+        gParkFlags = _parkFlags;
+        gCheatsSandboxMode = _sandboxMode;
+        gCheatsIgnoreResearchStatus = _ignoreResearchStatus;
+        gCheatsDisableAllBreakdowns = _disableAllBreakdowns;
+        gCurrentTicks = _currentTicks;
+        ScenarioRandSeed(_randState.s0, _randState.s1);
+    }
+
+    TrackDesignEvaluationScope(const TrackDesignEvaluationScope&) = delete;
+    TrackDesignEvaluationScope& operator=(const TrackDesignEvaluationScope&) = delete;
+
+    void LoadObject(const ObjectEntryDescriptor& entry)
+    {
+        auto& objectManager = GetContext()->GetObjectManager();
+        if (objectManager.GetLoadedObject(entry) == nullptr && objectManager.LoadObject(entry) != nullptr)
+        {
+            _loadedObjects.push_back(entry);
+        }
+    }
+
+    void SetRide(RideId rideId)
+    {
+        _rideId = rideId;
+    }
+
+private:
+    uint8_t _screenFlags;
+    uint64_t _parkFlags;
+    bool _sandboxMode;
+    bool _ignoreResearchStatus;
+    bool _disableAllBreakdowns;
+    uint32_t _currentTicks;
+    random_engine_t::state_type _randState;
+    std::vector<ObjectEntryDescriptor> _loadedObjects;
+    RideId _rideId = RideId::GetNull();
+};
+
+static void TrackDesignEvaluateLoadObjects(TrackDesignEvaluationScope& scope, const TrackDesign& td)
+{
+    if (td.vehicle_object.HasValue())
+    {
+        scope.LoadObject(td.vehicle_object);
+    }
+    for (const auto& scenery : td.scenery_elements)
+    {
+        if (scenery.scenery_object.HasValue())
+        {
+            scope.LoadObject(scenery.scenery_object);
+        }
+    }
+    scope.LoadObject(ObjectEntryDescriptor(ObjectType::Station, GetStationIdentifierFromStyle(td.entrance_style)));
+}
+
+static int32_t TrackDesignEvaluateGetPlacementZ(TrackDesign& td, const CoordsXY& loc)
+{
+    auto surfaceElement = MapGetSurfaceElementAt(loc);
+    auto z = surfaceElement != nullptr ? surfaceElement->GetBaseZ() : 0;
+    return z + TrackDesignGetZPlacement(&td, *GetOrAllocateRide(PreviewRideId), { loc, z, 0 });
+}
+
+static void TrackDesignEvaluateReadStatistics(TrackDesignEvaluation& evaluation, const Ride& ride)
+{
+    evaluation.Ratings = ride.ratings;
+    evaluation.MaxSpeed = (ride.max_speed * 9) >> 18;
+    evaluation.AverageSpeed = (ride.average_speed * 9) >> 18;
+    evaluation.RideTime = ride.GetTotalTime();
+    evaluation.RideLength = ride.GetTotalLength() >> 16;
+    evaluation.MaxPositiveVerticalG = ride.max_positive_vertical_g;
+    evaluation.MaxNegativeVerticalG = ride.max_negative_vertical_g;
+    evaluation.MaxLateralG = ride.max_lateral_g;
+    evaluation.TotalAirTime = ride.total_air_time * 3;
+    evaluation.Drops = ride.drops & 0x3F;
+    evaluation.HighestDropHeight = (ride.highest_drop_height * 3) / 4;
+    evaluation.Inversions = ride.inversions;
+    evaluation.Holes = ride.holes;
+}
+
+TrackDesignEvaluation TrackDesignEvaluate(const u8string& path, uint32_t maxTicks)
+{
+    PROFILED_FUNCTION();
+
+    TrackDesignEvaluation evaluation;
+    evaluation.Path = path;
+
+    auto td = TrackDesignImport(path.c_str());
+    if (td == nullptr)
+    {
+        evaluation.Error = "Unable to load track design";
+        return evaluation;
+    }
+    evaluation.Name = td->name;
+
+    // The design is placed and tested on a scratch world, so the caller's map and entities are left untouched
+    World world;
+    WorldScope worldScope(world);
+    TrackDesignPreviewClearMap();
+
+    TrackDesignEvaluationScope scope;
+    TrackDesignEvaluateLoadObjects(scope, *td);
+
+    const auto loc = TileCoordsXY{ GetMapSize().x / 2, GetMapSize().y / 2 }.ToCoordsXY();
+    const auto z = TrackDesignEvaluateGetPlacementZ(*td, loc);
+
+    // Executed as nested actions, so nothing is paid, sent to other players or recorded
+    auto placeAction = TrackDesignAction({ loc, z, 0 }, *td);
+    auto placeResult = GameActions::ExecuteNested(&placeAction);
+    if (placeResult.Error != GameActions::Status::Ok)
+    {
+        evaluation.Error = "Unable to place track design: " + placeResult.GetErrorMessage();
+        return evaluation;
+    }
+
+    const auto rideId = placeResult.GetData<RideId>();
+    scope.SetRide(rideId);
+    auto statusAction = RideSetStatusAction(rideId, RideStatus::Testing);
+    auto statusResult = GameActions::ExecuteNested(&statusAction);
+    if (statusResult.Error != GameActions::Status::Ok)
+    {
+        evaluation.Error = "Unable to test ride: " + statusResult.GetErrorMessage();
+        return evaluation;
+    }
+
+    // Only the tested ride and its vehicles are updated, the caller's rides, guests and date do not move on
+    auto* ride = GetRide(rideId);
+    while (ride != nullptr && !(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED) && evaluation.TestTicks < maxTicks)
+    {
+        VehicleUpdateAll();
+        ride->Update();
+        gCurrentTicks++;
+        evaluation.TestTicks++;
+        ride = GetRide(rideId);
+    }
+
+    if (ride == nullptr || !(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
+    {
+        evaluation.Error = "Test run did not complete";
+        return evaluation;
+    }
+
+    RideRatingsUpdateRide(*ride);
+    TrackDesignEvaluateReadStatistics(evaluation, *ride);
+    return evaluation;
+}
+
+json_t TrackDesignEvaluationToJson(const TrackDesignEvaluation& evaluation)
+{
+    json_t result = {
+        { "path", evaluation.Path },
+        { "name", evaluation.Name },
+    };
+    if (!evaluation.IsValid())
+    {
+        result["error"] = evaluation.Error;
+        return result;
+    }
+
+    result["excitement"] = evaluation.Ratings.Excitement / 100.0;
+    result["intensity"] = evaluation.Ratings.Intensity / 100.0;
+    result["nausea"] = evaluation.Ratings.Nausea / 100.0;
+    result["stats"] = {
+        { "maxSpeed", evaluation.MaxSpeed },
+        { "averageSpeed", evaluation.AverageSpeed },
+        { "rideTime", evaluation.RideTime },
+        { "rideLength", evaluation.RideLength },
+        { "maxPositiveVerticalG", evaluation.MaxPositiveVerticalG / 100.0 },
+        { "maxNegativeVerticalG", evaluation.MaxNegativeVerticalG / 100.0 },
+        { "maxLateralG", evaluation.MaxLateralG / 100.0 },
+        { "airTime", evaluation.TotalAirTime / 100.0 },
+        { "drops", evaluation.Drops },
+        { "highestDropHeight", evaluation.HighestDropHeight },
+        { "inversions", evaluation.Inversions },
+        { "holes", evaluation.Holes },
+        { "testTicks", evaluation.TestTicks },
+    };
+    return result;
+}
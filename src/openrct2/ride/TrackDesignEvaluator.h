@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../core/JsonFwd.hpp"
+#include "../core/String.hpp"
+#include "RideRatings.h"
+
+// Default limit of game ticks a test run may take before the design is reported as failed
+constexpr uint32_t TrackDesignEvaluateDefaultMaxTicks = 40 * 60 * 20;
+
+struct TrackDesignEvaluation
+{
+    u8string Path;
+    u8string Name;
+    // Empty when the design was placed, tested and rated
+    u8string Error;
+    RatingTuple Ratings{};
+    // Statistics of the test run, in the units the ride window displays them in
+    int32_t MaxSpeed{};
+    int32_t AverageSpeed{};
+    int32_t RideTime{};
+    int32_t RideLength{};
+    fixed16_2dp MaxPositiveVerticalG{};
+    fixed16_2dp MaxNegativeVerticalG{};
+    fixed16_2dp MaxLateralG{};
+    fixed32_2dp TotalAirTime{};
+    int32_t Drops{};
+    int32_t HighestDropHeight{};
+    int32_t Inversions{};
+    int32_t Holes{};
+    uint32_t TestTicks{};
+
+    bool IsValid() const
+    {
+        return Error.empty();
+    }
+};
+
+/**
+ * Places the track design on an empty scratch world, runs a test of the ride and calculates its ratings without any
+ * guests, breakdowns or finances involved. The current park is left as it was. Designs share the rides and objects of
+ * the process, so they are rated one at a time; trackdesign rate spreads designs across processes instead.
+ */
+[[nodiscard]] TrackDesignEvaluation TrackDesignEvaluate(
+    const u8string& path, uint32_t maxTicks = TrackDesignEvaluateDefaultMaxTicks);
+
+[[nodiscard]] json_t TrackDesignEvaluationToJson(const TrackDesignEvaluation& evaluation);
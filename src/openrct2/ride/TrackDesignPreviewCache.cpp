@@ -0,0 +1,300 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackDesignPreviewCache.h"
+
+#include "../Context.h"
+#include "../Diagnostic.h"
+#include "../PlatformEnvironment.h"
+#include "../core/Crypt.h"
+#include "../core/File.h"
+#include "../core/MemoryStream.h"
+#include "../core/Path.hpp"
+#include "../object/ObjectList.h"
+#include "../object/ObjectManager.h"
+#include "../rct12/SawyerChunkReader.h"
+#include "../rct12/SawyerChunkWriter.h"
+#include "TrackDesign.h"
+
+#include <chrono>
+#include <cstring>
+#include <random>
+
+using namespace OpenRCT2;
+
+constexpr uint32_t PREVIEW_CACHE_MAGIC_NUMBER = 0x56504454; // TDPV
+// Increment when the way previews are drawn or stored changes
+constexpr uint32_t PREVIEW_CACHE_VERSION = 2;
+constexpr size_t PREVIEW_CACHE_IMAGE_SIZE = TRACK_PREVIEW_IMAGE_SIZE * 4;
+
+struct PreviewCacheHeader
+{
+    uint32_t MagicNumber = PREVIEW_CACHE_MAGIC_NUMBER;
+    uint32_t Version = PREVIEW_CACHE_VERSION;
+    money32 Cost{};
+    uint32_t TrackFlags{};
+};
+
+static std::vector<uint8_t> EncodePreview(const uint8_t* pixels, const TrackDesignPreviewCache::Placement& placement)
+{
+    PreviewCacheHeader header;
+    header.Cost = placement.Cost;
+    header.TrackFlags = placement.TrackFlags;
+
+    MemoryStream ms;
+    ms.WriteValue(header);
+    SawyerChunkWriter writer(&ms);
+    writer.WriteChunk(pixels, PREVIEW_CACHE_IMAGE_SIZE, SAWYER_ENCODING::RLE);
+
+    const auto* data = static_cast<const uint8_t*>(ms.GetData());
+    return std::vector<uint8_t>(data, data + ms.GetLength());
+}
+
+static bool DecodePreview(const std::vector<uint8_t>& data, uint8_t* pixels, TrackDesignPreviewCache::Placement& placement)
+{
+    try
+    {
+        MemoryStream ms(data.data(), data.size());
+        auto header = ms.ReadValue<PreviewCacheHeader>();
+        SawyerChunkReader reader(&ms);
+        reader.ReadChunk(pixels, PREVIEW_CACHE_IMAGE_SIZE);
+
+        placement.Cost = header.Cost;
+        placement.TrackFlags = static_cast<uint8_t>(header.TrackFlags);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to decode track design preview: %s", e.what());
+        return false;
+    }
+}
+
+static bool IsValidPreview(const std::vector<uint8_t>& data)
+{
+    PreviewCacheHeader header;
+    if (data.size() <= sizeof(header))
+    {
+        return false;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    return header.MagicNumber == PREVIEW_CACHE_MAGIC_NUMBER && header.Version == PREVIEW_CACHE_VERSION;
+}
+
+TrackDesignPreviewCache::TrackDesignPreviewCache()
+    : TrackDesignPreviewCache(
+        GetContext()->GetPlatformEnvironment()->GetDirectoryPath(DIRBASE::CACHE, DIRID::TRACK_PREVIEW_CACHE),
+        GetLoadedObjectsKey())
+{
+    _paintMissing = true;
+}
+
+TrackDesignPreviewCache::TrackDesignPreviewCache(const u8string& directory, const u8string& objectsKey)
+    : _directory(directory)
+    , _objectsKey(objectsKey)
+{
+}
+
+TrackDesignPreviewCache::~TrackDesignPreviewCache()
+{
+    // Abandon the prefetch but finish writing the previews stored so far
+    _prefetchGeneration++;
+    _jobPool.Join();
+}
+
+void TrackDesignPreviewCache::Prefetch(const std::vector<u8string>& paths)
+{
+    const auto generation = ++_prefetchGeneration;
+    _jobPool.AddTask([this, paths, generation]() {
+        for (const auto& path : paths)
+        {
+            if (_prefetchGeneration != generation)
+            {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_entries.find(path) != _entries.end())
+                {
+                    continue;
+                }
+            }
+
+            auto entry = Load(path);
+            if (entry.Data.empty() && _paintMissing)
+            {
+                entry = Paint(path, generation);
+            }
+            std::lock_guard<std::mutex> lock(_mutex);
+            _entries.emplace(path, std::move(entry));
+        }
+    });
+}
+
+bool TrackDesignPreviewCache::Get(const u8string& path, uint8_t* pixels, Placement& placement)
+{
+    std::vector<uint8_t> data;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto it = _entries.find(path);
+        if (it == _entries.end())
+        {
+            // Not prefetched yet, look the design up right away
+            lock.unlock();
+            auto entry = Load(path);
+            lock.lock();
+            it = _entries.emplace(path, std::move(entry)).first;
+        }
+        data = it->second.Data;
+    }
+    return !data.empty() && DecodePreview(data, pixels, placement);
+}
+
+void TrackDesignPreviewCache::Store(const u8string& path, const uint8_t* pixels, const Placement& placement)
+{
+    auto data = EncodePreview(pixels, placement);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _entries[path].Data = data;
+    }
+    _jobPool.AddTask([this, path, data]() { Write(path, data); });
+}
+
+u8string TrackDesignPreviewCache::GetLoadedObjectsKey()
+{
+    auto hash = Crypt::CreateFNV1a();
+    auto loadedObjects = GetContext()->GetObjectManager().GetLoadedObjects();
+    for (const auto& descriptor : loadedObjects)
+    {
+        auto name = descriptor.GetName();
+        hash->Update(name.data(), name.size());
+        hash->Update("", 1);
+    }
+
+    u8string key;
+    for (auto b : hash->Finish())
+    {
+        key += String::StdFormat("%02x", b);
+    }
+    return key;
+}
+
+u8string TrackDesignPreviewCache::GetCachePath(const u8string& path) const
+{
+    auto designData = File::ReadAllBytes(path);
+    auto hash = Crypt::CreateFNV1a()
+                    ->Update(designData.data(), designData.size())
+                    ->Update(_objectsKey.data(), _objectsKey.size())
+                    ->Finish();
+
+    u8string name;
+    for (auto b : hash)
+    {
+        name += String::StdFormat("%02x", b);
+    }
+    return Path::Combine(_directory, name + u8".dat");
+}
+
+TrackDesignPreviewCache::Entry TrackDesignPreviewCache::Load(const u8string& path) const
+{
+    Entry entry;
+    try
+    {
+        auto cachePath = GetCachePath(path);
+        if (File::Exists(cachePath))
+        {
+            entry.Data = File::ReadAllBytes(cachePath);
+            if (!IsValidPreview(entry.Data))
+            {
+                entry.Data.clear();
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to load cached preview of '%s': %s", path.c_str(), e.what());
+        entry.Data.clear();
+    }
+    return entry;
+}
+
+TrackDesignPreviewCache::Entry TrackDesignPreviewCache::Paint(const u8string& path, uint32_t generation)
+{
+    Entry entry;
+    std::unique_lock<std::timed_mutex> frameLock(GetContext()->GetFrameMutex(), std::defer_lock);
+    while (!frameLock.try_lock_for(std::chrono::milliseconds(10)))
+    {
+        // The game loop may be waiting for this cache to be destroyed
+        if (_prefetchGeneration != generation)
+        {
+            return entry;
+        }
+    }
+
+    {
+        // The window may have painted the design while this thread was waiting
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_entries.find(path) != _entries.end())
+        {
+            return entry;
+        }
+    }
+
+    auto td = TrackDesignImport(path.c_str());
+    if (td == nullptr)
+    {
+        return entry;
+    }
+
+    // Cached previews always show the design's scenery
+    std::vector<uint8_t> pixels(PREVIEW_CACHE_IMAGE_SIZE);
+    const auto sceneryToggle = gTrackDesignSceneryToggle;
+    gTrackDesignSceneryToggle = false;
+    TrackDesignDrawPreview(td.get(), pixels.data());
+    gTrackDesignSceneryToggle = sceneryToggle;
+    frameLock.unlock();
+
+    // Like the window, only cache previews with all of their scenery. In the track manager the scenery depends on
+    // which objects are installed, not only on the objects key.
+    if (td->track_flags & TRACK_DESIGN_FLAG_SCENERY_UNAVAILABLE)
+    {
+        return entry;
+    }
+
+    entry.Data = EncodePreview(pixels.data(), { td->cost, td->track_flags });
+    Write(path, entry.Data);
+    return entry;
+}
+
+void TrackDesignPreviewCache::Write(const u8string& path, const std::vector<uint8_t>& data) const
+{
+    u8string tempPath;
+    try
+    {
+        auto cachePath = GetCachePath(path);
+        tempPath = cachePath + u8"." + std::to_string(std::random_device{}()) + u8".tmp";
+
+        Path::CreateDirectory(_directory);
+        File::WriteAllBytes(tempPath, data.data(), data.size());
+
+        // Another instance may have stored the same design in the meantime, either copy is valid
+        if (!File::Move(tempPath, cachePath))
+        {
+            File::Delete(tempPath);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to cache preview of '%s': %s", path.c_str(), e.what());
+        if (!tempPath.empty())
+        {
+            File::Delete(tempPath);
+        }
+    }
+}
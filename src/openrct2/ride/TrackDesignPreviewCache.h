@@ -0,0 +1,97 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../core/JobPool.h"
+#include "../core/String.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Track design previews as drawn by TrackDesignDrawPreview, run-length encoded and kept both in memory and in the
+ * user cache together with the cost and flags of the placed design. Entries are keyed by a hash of the design file and
+ * of the objects it was placed with, so a design only has to be placed and painted once.
+ *
+ * Previews are loaded, or painted if they are not cached yet, on a background thread before they are shown. Placing a
+ * design uses the shared preview ride, loads scenery objects and changes gCurrentRotation, so the background thread
+ * only paints between frames of the game loop while it holds the frame mutex of the context.
+ */
+class TrackDesignPreviewCache final
+{
+public:
+    // The results of placing the design for its preview
+    struct Placement
+    {
+        money32 Cost{};
+        uint8_t TrackFlags{};
+    };
+
+private:
+    struct Entry
+    {
+        // Empty if the design has no cached preview
+        std::vector<uint8_t> Data;
+    };
+
+    u8string _directory;
+    u8string _objectsKey;
+    bool _paintMissing{};
+    std::mutex _mutex;
+    std::unordered_map<u8string, Entry> _entries;
+    std::atomic<uint32_t> _prefetchGeneration{};
+    // Declared last so the worker has stopped before the entries are destroyed
+    JobPool _jobPool{ 1 };
+
+public:
+    /**
+     * Caches the previews of designs placed with the objects that are currently loaded, in the user cache. Previews
+     * that are not cached yet are painted on the background thread.
+     */
+    TrackDesignPreviewCache();
+
+    /**
+     * Caches previews in the given directory. Only previews that were stored with the same objects key are shared and
+     * the cache never paints previews itself.
+     */
+    TrackDesignPreviewCache(const u8string& directory, const u8string& objectsKey);
+    ~TrackDesignPreviewCache();
+
+    /**
+     * Loads or paints the previews of the given designs on the background thread, in order. Replaces the designs of
+     * any earlier call that have not been loaded yet.
+     */
+    void Prefetch(const std::vector<u8string>& paths);
+
+    /**
+     * Decodes the cached preview of the design into pixels, which must hold TRACK_PREVIEW_IMAGE_SIZE * 4 bytes.
+     * Returns false if the design has no cached preview.
+     */
+    bool Get(const u8string& path, uint8_t* pixels, Placement& placement);
+
+    /**
+     * Caches the preview of the design, the user cache is written to on the background thread.
+     */
+    void Store(const u8string& path, const uint8_t* pixels, const Placement& placement);
+
+    /**
+     * A hash of the identifiers of all loaded objects.
+     */
+    static u8string GetLoadedObjectsKey();
+
+private:
+    u8string GetCachePath(const u8string& path) const;
+    Entry Load(const u8string& path) const;
+    Entry Paint(const u8string& path, uint32_t generation);
+    void Write(const u8string& path, const std::vector<uint8_t>& data) const;
+};
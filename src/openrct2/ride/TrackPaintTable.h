@@ -0,0 +1,135 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../paint/Paint.h"
+#include "../paint/Supports.h"
+#include "../paint/tile_element/Paint.TileElement.h"
+#include "TrackPaint.h"
+
+#include <array>
+
+// Used as the tunnel type of directions that do not push a tunnel
+constexpr uint8_t TrackPaintNoTunnel = TUNNEL_TYPE_COUNT;
+// Used as the vertical tunnel height offset of pieces that do not set a vertical tunnel
+constexpr int16_t TrackPaintNoVerticalTunnel = INT16_MIN;
+
+enum class TrackPaintSupportsMode : uint8_t
+{
+    None,
+    // Painted on every tile of the piece
+    Always,
+    // Only painted on the tiles TrackPaintUtilShouldPaintSupports allows
+    Spaced,
+};
+
+/**
+ * A track sprite painted with the track colour scheme, the offset and bound box are relative to the track height.
+ */
+struct TrackPaintSprite
+{
+    uint32_t ImageIndex{};
+    CoordsXYZ Offset{};
+    BoundBoxXYZ BoundBox{};
+};
+
+struct TrackPaintTunnel
+{
+    uint8_t Type = TrackPaintNoTunnel;
+    int16_t HeightOffset{};
+};
+
+struct TrackPaintDirection
+{
+    // Painted in order, an image index of 0 ends the list
+    std::array<TrackPaintSprite, 2> Sprites{};
+    // Pushed with PaintUtilPushTunnelRotated
+    TrackPaintTunnel Tunnel{};
+    uint8_t SupportSegment{};
+};
+
+struct TrackPaintSupports
+{
+    TrackPaintSupportsMode Mode = TrackPaintSupportsMode::None;
+    uint8_t Type{};
+    int16_t HeightOffset{};
+};
+
+/**
+ * Describes how a track piece made of plain sprites, tunnels and metal supports is painted, so that the piece can be
+ * painted by TrackPaintPieceFunction rather than by a hand-written function. Heights are relative to the track height.
+ */
+struct TrackPaintPiece
+{
+    std::array<TrackPaintDirection, NumOrthogonalDirections> Directions{};
+    uint16_t Segments{};
+    TrackPaintSupports Supports{};
+    int16_t VerticalTunnelHeightOffset = TrackPaintNoVerticalTunnel;
+    int16_t GeneralSupportHeightOffset{};
+    // Multi-tile pieces drawn entirely by their first sequence
+    bool FirstSequenceOnly{};
+};
+
+inline void TrackPaintPieceDraw(
+    PaintSession& session, const TrackPaintPiece& piece, uint8_t trackSequence, uint8_t direction, int32_t height)
+{
+    if (piece.FirstSequenceOnly && trackSequence != 0)
+    {
+        return;
+    }
+
+    const auto& entry = piece.Directions[direction];
+    for (const auto& sprite : entry.Sprites)
+    {
+        if (sprite.ImageIndex == 0)
+        {
+            break;
+        }
+        const CoordsXYZ heightOffset{ 0, 0, height };
+        PaintAddImageAsParentRotated(
+            session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(sprite.ImageIndex),
+            sprite.Offset + heightOffset, { sprite.BoundBox.offset + heightOffset, sprite.BoundBox.length });
+    }
+
+    // Supports are painted after the segment heights are set as they are placed against them
+    PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(piece.Segments, direction), 0xFFFF, 0);
+    const auto& supports = piece.Supports;
+    if (supports.Mode == TrackPaintSupportsMode::Always
+        || (supports.Mode == TrackPaintSupportsMode::Spaced && TrackPaintUtilShouldPaintSupports(session.MapPosition)))
+    {
+        MetalASupportsPaintSetup(
+            session, supports.Type, entry.SupportSegment, 0, height + supports.HeightOffset,
+            session.TrackColours[SCHEME_SUPPORTS]);
+    }
+
+    if (entry.Tunnel.Type != TrackPaintNoTunnel)
+    {
+        PaintUtilPushTunnelRotated(session, direction, height + entry.Tunnel.HeightOffset, entry.Tunnel.Type);
+    }
+    if (piece.VerticalTunnelHeightOffset != TrackPaintNoVerticalTunnel)
+    {
+        PaintUtilSetVerticalTunnel(session, height + piece.VerticalTunnelHeightOffset);
+    }
+    PaintUtilSetGeneralSupportHeight(session, height + piece.GeneralSupportHeightOffset, 0x20);
+}
+
+/**
+ * Track paint function for a table described piece. The piece is a template argument so each piece gets its own
+ * function that can be returned from the ride's TRACK_PAINT_FUNCTION_GETTER, mirrored pieces such as the down slopes
+ * reuse the table of their counterpart with their direction rotated by TDirectionOffset.
+ */
+template<const TrackPaintPiece& TPiece, uint8_t TDirectionOffset = 0>
+void TrackPaintPieceFunction(
+    PaintSession& session, [[maybe_unused]] const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
+    [[maybe_unused]] const TrackElement& trackElement)
+{
+    TrackPaintPieceDraw(session, TPiece, trackSequence, (direction + TDirectionOffset) & 3, height);
+}
@@ -19,6 +19,7 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Memory.hpp"
+#include "../core/Parallel.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/Particle.h"
 #include "../entity/Yaw.hpp"
@@ -26,6 +27,7 @@
 #include "../localisation/Formatter.h"
 #include "../localisation/Localisation.h"
 #include "../management/NewsItem.h"
+#include "../network/network.h"
 #include "../object/SmallSceneryEntry.h"
 #include "../platform/Platform.h"
 #include "../profiling/Profiling.h"
@@ -41,6 +43,7 @@
 #include "../world/Scenery.h"
 #include "../world/Surface.h"
 #include "../world/Wall.h"
+#include "../world/World.h"
 #include "CableLift.h"
 #include "Ride.h"
 #include "RideData.h"
@@ -49,10 +52,13 @@
 #include "TrackData.h"
 #include "TrainManager.h"
 #include "VehicleData.h"
+#include "VehicleMotionTables.h"
 #include "VehicleSubpositionData.h"
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
+#include <map>
 
 using namespace OpenRCT2::Audio;
 using namespace OpenRCT2::TrackMetaData;
@@ -65,17 +71,28 @@ constexpr int16_t VEHICLE_MAX_SPIN_SPEED_WATER_RIDE = 512;
 constexpr int16_t VEHICLE_MIN_SPIN_SPEED_WATER_RIDE = -VEHICLE_MAX_SPIN_SPEED_WATER_RIDE;
 constexpr int16_t VEHICLE_STOPPING_SPIN_SPEED = 600;
 
-Vehicle* gCurrentVehicle;
+// State of the train being updated, per thread as trains of different rides can be updated in parallel
+thread_local Vehicle* gCurrentVehicle;
+
+static thread_local uint8_t _vehicleBreakdown;
+thread_local StationIndex _vehicleStationIndex;
+thread_local uint32_t _vehicleMotionTrackFlags;
+thread_local int32_t _vehicleVelocityF64E08;
+thread_local int32_t _vehicleVelocityF64E0C;
+thread_local int32_t _vehicleUnkF64E10;
+thread_local uint8_t _vehicleF64E2C;
+thread_local Vehicle* _vehicleFrontVehicle;
+thread_local CoordsXYZ _vehicleCurPosition;
+
+// Effects of a train's update that reach outside of its ride, recorded while rides are updated in parallel
+struct VehicleDeferredEffects
+{
+    std::vector<std::function<void()>> Effects;
+    // Set when the rest of the ride depends on an effect, the remaining trains of the ride are then updated serially
+    bool Interrupted{};
+};
 
-static uint8_t _vehicleBreakdown;
-StationIndex _vehicleStationIndex;
-uint32_t _vehicleMotionTrackFlags;
-int32_t _vehicleVelocityF64E08;
-int32_t _vehicleVelocityF64E0C;
-int32_t _vehicleUnkF64E10;
-uint8_t _vehicleF64E2C;
-Vehicle* _vehicleFrontVehicle;
-CoordsXYZ _vehicleCurPosition;
+static thread_local VehicleDeferredEffects* _vehicleDeferredEffects = nullptr;
 
 static constexpr const OpenRCT2::Audio::SoundId _screamSet0[] = {
     OpenRCT2::Audio::SoundId::Scream8,
@@ -525,6 +542,45 @@ static void InvokeVehicleCrashHook(const EntityId vehicleId, const std::string_v
 }
 #endif
 
+/**
+ * Runs an effect of a train's update that reaches outside of its ride. While rides are updated in parallel the effect
+ * is recorded instead and run once all rides have been updated, in the order the trains would have been updated in.
+ */
+static void VehicleRunEffect(std::function<void()>&& effect)
+{
+    if (_vehicleDeferredEffects != nullptr)
+    {
+        _vehicleDeferredEffects->Effects.push_back(std::move(effect));
+    }
+    else
+    {
+        effect();
+    }
+}
+
+/**
+ * Like VehicleRunEffect, for effects the rest of the ride's update depends on, such as crashes. Must be the last thing
+ * the train does before its sounds are updated.
+ */
+static void VehicleRunBlockingEffect(std::function<void()>&& effect)
+{
+    if (_vehicleDeferredEffects != nullptr)
+    {
+        _vehicleDeferredEffects->Interrupted = true;
+    }
+    VehicleRunEffect(std::move(effect));
+}
+
+static void VehiclePlay3D(OpenRCT2::Audio::SoundId soundId, const CoordsXYZ& loc)
+{
+    VehicleRunEffect([soundId, loc]() { OpenRCT2::Audio::Play3D(soundId, loc); });
+}
+
+static void VehicleInvalidateRideWindow(RideId rideId)
+{
+    VehicleRunEffect([rideId]() { WindowInvalidateByNumber(WindowClass::Ride, rideId.ToUnderlying()); });
+}
+
 static bool vehicle_move_info_valid(
     VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction, int32_t offset)
 {
@@ -1227,6 +1283,126 @@ void VehicleSoundsUpdate()
  *
  *  rct2: 0x006D4204
  */
+/**
+ * Whether the trains of a ride only touch the ride itself, its track and their own cars while they are updated, apart
+ * from the effects deferred through VehicleRunEffect. Rides that share anything with the rest of the park, such as level
+ * crossings or cable lifts, are updated serially.
+ */
+static bool VehicleRideCanUpdateInParallel(const Ride& ride)
+{
+    if (ride.type >= RIDE_TYPE_COUNT || ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SUPPORTS_LEVEL_CROSSINGS))
+        return false;
+
+    constexpr uint32_t serialLifecycleFlags = RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN
+        | RIDE_LIFECYCLE_CRASHED | RIDE_LIFECYCLE_CABLE_LIFT;
+    return !(ride.lifecycle_flags & serialLifecycleFlags) && ride.mode != RideMode::BoatHire;
+}
+
+/**
+ * Only travelling trains qualify, anything that boards or unloads guests, draws random numbers (go karts, mini golf,
+ * boats, crashes in progress) or looks for vehicles of other rides is updated serially.
+ */
+static bool VehicleTrainCanUpdateInParallel(const Vehicle& head)
+{
+    if (head.IsCableLift() || head.status != Vehicle::Status::Travelling)
+        return false;
+
+    constexpr uint64_t serialCarFlags = CAR_ENTRY_FLAG_MINI_GOLF | CAR_ENTRY_FLAG_GO_KART
+        | CAR_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION;
+    for (const Vehicle* car = &head; car != nullptr; car = GetEntity<Vehicle>(car->next_vehicle_on_train))
+    {
+        const auto* carEntry = car->Entry();
+        if (carEntry == nullptr || (carEntry->flags & serialCarFlags))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Updates the trains of rides that keep to themselves concurrently, one task per ride. Afterwards all trains are walked in
+ * their original order: the remaining trains are updated at their position, and so are the spatial index moves, viewport
+ * invalidations, effects and sounds of the trains updated concurrently. The serial trains only look up vehicles of other
+ * rides for boat hire collisions, which never consider the cars updated concurrently, so the park ends up exactly as if
+ * all trains had been updated one after another.
+ */
+static void VehicleUpdateAllParallel()
+{
+    struct TrainUpdate
+    {
+        Vehicle* Head{};
+        bool Updated{};
+        bool UpdateSound{};
+        VehicleDeferredEffects Deferred;
+        std::vector<DeferredEntityMove> Moves;
+        ViewportInvalidationList Invalidations;
+    };
+
+    std::vector<TrainUpdate> trains;
+    std::map<RideId, std::vector<size_t>> trainsByRide;
+    for (auto vehicle : TrainManager::View())
+    {
+        trainsByRide[vehicle->ride].push_back(trains.size());
+        trains.emplace_back().Head = vehicle;
+    }
+
+    // Trains of one ride depend on each other, a ride is only updated in parallel if all of its trains can be
+    std::vector<std::vector<size_t>> rides;
+    for (auto& [rideId, rideTrains] : trainsByRide)
+    {
+        auto* ride = GetRide(rideId);
+        if (ride == nullptr || !VehicleRideCanUpdateInParallel(*ride))
+            continue;
+
+        if (std::all_of(rideTrains.begin(), rideTrains.end(), [&trains](size_t trainIndex) {
+                return VehicleTrainCanUpdateInParallel(*trains[trainIndex].Head);
+            }))
+        {
+            rides.push_back(std::move(rideTrains));
+        }
+    }
+
+    auto& world = OpenRCT2::GetCurrentWorld();
+    OpenRCT2::Parallel::For(rides.size(), [&trains, &rides, &world](size_t rideIndex) {
+        PROFILED_FUNCTION();
+
+        OpenRCT2::WorldScope worldScope(world);
+        for (auto trainIndex : rides[rideIndex])
+        {
+            auto& train = trains[trainIndex];
+            EntitySpatialDeferMoves(&train.Moves);
+            ViewportsDeferInvalidations(&train.Invalidations);
+            _vehicleDeferredEffects = &train.Deferred;
+            train.UpdateSound = train.Head->UpdateStatus();
+            train.Updated = true;
+            if (train.Deferred.Interrupted)
+                break;
+        }
+        _vehicleDeferredEffects = nullptr;
+        ViewportsDeferInvalidations(nullptr);
+        EntitySpatialDeferMoves(nullptr);
+    });
+
+    for (auto& train : trains)
+    {
+        if (!train.Updated)
+        {
+            train.Head->Update();
+            continue;
+        }
+
+        EntitySpatialApplyMoves(train.Moves);
+        ViewportsApplyInvalidations(train.Invalidations);
+        for (auto& effect : train.Deferred.Effects)
+        {
+            effect();
+        }
+        if (train.UpdateSound)
+        {
+            train.Head->UpdateSound();
+        }
+    }
+}
+
 void VehicleUpdateAll()
 {
     PROFILED_FUNCTION();
@@ -1237,6 +1413,13 @@ void VehicleUpdateAll()
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && gEditorStep != EditorStep::RollercoasterDesigner)
         return;
 
+    // Only used where every client runs the same code path, a difference to the serial update must never cause a desync
+    if (gConfigGeneral.ParallelSimulation && NetworkGetMode() == NETWORK_MODE_NONE)
+    {
+        VehicleUpdateAllParallel();
+        return;
+    }
+
     for (auto vehicle : TrainManager::View())
     {
         vehicle->Update();
@@ -1459,7 +1642,7 @@ void Vehicle::UpdateMeasurements()
         curRide->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
         curRide->lifecycle_flags &= ~RIDE_LIFECYCLE_TEST_IN_PROGRESS;
         ClearFlag(VehicleFlags::Testing);
-        WindowInvalidateByNumber(WindowClass::Ride, ride.ToUnderlying());
+        VehicleInvalidateRideWindow(ride);
         return;
     }
 
@@ -1852,23 +2035,31 @@ void Vehicle::GetLiftHillSound(const Ride& curRide, SoundIdVolume& curSound)
  *  rct2: 0x006D77F2
  */
 void Vehicle::Update()
+{
+    if (UpdateStatus())
+    {
+        UpdateSound();
+    }
+}
+
+bool Vehicle::UpdateStatus()
 {
     if (IsCableLift())
     {
         CableLiftUpdate();
-        return;
+        return false;
     }
 
     auto rideEntry = GetRideEntry();
     if (rideEntry == nullptr)
-        return;
+        return false;
 
     auto curRide = GetRide();
     if (curRide == nullptr)
-        return;
+        return false;
 
     if (curRide->type >= RIDE_TYPE_COUNT)
-        return;
+        return false;
 
     if (HasFlag(VehicleFlags::Testing))
         UpdateMeasurements();
@@ -1958,8 +2149,7 @@ void Vehicle::Update()
         default:
             break;
     }
-
-    UpdateSound();
+    return true;
 }
 
 /**
@@ -2952,7 +3142,7 @@ static void test_finish(Ride& ride)
 
     totalTime = std::max(totalTime, 1u);
     ride.average_speed = ride.average_speed / totalTime;
-    WindowInvalidateByNumber(WindowClass::Ride, ride.id.ToUnderlying());
+    VehicleInvalidateRideWindow(ride.id);
 }
 
 void Vehicle::UpdateTestFinish()
@@ -3002,7 +3192,7 @@ static void test_reset(Ride& ride, StationIndex curStation)
     }
     ride.total_air_time = 0;
     ride.current_test_station = curStation;
-    WindowInvalidateByNumber(WindowClass::Ride, ride.id.ToUnderlying());
+    VehicleInvalidateRideWindow(ride.id);
 }
 
 void Vehicle::TestReset()
@@ -3130,12 +3320,12 @@ void Vehicle::UpdateDeparting()
             auto soundId = (rideEntry->Cars[0].sound_range == 4) ? OpenRCT2::Audio::SoundId::Tram
                                                                  : OpenRCT2::Audio::SoundId::TrainDeparting;
 
-            OpenRCT2::Audio::Play3D(soundId, GetLocation());
+            VehiclePlay3D(soundId, GetLocation());
         }
 
         if (curRide->mode == RideMode::UpwardLaunch || (curRide->mode == RideMode::DownwardLaunch && NumLaunches > 1))
         {
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::RideLaunch2, GetLocation());
+            VehiclePlay3D(OpenRCT2::Audio::SoundId::RideLaunch2, GetLocation());
         }
 
         if (!(curRide->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
@@ -3341,7 +3531,7 @@ void Vehicle::FinishDeparting()
         if (NumLaunches >= 1 && (14 << 16) > velocity)
             return;
 
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::RideLaunch1, GetLocation());
+        VehiclePlay3D(OpenRCT2::Audio::SoundId::RideLaunch1, GetLocation());
     }
 
     if (curRide->mode == RideMode::UpwardLaunch)
@@ -3349,7 +3539,7 @@ void Vehicle::FinishDeparting()
         if ((curRide->launch_speed << 16) > velocity)
             return;
 
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::RideLaunch1, GetLocation());
+        VehiclePlay3D(OpenRCT2::Audio::SoundId::RideLaunch1, GetLocation());
     }
 
     if (curRide->mode != RideMode::Race && !curRide->IsBlockSectioned())
@@ -3416,7 +3606,9 @@ void Vehicle::CheckIfMissing()
         curRide->FormatNameTo(ft);
         ft.Add<StringId>(GetRideComponentName(GetRideTypeDescriptor(curRide->type).NameConvention.station).singular);
 
-        News::AddItemToQueue(News::ItemType::Ride, STR_NEWS_VEHICLE_HAS_STALLED, ride.ToUnderlying(), ft);
+        VehicleRunEffect([rideId = ride, ft]() {
+            News::AddItemToQueue(News::ItemType::Ride, STR_NEWS_VEHICLE_HAS_STALLED, rideId.ToUnderlying(), ft);
+        });
     }
 }
 
@@ -3484,7 +3676,7 @@ void Vehicle::UpdateCollisionSetup()
 #endif
         const auto trainLoc = train->GetLocation();
 
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::Crash, trainLoc);
+        VehiclePlay3D(OpenRCT2::Audio::SoundId::Crash, trainLoc);
 
         ExplosionCloud::Create(trainLoc);
 
@@ -3544,7 +3736,7 @@ void Vehicle::UpdateCrashSetup()
 
     if (NumPeepsUntilTrainTail() != 0)
     {
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::HauntedHouseScream2, GetLocation());
+        VehiclePlay3D(OpenRCT2::Audio::SoundId::HauntedHouseScream2, GetLocation());
     }
 
     int32_t edx = velocity >> 10;
@@ -3647,13 +3839,13 @@ void Vehicle::UpdateTravelling()
     {
         if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED)
         {
-            UpdateCrashSetup();
+            VehicleRunBlockingEffect([this]() { UpdateCrashSetup(); });
             return;
         }
 
         if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION)
         {
-            UpdateCollisionSetup();
+            VehicleRunBlockingEffect([this]() { UpdateCollisionSetup(); });
             return;
         }
 
@@ -3682,7 +3874,7 @@ void Vehicle::UpdateTravelling()
             {
                 if (sub_state != 0)
                 {
-                    UpdateCrashSetup();
+                    VehicleRunBlockingEffect([this]() { UpdateCrashSetup(); });
                     return;
                 }
                 sub_state = 1;
@@ -3981,7 +4173,7 @@ void Vehicle::UpdateArriving()
 
     if ((curRide->mode == RideMode::UpwardLaunch || curRide->mode == RideMode::DownwardLaunch) && NumLaunches < 2)
     {
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::RideLaunch2, GetLocation());
+        VehiclePlay3D(OpenRCT2::Audio::SoundId::RideLaunch2, GetLocation());
         velocity = 0;
         acceleration = 0;
         SetState(Vehicle::Status::Departing, 1);
@@ -4986,24 +5178,24 @@ void Vehicle::UpdateHauntedHouseOperating()
     switch (current_time)
     {
         case 45:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::HauntedHouseScare, GetLocation());
+            VehiclePlay3D(OpenRCT2::Audio::SoundId::HauntedHouseScare, GetLocation());
             break;
         case 75:
             Pitch = 1;
             Invalidate();
             break;
         case 400:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::HauntedHouseScream1, GetLocation());
+            VehiclePlay3D(OpenRCT2::Audio::SoundId::HauntedHouseScream1, GetLocation());
             break;
         case 745:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::HauntedHouseScare, GetLocation());
+            VehiclePlay3D(OpenRCT2::Audio::SoundId::HauntedHouseScare, GetLocation());
             break;
         case 775:
             Pitch = 1;
             Invalidate();
             break;
         case 1100:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::HauntedHouseScream2, GetLocation());
+            VehiclePlay3D(OpenRCT2::Audio::SoundId::HauntedHouseScream2, GetLocation());
             break;
     }
 }
@@ -5265,7 +5457,7 @@ void Vehicle::CrashOnLand()
     sub_state = 2;
 
     const auto curLoc = GetLocation();
-    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::Crash, curLoc);
+    VehiclePlay3D(OpenRCT2::Audio::SoundId::Crash, curLoc);
 
     ExplosionCloud::Create(curLoc);
     ExplosionFlare::Create(curLoc);
@@ -5333,7 +5525,7 @@ void Vehicle::CrashOnWater()
     sub_state = 2;
 
     const auto curLoc = GetLocation();
-    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::Water1, curLoc);
+    VehiclePlay3D(OpenRCT2::Audio::SoundId::Water1, curLoc);
 
     CrashSplashParticle::Create(curLoc);
     CrashSplashParticle::Create(curLoc + CoordsXYZ{ -8, -9, 0 });
@@ -6245,7 +6437,7 @@ static void block_brakes_open_previous_section(
     {
         if (ride.IsBlockSectioned())
         {
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::BlockBrakeClose, location);
+            VehiclePlay3D(OpenRCT2::Audio::SoundId::BlockBrakeClose, location);
         }
     }
 }
@@ -6686,7 +6878,8 @@ void Vehicle::UpdateAdditionalAnimation()
                             }();
                             int32_t directionIndex = sprite_direction >> 1;
                             auto offset = SteamParticleOffsets[typeIndex][directionIndex];
-                            SteamParticle::Create({ x + offset.x, y + offset.y, z + offset.z });
+                            CoordsXYZ steamLoc = { x + offset.x, y + offset.y, z + offset.z };
+                            VehicleRunEffect([steamLoc]() { SteamParticle::Create(steamLoc); });
                         }
                     }
                 }
@@ -6810,7 +7003,7 @@ static void play_scenery_door_open_sound(const CoordsXYZ& loc, WallElement* tile
         auto soundId = DoorOpenSoundIds[doorSoundType - 1];
         if (soundId != OpenRCT2::Audio::SoundId::Null)
         {
-            OpenRCT2::Audio::Play3D(soundId, loc);
+            VehiclePlay3D(soundId, loc);
         }
     }
 }
@@ -6828,7 +7021,7 @@ static void play_scenery_door_close_sound(const CoordsXYZ& loc, WallElement* til
         auto soundId = DoorCloseSoundIds[doorSoundType - 1];
         if (soundId != OpenRCT2::Audio::SoundId::Null)
         {
-            Play3D(soundId, loc);
+            VehiclePlay3D(soundId, loc);
         }
     }
 }
@@ -6846,7 +7039,7 @@ static void AnimateSceneryDoor(const CoordsXYZD& doorLocation, const CoordsXYZ&
     {
         door->SetAnimationIsBackwards(isBackwards);
         door->SetAnimationFrame(1);
-        MapAnimationCreate(MAP_ANIMATION_TYPE_WALL_DOOR, doorLocation);
+        VehicleRunEffect([doorLocation]() { MapAnimationCreate(MAP_ANIMATION_TYPE_WALL_DOOR, doorLocation); });
         play_scenery_door_open_sound(trackLocation, door);
     }
 
@@ -6953,7 +7146,8 @@ static void trigger_on_ride_photo(const CoordsXYZ& loc, TileElement* tileElement
 {
     tileElement->AsTrack()->SetPhotoTimeout();
 
-    MapAnimationCreate(MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO, { loc, tileElement->GetBaseZ() });
+    const CoordsXYZ animationLoc = { loc, tileElement->GetBaseZ() };
+    VehicleRunEffect([animationLoc]() { MapAnimationCreate(MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO, animationLoc); });
 }
 
 /**
@@ -6996,7 +7190,7 @@ static void vehicle_update_play_water_splash_sound()
         return;
     }
 
-    OpenRCT2::Audio::Play3D(
+    VehiclePlay3D(
         OpenRCT2::Audio::SoundId::WaterSplash, { _vehicleCurPosition.x, _vehicleCurPosition.y, _vehicleCurPosition.z });
 }
 
@@ -7418,7 +7612,7 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, const Rid
             {
                 if (!(rideEntry.Cars[0].flags & CAR_ENTRY_FLAG_POWERED))
                 {
-                    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::BlockBrakeRelease, TrackLocation);
+                    VehiclePlay3D(OpenRCT2::Audio::SoundId::BlockBrakeRelease, TrackLocation);
                 }
             }
             MapInvalidateElement(TrackLocation, tileElement);
@@ -7609,7 +7803,7 @@ Loc6DAEB9:
                 if (_vehicleF64E2C == 0)
                 {
                     _vehicleF64E2C++;
-                    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::BrakeRelease, { x, y, z });
+                    VehiclePlay3D(OpenRCT2::Audio::SoundId::BrakeRelease, { x, y, z });
                 }
             }
         }
@@ -7801,9 +7995,86 @@ Loc6DAEB9:
 
     acceleration += AccelerationFromPitch[moveInfovehicleSpriteType];
     _vehicleUnkF64E10++;
+    if (UpdateTrackMotionForwardsAlongPiece(*carEntry, curRide, rideEntry))
+    {
+        return true;
+    }
     goto Loc6DAEB9;
 }
 
+/**
+ * Moves the vehicle over the remaining points of its track piece in one go using the motion tables, as long as
+ * stepping through them one by one would only change its distance and acceleration. The result is the same as that of
+ * the point by point loop in UpdateTrackMotionForwards. Returns true if the vehicle ran out of distance on the piece.
+ */
+bool Vehicle::UpdateTrackMotionForwardsAlongPiece(
+    const CarEntry& carEntry, const Ride& curRide, const RideObjectEntry& rideEntry)
+{
+    // The front vehicle checks for collisions on every point
+    if (this == _vehicleFrontVehicle && _vehicleVelocityF64E08 >= 0)
+    {
+        return false;
+    }
+    if (TrackSubposition == VehicleTrackSubposition::ReverserRCFrontBogie
+        || TrackSubposition == VehicleTrackSubposition::ReverserRCRearBogie)
+    {
+        return false;
+    }
+    if (carEntry.flags & CAR_ENTRY_FLAG_WOODEN_WILD_MOUSE_SWING)
+    {
+        return false;
+    }
+    if ((rideEntry.flags & (RIDE_ENTRY_FLAG_PLAY_SPLASH_SOUND | RIDE_ENTRY_FLAG_PLAY_SPLASH_SOUND_SLIDE))
+        || ((rideEntry.flags & RIDE_ENTRY_FLAG_RIDER_CONTROLS_SPEED) && num_peeps > 0))
+    {
+        return false;
+    }
+
+    // Track pieces that change the acceleration or the vehicle, or play a sound, on some points
+    const auto trackType = GetTrackType();
+    switch (trackType)
+    {
+        case TrackElemType::Watersplash:
+        case TrackElemType::HeartLineTransferUp:
+        case TrackElemType::HeartLineTransferDown:
+        case TrackElemType::Brakes:
+        case TrackElemType::Booster:
+        case TrackElemType::PoweredLift:
+        case TrackElemType::BrakeForDrop:
+        case TrackElemType::LogFlumeReverser:
+            return false;
+        case TrackElemType::Flat:
+            if (curRide.type == RIDE_TYPE_REVERSE_FREEFALL_COASTER)
+            {
+                return false;
+            }
+            break;
+        default:
+            break;
+    }
+
+    const auto numPoints = GetTrackProgress();
+    const auto* points = VehicleGetMotionPoints(TrackSubposition, trackType, GetTrackDirection());
+    if (points == nullptr || track_progress + 1 >= numPoints)
+    {
+        return false;
+    }
+
+    const auto motion = VehicleMoveAlongMotionPoints(points, numPoints, track_progress, remaining_distance);
+    remaining_distance -= static_cast<int32_t>(motion.Distance);
+    acceleration += motion.Acceleration;
+    _vehicleUnkF64E10 += motion.PointsPassed;
+    track_progress = motion.TrackProgress;
+
+    const auto moveInfo = GetMoveInfo();
+    _vehicleCurPosition = TrackLocation
+        + CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z + GetRideTypeDescriptor(curRide.type).Heights.VehicleZOffset };
+    sprite_direction = moveInfo->direction;
+    bank_rotation = moveInfo->bank_rotation;
+    Pitch = moveInfo->Pitch;
+    return motion.OutOfDistance;
+}
+
 static PitchAndRoll PitchAndRollEnd(const Ride& curRide, bool useInvertedSprites, uint16_t trackType, TileElement* tileElement)
 {
     bool isInverted = useInvertedSprites ^ tileElement->AsTrack()->IsInverted();
@@ -9154,9 +9425,11 @@ int32_t Vehicle::NumPeepsUntilTrainTail() const
  */
 void Vehicle::InvalidateWindow()
 {
-    auto intent = Intent(INTENT_ACTION_INVALIDATE_VEHICLE_WINDOW);
-    intent.PutExtra(INTENT_EXTRA_VEHICLE, this);
-    ContextBroadcastIntent(&intent);
+    VehicleRunEffect([this]() {
+        auto intent = Intent(INTENT_ACTION_INVALIDATE_VEHICLE_WINDOW);
+        intent.PutExtra(INTENT_EXTRA_VEHICLE, this);
+        ContextBroadcastIntent(&intent);
+    });
 }
 
 void Vehicle::UpdateCrossings() const
@@ -9287,10 +9560,10 @@ void Vehicle::Claxon() const
     switch (rideEntry->Cars[vehicle_type].sound_range)
     {
         case SOUND_RANGE_WHISTLE:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::TrainWhistle, { x, y, z });
+            VehiclePlay3D(OpenRCT2::Audio::SoundId::TrainWhistle, { x, y, z });
             break;
         case SOUND_RANGE_BELL:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::Tram, { x, y, z });
+            VehiclePlay3D(OpenRCT2::Audio::SoundId::Tram, { x, y, z });
             break;
     }
 }
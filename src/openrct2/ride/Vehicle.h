@@ -213,6 +213,9 @@ struct Vehicle : EntityBase
         return SubType == Vehicle::Type::Head;
     }
     void Update();
+    // Update without the sounds, returns whether UpdateSound is still to be called for this tick
+    bool UpdateStatus();
+    void UpdateSound();
     Vehicle* GetHead();
     const Vehicle* GetHead() const;
     Vehicle* GetCar(size_t carIndex) const;
@@ -321,7 +324,6 @@ private:
     void UpdateShowingFilm();
     void UpdateDoingCircusShow();
     void UpdateCrossings() const;
-    void UpdateSound();
     void GetLiftHillSound(const Ride& curRide, SoundIdVolume& curSound);
     OpenRCT2::Audio::SoundId UpdateScreamSound();
     OpenRCT2::Audio::SoundId ProduceScreamSound(const int32_t totalNumPeeps);
@@ -366,6 +368,7 @@ private:
     int32_t UpdateTrackMotionMiniGolf(int32_t* outStation);
     void UpdateTrackMotionMiniGolfVehicle(const Ride& curRide, const RideObjectEntry& rideEntry, const CarEntry* carEntry);
     bool UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, const Ride& curRide, const RideObjectEntry& rideEntry);
+    bool UpdateTrackMotionForwardsAlongPiece(const CarEntry& carEntry, const Ride& curRide, const RideObjectEntry& rideEntry);
     bool UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, const Ride& curRide, uint16_t* progress);
     bool UpdateMotionCollisionDetection(const CoordsXYZ& loc, EntityId* otherVehicleIndex);
     void UpdateGoKartAttemptSwitchLanes();
@@ -539,12 +542,12 @@ void RideUpdateMeasurementsSpecialElements_Default(Ride& ride, const track_type_
 void RideUpdateMeasurementsSpecialElements_MiniGolf(Ride& ride, const track_type_t trackType);
 void RideUpdateMeasurementsSpecialElements_WaterCoaster(Ride& ride, const track_type_t trackType);
 
-extern Vehicle* gCurrentVehicle;
-extern StationIndex _vehicleStationIndex;
-extern uint32_t _vehicleMotionTrackFlags;
-extern int32_t _vehicleVelocityF64E08;
-extern int32_t _vehicleVelocityF64E0C;
-extern int32_t _vehicleUnkF64E10;
-extern uint8_t _vehicleF64E2C;
-extern Vehicle* _vehicleFrontVehicle;
-extern CoordsXYZ _vehicleCurPosition;
+extern thread_local Vehicle* gCurrentVehicle;
+extern thread_local StationIndex _vehicleStationIndex;
+extern thread_local uint32_t _vehicleMotionTrackFlags;
+extern thread_local int32_t _vehicleVelocityF64E08;
+extern thread_local int32_t _vehicleVelocityF64E0C;
+extern thread_local int32_t _vehicleUnkF64E10;
+extern thread_local uint8_t _vehicleF64E2C;
+extern thread_local Vehicle* _vehicleFrontVehicle;
+extern thread_local CoordsXYZ _vehicleCurPosition;
@@ -0,0 +1,128 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "VehicleMotionTables.h"
+
+#include "Vehicle.h"
+#include "VehicleData.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr size_t NoMotionPoints = SIZE_MAX;
+
+    struct VehicleMotionTables
+    {
+        std::vector<VehicleMotionPoint> Points;
+        // Offset into Points for each subposition, track type and direction
+        std::vector<size_t> Offsets;
+
+        VehicleMotionTables()
+        {
+            constexpr size_t numSubpositions = EnumValue(VehicleTrackSubposition::Count);
+            Offsets.resize(numSubpositions * VehicleTrackSubpositionSizeDefault, NoMotionPoints);
+
+            // Many paths share the same list, only build each list once
+            std::unordered_map<const VehicleInfo*, size_t> listOffsets;
+            for (size_t subposition = 0; subposition < numSubpositions; subposition++)
+            {
+                const auto trackSubposition = static_cast<VehicleTrackSubposition>(subposition);
+                for (track_type_t type = 0; type < TrackElemType::Count; type++)
+                {
+                    for (uint8_t direction = 0; direction < NumOrthogonalDirections; direction++)
+                    {
+                        const auto size = VehicleGetMoveInfoSize(trackSubposition, type, direction);
+                        if (size == 0)
+                        {
+                            continue;
+                        }
+
+                        const auto typeAndDirection = (type << 2) | direction;
+                        const auto* info = gTrackVehicleInfo[subposition][typeAndDirection]->info;
+                        auto [it, inserted] = listOffsets.emplace(info, Points.size());
+                        if (inserted)
+                        {
+                            AddPoints(info, size);
+                        }
+                        Offsets[(subposition * VehicleTrackSubpositionSizeDefault) + typeAndDirection] = it->second;
+                    }
+                }
+            }
+        }
+
+    private:
+        void AddPoints(const VehicleInfo* info, size_t size)
+        {
+            VehicleMotionPoint point{ 0, AccelerationFromPitch[info[0].Pitch] };
+            Points.push_back(point);
+            for (size_t i = 1; i < size; i++)
+            {
+                // Same distance as a vehicle moving from point i - 1 to point i, see Vehicle::UpdateTrackMotionForwards
+                uint8_t remainingDistanceFlags = 0;
+                if (info[i].x != info[i - 1].x)
+                {
+                    remainingDistanceFlags |= 1;
+                }
+                if (info[i].y != info[i - 1].y)
+                {
+                    remainingDistanceFlags |= 2;
+                }
+                if (info[i].z != info[i - 1].z)
+                {
+                    remainingDistanceFlags |= 4;
+                }
+                point.Distance += SubpositionTranslationDistances[remainingDistanceFlags];
+                point.Acceleration += AccelerationFromPitch[info[i].Pitch];
+                Points.push_back(point);
+            }
+        }
+    };
+} // namespace
+
+const VehicleMotionPoint* VehicleGetMotionPoints(
+    VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction)
+{
+    static const VehicleMotionTables tables;
+
+    if (trackSubposition >= VehicleTrackSubposition::Count || type >= TrackElemType::Count)
+    {
+        return nullptr;
+    }
+    const auto typeAndDirection = (type << 2) | (direction & 3);
+    const auto offset = tables.Offsets[(EnumValue(trackSubposition) * VehicleTrackSubpositionSizeDefault) + typeAndDirection];
+    return offset != NoMotionPoints ? &tables.Points[offset] : nullptr;
+}
+
+VehicleMotionResult VehicleMoveAlongMotionPoints(
+    const VehicleMotionPoint* points, uint16_t numPoints, uint16_t trackProgress, int32_t remainingDistance)
+{
+    // The vehicle stops on the first point that leaves it less than 0x368A distance, moving past the last point of the
+    // piece is left to UpdateTrackMotionForwards
+    const auto& current = points[trackProgress];
+    const auto* first = points + trackProgress + 1;
+    const auto* end = points + numPoints;
+    const int64_t maxDistance = int64_t{ current.Distance } + remainingDistance - 0x368A;
+    const auto* stop = std::upper_bound(
+        first, end, maxDistance, [](int64_t distance, const VehicleMotionPoint& point) { return distance < point.Distance; });
+    const bool outOfDistance = stop != end;
+    const auto* last = outOfDistance ? stop : end - 1;
+    // Acceleration is only gained on the points the vehicle moves on from
+    const auto* lastPassed = outOfDistance ? stop - 1 : end - 1;
+
+    VehicleMotionResult result{};
+    result.TrackProgress = static_cast<uint16_t>(last - points);
+    result.Distance = last->Distance - current.Distance;
+    result.Acceleration = lastPassed->Acceleration - current.Acceleration;
+    result.PointsPassed = static_cast<int32_t>(lastPassed - first) + 1;
+    result.OutOfDistance = outOfDistance;
+    return result;
+}
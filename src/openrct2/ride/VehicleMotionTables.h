@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "VehicleSubpositionData.h"
+
+/**
+ * Running totals along the subposition points of a vehicle track path, so vehicles can skip over points without
+ * stepping through them one by one. Built from gTrackVehicleInfo the first time they are used.
+ */
+struct VehicleMotionPoint
+{
+    // Sum of the SubpositionTranslationDistances moved from point 0 to this point
+    uint32_t Distance;
+    // Sum of the AccelerationFromPitch of points 0 up to and including this point
+    int32_t Acceleration;
+};
+
+/**
+ * Returns one entry per point of the path, see VehicleGetMoveInfoSize, or nullptr if there is no such path.
+ */
+const VehicleMotionPoint* VehicleGetMotionPoints(
+    VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction);
+
+/**
+ * Where a vehicle moving forwards from point trackProgress with remainingDistance left stops on its track piece, the same
+ * as moving one point at a time in Vehicle::UpdateTrackMotionForwards.
+ */
+struct VehicleMotionResult
+{
+    uint16_t TrackProgress;
+    // Distance moved to get to TrackProgress
+    uint32_t Distance;
+    // Acceleration gained on the points the vehicle moved on from
+    int32_t Acceleration;
+    // Number of points the vehicle moved on from
+    int32_t PointsPassed;
+    // False if the vehicle reached the last point of the piece with distance left
+    bool OutOfDistance;
+};
+
+/**
+ * Requires trackProgress + 1 < numPoints and remainingDistance to be at least the distance a vehicle needs to move on.
+ */
+VehicleMotionResult VehicleMoveAlongMotionPoints(
+    const VehicleMotionPoint* points, uint16_t numPoints, uint16_t trackProgress, int32_t remainingDistance);
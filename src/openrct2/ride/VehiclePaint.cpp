@@ -21,7 +21,9 @@
 #include "../ride/Vehicle.h"
 #include "Track.h"
 
+#include <algorithm>
 #include <iterator>
+#include <unordered_map>
 
 using namespace OpenRCT2::Entity::Yaw;
 
@@ -1007,11 +1009,28 @@ static void vehicle_sprite_paint(
     VehicleVisualSplashEffect(session, z, vehicle, carEntry);
 }
 
+// Set while a sprite table is built, the pitch paint functions then record the sprite they select instead of painting it
+struct VehicleSpriteRecord
+{
+    const CarEntry* SpriteCarEntry{};
+    int32_t SpriteNum{};
+    int32_t BoundingBoxNum{};
+    bool Restraints{};
+};
+static thread_local VehicleSpriteRecord* _vehicleSpriteRecord;
+
 // 6D520E
 static void VehicleSpritePaintWithSwinging(
     PaintSession& session, const Vehicle* vehicle, int32_t spriteNum, int32_t boundingBoxNum, int32_t z,
     const CarEntry* carEntry)
 {
+    if (_vehicleSpriteRecord != nullptr)
+    {
+        _vehicleSpriteRecord->SpriteCarEntry = carEntry;
+        _vehicleSpriteRecord->SpriteNum = spriteNum;
+        _vehicleSpriteRecord->BoundingBoxNum = boundingBoxNum;
+        return;
+    }
     vehicle_sprite_paint(
         session, vehicle, spriteNum + vehicle->SwingSprite, VehicleBoundboxes[carEntry->draw_order][boundingBoxNum], z,
         carEntry);
@@ -1037,6 +1056,11 @@ static void VehiclePitchFlatUnbanked(
     PaintSession& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z, const CarEntry* carEntry)
 {
     // Restraint animations are only drawn for vehicles that are in a cardinal direction (north, east, south, west)
+    if (_vehicleSpriteRecord != nullptr)
+    {
+        _vehicleSpriteRecord->Restraints = carEntry->GroupEnabled(SpriteGroupType::RestraintAnimation)
+            && (imageDirection & 7) == 0;
+    }
     if (vehicle->restraints_position >= 64 && carEntry->GroupEnabled(SpriteGroupType::RestraintAnimation)
         && (imageDirection & 7) == 0)
     {
@@ -3661,10 +3685,148 @@ void VehicleVisualSplashEffect(PaintSession& session, int32_t z, const Vehicle*
 void VehicleVisualDefault(
     PaintSession& session, int32_t imageDirection, int32_t z, const Vehicle* vehicle, const CarEntry* carEntry)
 {
-    if (vehicle->Pitch < std::size(PaintFunctionsByPitch))
+    if (vehicle->Pitch >= std::size(PaintFunctionsByPitch))
+    {
+        return;
+    }
+
+    const auto* entry = carEntry->SpriteTable != nullptr ? carEntry->SpriteTable->Find(*vehicle, imageDirection) : nullptr;
+    if (entry == nullptr)
     {
         PaintFunctionsByPitch[vehicle->Pitch](session, vehicle, imageDirection, z, carEntry);
+        return;
+    }
+
+    const auto* spriteCarEntry = carEntry + entry->CarEntryOffset;
+    if ((entry->Flags & VehicleSpriteTable::ENTRY_FLAG_RESTRAINTS) && vehicle->restraints_position >= 64)
+    {
+        VehicleSpritePaintRestraints(session, vehicle, imageDirection, z, spriteCarEntry);
+    }
+    else
+    {
+        VehicleSpritePaintWithSwinging(session, vehicle, entry->SpriteNum, entry->BoundingBoxNum, z, spriteCarEntry);
+    }
+}
+
+const VehicleSpriteTable::Entry* VehicleSpriteTable::Find(const Vehicle& vehicle, int32_t imageDirection) const
+{
+    if (vehicle.bank_rotation >= NumBankRotations || imageDirection < 0
+        || imageDirection >= static_cast<int32_t>(std::tuple_size_v<Row>))
+    {
+        return nullptr;
+    }
+
+    const auto inverted = vehicle.HasFlag(VehicleFlags::CarIsInverted) ? 1u : 0u;
+    const auto key = (((inverted * std::size(PaintFunctionsByPitch)) + vehicle.Pitch) * NumBankRotations)
+        + vehicle.bank_rotation;
+    if (key >= RowIndices.size())
+    {
+        return nullptr;
+    }
+
+    const auto& entry = Rows[RowIndices[key]][imageDirection];
+    return (entry.Flags & ENTRY_FLAG_VALID) ? &entry : nullptr;
+}
+
+static VehicleSpriteTable::Entry VehicleSpriteTableCreateEntry(
+    PaintSession& session, Vehicle& vehicle, const CarEntry* cars, size_t index, int32_t imageDirection)
+{
+    VehicleSpriteRecord record;
+    _vehicleSpriteRecord = &record;
+    PaintFunctionsByPitch[vehicle.Pitch](session, &vehicle, imageDirection, 0, &cars[index]);
+    _vehicleSpriteRecord = nullptr;
+
+    const auto carEntryOffset = record.SpriteCarEntry - &cars[index];
+    if (record.SpriteCarEntry == nullptr || carEntryOffset > 0 || -carEntryOffset > static_cast<ptrdiff_t>(index)
+        || record.SpriteNum < 0 || record.BoundingBoxNum < 0
+        || record.BoundingBoxNum >= static_cast<int32_t>(std::size(VehicleBoundboxes[0])))
+    {
+        return {};
+    }
+
+    VehicleSpriteTable::Entry entry{};
+    entry.SpriteNum = static_cast<uint32_t>(record.SpriteNum);
+    entry.BoundingBoxNum = static_cast<uint8_t>(record.BoundingBoxNum);
+    entry.CarEntryOffset = static_cast<int8_t>(carEntryOffset);
+    entry.Flags = VehicleSpriteTable::ENTRY_FLAG_VALID;
+    if (record.Restraints)
+    {
+        entry.Flags |= VehicleSpriteTable::ENTRY_FLAG_RESTRAINTS;
+    }
+    return entry;
+}
+
+struct VehicleSpriteTableRowHash
+{
+    size_t operator()(const VehicleSpriteTable::Row& row) const
+    {
+        uint32_t hash = 5381;
+        for (const auto& entry : row)
+        {
+            hash = ((hash << 5) + hash) + entry.SpriteNum;
+            const auto packed = (entry.BoundingBoxNum << 16) | (static_cast<uint8_t>(entry.CarEntryOffset) << 8) | entry.Flags;
+            hash = ((hash << 5) + hash) + packed;
+        }
+        return hash;
+    }
+};
+
+struct VehicleSpriteTableRowEqual
+{
+    bool operator()(const VehicleSpriteTable::Row& lhs, const VehicleSpriteTable::Row& rhs) const
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](const auto& a, const auto& b) {
+            return a.SpriteNum == b.SpriteNum && a.BoundingBoxNum == b.BoundingBoxNum && a.CarEntryOffset == b.CarEntryOffset
+                && a.Flags == b.Flags;
+        });
+    }
+};
+
+VehicleSpriteTable VehicleSpriteTableCreate(const CarEntry* cars, size_t index)
+{
+    VehicleSpriteTable table;
+    PaintSession session{};
+    Vehicle vehicle{};
+
+    // Only cars behind another car entry can be painted inverted
+    const size_t numInverted = index > 0 ? 2 : 1;
+    table.RowIndices.reserve(numInverted * std::size(PaintFunctionsByPitch) * VehicleSpriteTable::NumBankRotations);
+    std::unordered_map<VehicleSpriteTable::Row, uint16_t, VehicleSpriteTableRowHash, VehicleSpriteTableRowEqual> rowIndices;
+    for (size_t inverted = 0; inverted < numInverted; inverted++)
+    {
+        if (inverted != 0)
+        {
+            vehicle.SetFlag(VehicleFlags::CarIsInverted);
+        }
+        for (uint8_t pitch = 0; pitch < std::size(PaintFunctionsByPitch); pitch++)
+        {
+            vehicle.Pitch = pitch;
+            for (uint8_t bankRotation = 0; bankRotation < VehicleSpriteTable::NumBankRotations; bankRotation++)
+            {
+                vehicle.bank_rotation = bankRotation;
+
+                // Inverted cars going steeply down pick their car entry by track type, leave those to the paint functions
+                VehicleSpriteTable::Row row{};
+                const auto byTrackType = PaintFunctionsByPitch[pitch] == VehiclePitchDown75
+                    || PaintFunctionsByPitch[pitch] == VehiclePitchDown90;
+                if (inverted == 0 || !byTrackType)
+                {
+                    for (int32_t imageDirection = 0; imageDirection < static_cast<int32_t>(row.size()); imageDirection++)
+                    {
+                        row[imageDirection] = VehicleSpriteTableCreateEntry(session, vehicle, cars, index, imageDirection);
+                    }
+                }
+
+                auto [it, inserted] = rowIndices.emplace(row, static_cast<uint16_t>(table.Rows.size()));
+                if (inserted)
+                {
+                    table.Rows.push_back(row);
+                }
+                table.RowIndices.push_back(it->second);
+            }
+        }
     }
+    return table;
 }
 
 void Vehicle::Paint(PaintSession& session, int32_t imageDirection) const
@@ -11,6 +11,9 @@
 
 #include "../common.h"
 
+#include <array>
+#include <vector>
+
 struct PaintSession;
 struct CarEntry;
 struct Vehicle;
@@ -27,6 +30,44 @@ struct VehicleBoundBox
 
 extern const VehicleBoundBox VehicleBoundboxes[16][224];
 
+/**
+ * The sprite and bounding box the pitch paint functions select for each pitch, bank rotation and yaw of a car entry,
+ * so painting a vehicle is a single lookup rather than a cascade of functions checking which sprite groups are enabled.
+ */
+struct VehicleSpriteTable
+{
+    // Bank rotations above this are unusual and are left to the pitch paint functions
+    static constexpr uint8_t NumBankRotations = 20;
+
+    enum : uint8_t
+    {
+        ENTRY_FLAG_VALID = 1 << 0,
+        // The restraint animation is painted instead while the restraints are open
+        ENTRY_FLAG_RESTRAINTS = 1 << 1,
+    };
+
+    struct Entry
+    {
+        uint32_t SpriteNum;
+        uint8_t BoundingBoxNum;
+        // Inverted cars paint some sprites using the car entry in front of them
+        int8_t CarEntryOffset;
+        uint8_t Flags;
+    };
+    using Row = std::array<Entry, 32>;
+
+    // Most pitch and bank rotation combinations fall back to the same sprites, so rows are shared
+    std::vector<Row> Rows;
+    std::vector<uint16_t> RowIndices;
+
+    const Entry* Find(const Vehicle& vehicle, int32_t imageDirection) const;
+};
+
+/**
+ * Builds the sprite table of cars[index], car entries before it are used for the sprites of inverted cars.
+ */
+[[nodiscard]] VehicleSpriteTable VehicleSpriteTableCreate(const CarEntry* cars, size_t index);
+
 void VehicleVisualDefault(
     PaintSession& session, int32_t imageDirection, int32_t z, const Vehicle* vehicle, const CarEntry* carEntry);
 void VehicleVisualRotoDrop(
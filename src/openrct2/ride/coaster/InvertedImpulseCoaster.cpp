@@ -17,39 +17,206 @@
 #include "../RideData.h"
 #include "../TrackData.h"
 #include "../TrackPaint.h"
+#include "../TrackPaintTable.h"
 
+// clang-format off
 /** rct2: 0x008B0460 */
-static void InvertedImpulseRCTrackFlat(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19662), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19663), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+static constexpr TrackPaintPiece InvertedImpulseRCTrackFlat = {
+    {{
+        { {{ { 19662, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_3, 0 }, 4 },
+        { {{ { 19663, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_3, 0 }, 4 },
+        { {{ { 19662, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_3, 0 }, 4 },
+        { {{ { 19663, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_3, 0 }, 4 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    { TrackPaintSupportsMode::Spaced, METAL_SUPPORTS_TUBES_INVERTED, 44 },
+    TrackPaintNoVerticalTunnel,
+    48,
+};
 
-    PaintUtilSetSegmentSupportHeight(
-        session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
-    {
-        MetalASupportsPaintSetup(
-            session, METAL_SUPPORTS_TUBES_INVERTED, 4, 0, height + 44, session.TrackColours[SCHEME_SUPPORTS]);
-    }
+/** rct2: 0x008B04A0 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrack25DegUp = {
+    {{
+        { {{ { 19672, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_4, -8 }, 6 },
+        { {{ { 19673, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_5, 8 }, 8 },
+        { {{ { 19674, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_5, 8 }, 7 },
+        { {{ { 19675, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_4, -8 }, 5 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    { TrackPaintSupportsMode::Spaced, METAL_SUPPORTS_TUBES_INVERTED, 62 },
+    TrackPaintNoVerticalTunnel,
+    72,
+};
 
-    PaintUtilPushTunnelRotated(session, direction, height, TUNNEL_INVERTED_3);
-    PaintUtilSetGeneralSupportHeight(session, height + 48, 0x20);
-}
+/** rct2: 0x008B04B0 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrack60DegUp = {
+    {{
+        { {{ { 19688, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_4, -8 }, 0 },
+        { {{ { 19689, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } }}, { TUNNEL_INVERTED_5, 56 }, 0 },
+        { {{ { 19690, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } }}, { TUNNEL_INVERTED_5, 56 }, 0 },
+        { {{ { 19691, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_4, -8 }, 0 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    {},
+    TrackPaintNoVerticalTunnel,
+    120,
+};
+
+/** rct2: 0x008B04C0 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrackFlatTo25DegUp = {
+    {{
+        { {{ { 19664, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_3, 0 }, 6 },
+        { {{ { 19665, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_5, 0 }, 8 },
+        { {{ { 19666, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_5, 0 }, 7 },
+        { {{ { 19667, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_3, 0 }, 5 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    { TrackPaintSupportsMode::Always, METAL_SUPPORTS_TUBES_INVERTED, 54 },
+    TrackPaintNoVerticalTunnel,
+    64,
+};
+
+/** rct2: 0x008B04D0 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrack25DegUpTo60DegUp = {
+    {{
+        { {{ { 19676, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_4, -8 }, 0 },
+        { {{ { 19680, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+             { 19677, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } } }}, { TUNNEL_INVERTED_5, 24 }, 0 },
+        { {{ { 19681, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+             { 19678, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } } }}, { TUNNEL_INVERTED_5, 24 }, 0 },
+        { {{ { 19679, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_4, -8 }, 0 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    {},
+    TrackPaintNoVerticalTunnel,
+    88,
+};
+
+/** rct2: 0x008B04E0 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrack60DegUpTo25DegUp = {
+    {{
+        { {{ { 19682, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_4, -8 }, 0 },
+        { {{ { 19686, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+             { 19683, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } } }}, { TUNNEL_INVERTED_5, 24 }, 0 },
+        { {{ { 19687, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+             { 19684, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } } }}, { TUNNEL_INVERTED_5, 24 }, 0 },
+        { {{ { 19685, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_4, -8 }, 0 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    {},
+    TrackPaintNoVerticalTunnel,
+    88,
+};
+
+/** rct2: 0x008B04F0 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrack25DegUpToFlat = {
+    {{
+        { {{ { 19668, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_3, -8 }, 6 },
+        { {{ { 19669, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } }}, { TUNNEL_13, 8 }, 8 },
+        { {{ { 19670, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } }}, { TUNNEL_13, 8 }, 7 },
+        { {{ { 19671, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_3, -8 }, 5 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    { TrackPaintSupportsMode::Always, METAL_SUPPORTS_TUBES_INVERTED, 52 },
+    TrackPaintNoVerticalTunnel,
+    56,
+};
+
+/** rct2: 0x008B05A0 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrack90DegUp = {
+    {{
+        { {{ { 19700, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } }}, {}, 0 },
+        { {{ { 19701, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } }}, {}, 0 },
+        { {{ { 19702, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } }}, {}, 0 },
+        { {{ { 19703, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } }}, {}, 0 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    {},
+    32,
+    32,
+    true,
+};
+
+/** rct2: 0x008B0560 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrack60DegUpTo90DegUp = {
+    {{
+        { {{ { 19692, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_4, -8 }, 0 },
+        { {{ { 19693, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } }}, {}, 0 },
+        { {{ { 19694, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } }}, {}, 0 },
+        { {{ { 19695, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } }}, { TUNNEL_INVERTED_4, -8 }, 0 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    {},
+    56,
+    72,
+    true,
+};
+
+/** rct2: 0x008B0580 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrack90DegUpTo60DegUp = {
+    {{
+        { {{ { 19696, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } }}, {}, 0 },
+        { {{ { 19697, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } }}, { TUNNEL_INVERTED_5, 48 }, 0 },
+        { {{ { 19698, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } }}, { TUNNEL_INVERTED_5, 48 }, 0 },
+        { {{ { 19699, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } }}, {}, 0 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    {},
+    TrackPaintNoVerticalTunnel,
+    96,
+};
+
+/** rct2: 0x008B0590 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrack60DegDownTo90DegDown = {
+    {{
+        { {{ { 19698, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } }}, { TUNNEL_INVERTED_5, 48 }, 0 },
+        { {{ { 19699, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } }}, {}, 0 },
+        { {{ { 19696, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } }}, {}, 0 },
+        { {{ { 19697, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } }}, { TUNNEL_INVERTED_5, 48 }, 0 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    {},
+    TrackPaintNoVerticalTunnel,
+    96,
+    true,
+};
+
+/** rct2: 0x008B05C0 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrackLeftQuarterTurn190DegUp = {
+    {{
+        { {{ { 19708, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } } }}, {}, 0 },
+        { {{ { 19709, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+             { 19717, { 0, 0, 29 }, { { 4, 0, 11 }, { 2, 32, 31 } } } }}, {}, 0 },
+        { {{ { 19710, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+             { 19718, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } }}, {}, 0 },
+        { {{ { 19711, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+             { 19719, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } }}, {}, 0 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    {},
+    96,
+    96,
+    true,
+};
+
+/** rct2: 0x008B05D0 */
+static constexpr TrackPaintPiece InvertedImpulseRCTrackRightQuarterTurn190DegUp = {
+    {{
+        { {{ { 19704, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+             { 19712, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } }}, {}, 0 },
+        { {{ { 19705, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+             { 19713, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } }}, {}, 0 },
+        { {{ { 19706, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+             { 19714, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } }}, {}, 0 },
+        { {{ { 19707, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } } }}, {}, 0 },
+    }},
+    SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0,
+    {},
+    96,
+    96,
+    true,
+};
+// clang-format on
 
 /** rct2: 0x008B0470, 0x008B0480, 0x008B0490 */
 static void InvertedImpulseRCTrackStation(
@@ -79,736 +246,60 @@ static void InvertedImpulseRCTrackStation(
     PaintUtilSetGeneralSupportHeight(session, height + 48, 0x20);
 }
 
-/** rct2: 0x008B04A0 */
-static void InvertedImpulseRCTrack25DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19672), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19673), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19674), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19675), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-    }
-
-    PaintUtilSetSegmentSupportHeight(
-        session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
-    {
-        switch (direction)
-        {
-            case 0:
-                MetalASupportsPaintSetup(
-                    session, METAL_SUPPORTS_TUBES_INVERTED, 6, 0, height + 62, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                MetalASupportsPaintSetup(
-                    session, METAL_SUPPORTS_TUBES_INVERTED, 8, 0, height + 62, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                MetalASupportsPaintSetup(
-                    session, METAL_SUPPORTS_TUBES_INVERTED, 7, 0, height + 62, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                MetalASupportsPaintSetup(
-                    session, METAL_SUPPORTS_TUBES_INVERTED, 5, 0, height + 62, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-
-    if (direction == 0 || direction == 3)
-    {
-        PaintUtilPushTunnelRotated(session, direction, height - 8, TUNNEL_INVERTED_4);
-    }
-    else
-    {
-        PaintUtilPushTunnelRotated(session, direction, height + 8, TUNNEL_INVERTED_5);
-    }
-    PaintUtilSetGeneralSupportHeight(session, height + 72, 0x20);
-}
-
-/** rct2: 0x008B04B0 */
-static void InvertedImpulseRCTrack60DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19688), { 0, 0, height + 29 },
-                { { 0, 6, height + 93 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19689), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 81 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19690), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 81 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19691), { 0, 0, height + 29 },
-                { { 0, 6, height + 93 }, { 32, 20, 3 } });
-            break;
-    }
-    if (direction == 0 || direction == 3)
-    {
-        PaintUtilPushTunnelRotated(session, direction, height - 8, TUNNEL_INVERTED_4);
-    }
-    else
-    {
-        PaintUtilPushTunnelRotated(session, direction, height + 56, TUNNEL_INVERTED_5);
-    }
-    PaintUtilSetSegmentSupportHeight(
-        session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    PaintUtilSetGeneralSupportHeight(session, height + 120, 0x20);
-}
-
-/** rct2: 0x008B04C0 */
-static void InvertedImpulseRCTrackFlatTo25DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19664), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19665), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19666), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19667), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
-
-    PaintUtilSetSegmentSupportHeight(
-        session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    switch (direction)
-    {
-        case 0:
-            MetalASupportsPaintSetup(
-                session, METAL_SUPPORTS_TUBES_INVERTED, 6, 0, height + 54, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 1:
-            MetalASupportsPaintSetup(
-                session, METAL_SUPPORTS_TUBES_INVERTED, 8, 0, height + 54, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 2:
-            MetalASupportsPaintSetup(
-                session, METAL_SUPPORTS_TUBES_INVERTED, 7, 0, height + 54, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 3:
-            MetalASupportsPaintSetup(
-                session, METAL_SUPPORTS_TUBES_INVERTED, 5, 0, height + 54, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-    }
-
-    if (direction == 0 || direction == 3)
-    {
-        PaintUtilPushTunnelRotated(session, direction, height, TUNNEL_INVERTED_3);
-    }
-    else
-    {
-        PaintUtilPushTunnelRotated(session, direction, height, TUNNEL_INVERTED_5);
-    }
-    PaintUtilSetGeneralSupportHeight(session, height + 64, 0x20);
-}
-
-/** rct2: 0x008B04D0 */
-static void InvertedImpulseRCTrack25DegUpTo60DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19676), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19680), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19677), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19681), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19678), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19679), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-    }
-    if (direction == 0 || direction == 3)
-    {
-        PaintUtilPushTunnelRotated(session, direction, height - 8, TUNNEL_INVERTED_4);
-    }
-    else
-    {
-        PaintUtilPushTunnelRotated(session, direction, height + 24, TUNNEL_INVERTED_5);
-    }
-    PaintUtilSetSegmentSupportHeight(
-        session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    PaintUtilSetGeneralSupportHeight(session, height + 88, 0x20);
-}
-
-/** rct2: 0x008B04E0 */
-static void InvertedImpulseRCTrack60DegUpTo25DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19682), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19686), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19683), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19687), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19684), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19685), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-    }
-    if (direction == 0 || direction == 3)
-    {
-        PaintUtilPushTunnelRotated(session, direction, height - 8, TUNNEL_INVERTED_4);
-    }
-    else
-    {
-        PaintUtilPushTunnelRotated(session, direction, height + 24, TUNNEL_INVERTED_5);
-    }
-    PaintUtilSetSegmentSupportHeight(
-        session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    PaintUtilSetGeneralSupportHeight(session, height + 88, 0x20);
-}
-
-/** rct2: 0x008B04F0 */
-static void InvertedImpulseRCTrack25DegUpToFlat(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19668), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19669), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19670), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19671), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
-
-    PaintUtilSetSegmentSupportHeight(
-        session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    switch (direction)
-    {
-        case 0:
-            MetalASupportsPaintSetup(
-                session, METAL_SUPPORTS_TUBES_INVERTED, 6, 0, height + 52, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 1:
-            MetalASupportsPaintSetup(
-                session, METAL_SUPPORTS_TUBES_INVERTED, 8, 0, height + 52, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 2:
-            MetalASupportsPaintSetup(
-                session, METAL_SUPPORTS_TUBES_INVERTED, 7, 0, height + 52, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 3:
-            MetalASupportsPaintSetup(
-                session, METAL_SUPPORTS_TUBES_INVERTED, 5, 0, height + 52, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-    }
-
-    if (direction == 0 || direction == 3)
-    {
-        PaintUtilPushTunnelRotated(session, direction, height - 8, TUNNEL_INVERTED_3);
-    }
-    else
-    {
-        PaintUtilPushTunnelRotated(session, direction, height + 8, TUNNEL_13);
-    }
-    PaintUtilSetGeneralSupportHeight(session, height + 56, 0x20);
-}
-
-/** rct2: 0x008B0500 */
-static void InvertedImpulseRCTrack25DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    InvertedImpulseRCTrack25DegUp(session, ride, trackSequence, (direction + 2) & 3, height, trackElement);
-}
-
-/** rct2: 0x008B0510 */
-static void InvertedImpulseRCTrack60DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    InvertedImpulseRCTrack60DegUp(session, ride, trackSequence, (direction + 2) & 3, height, trackElement);
-}
-
-/** rct2: 0x008B0520 */
-static void InvertedImpulseRCTrackFlatTo25DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    InvertedImpulseRCTrack25DegUpToFlat(session, ride, trackSequence, (direction + 2) & 3, height, trackElement);
-}
-
-/** rct2: 0x008B0530 */
-static void InvertedImpulseRCTrack25DegDownTo60DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    InvertedImpulseRCTrack60DegUpTo25DegUp(session, ride, trackSequence, (direction + 2) & 3, height, trackElement);
-}
-
-/** rct2: 0x008B0540 */
-static void InvertedImpulseRCTrack60DegDownTo25DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    InvertedImpulseRCTrack25DegUpTo60DegUp(session, ride, trackSequence, (direction + 2) & 3, height, trackElement);
-}
-
-/** rct2: 0x008B0550 */
-static void InvertedImpulseRCTrack25DegDownToFlat(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    InvertedImpulseRCTrackFlatTo25DegUp(session, ride, trackSequence, (direction + 2) & 3, height, trackElement);
-}
-
-/** rct2: 0x008B05A0 */
-static void InvertedImpulseRCTrack90DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19700), { 0, 0, height + 29 },
-                        { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19701), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19702), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19703), { 0, 0, height + 29 },
-                        { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                    break;
-            }
-            PaintUtilSetVerticalTunnel(session, height + 32);
-            PaintUtilSetSegmentSupportHeight(
-                session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 32, 0x20);
-            break;
-        case 1:
-            break;
-    }
-}
-
-/** rct2: 0x008B05B0 */
-static void InvertedImpulseRCTrack90DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    InvertedImpulseRCTrack90DegUp(session, ride, trackSequence, (direction + 2) & 3, height, trackElement);
-}
-
-/** rct2: 0x008B0560 */
-static void InvertedImpulseRCTrack60DegUpTo90DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19692), { 0, 0, height + 29 },
-                        { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19693), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19694), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19695), { 0, 0, height + 29 },
-                        { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                    break;
-            }
-            if (direction == 0 || direction == 3)
-            {
-                PaintUtilPushTunnelRotated(session, direction, height - 8, TUNNEL_INVERTED_4);
-            }
-            PaintUtilSetVerticalTunnel(session, height + 56);
-            PaintUtilSetSegmentSupportHeight(
-                session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 72, 0x20);
-            break;
-        case 1:
-            break;
-    }
-}
-
-/** rct2: 0x008B0570 */
-static void InvertedImpulseRCTrack90DegDownTo60DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    InvertedImpulseRCTrack60DegUpTo90DegUp(session, ride, trackSequence, (direction + 2) & 3, height, trackElement);
-}
-
-/** rct2: 0x008B0580 */
-static void InvertedImpulseRCTrack90DegUpTo60DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19696), { 0, 0, height + 29 },
-                { { 0, 6, height + 85 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19697), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 55 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19698), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 55 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19699), { 0, 0, height + 29 },
-                { { 0, 6, height + 85 }, { 32, 20, 3 } });
-            break;
-    }
-    switch (direction)
-    {
-        case 1:
-            PaintUtilPushTunnelRight(session, height + 48, TUNNEL_INVERTED_5);
-            break;
-        case 2:
-            PaintUtilPushTunnelLeft(session, height + 48, TUNNEL_INVERTED_5);
-            break;
-    }
-    PaintUtilSetSegmentSupportHeight(
-        session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-    PaintUtilSetGeneralSupportHeight(session, height + 96, 0x20);
-}
-
-/** rct2: 0x008B0590 */
-static void InvertedImpulseRCTrack60DegDownTo90DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19698), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19699), { 0, 0, height + 29 },
-                        { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19696), { 0, 0, height + 29 },
-                        { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19697), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                    break;
-            }
-            if (direction == 0 || direction == 3)
-            {
-                PaintUtilPushTunnelRotated(session, direction, height + 48, TUNNEL_INVERTED_5);
-            }
-            PaintUtilSetSegmentSupportHeight(
-                session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 96, 0x20);
-            break;
-        case 1:
-            break;
-    }
-}
-
-/** rct2: 0x008B05C0 */
-static void InvertedImpulseRCTrackLeftQuarterTurn190DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19708), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19709), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19717), { 0, 0, height + 29 },
-                        { { 4, 0, height + 11 }, { 2, 32, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19710), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19718), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19711), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19719), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-            }
-            PaintUtilSetVerticalTunnel(session, height + 96);
-            PaintUtilSetSegmentSupportHeight(
-                session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 96, 0x20);
-            break;
-        case 1:
-            break;
-    }
-}
-
-/** rct2: 0x008B05D0 */
-static void InvertedImpulseRCTrackRightQuarterTurn190DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19704), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19712), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19705), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19713), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19706), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19714), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours[SCHEME_TRACK].WithIndex(19707), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    break;
-            }
-            PaintUtilSetVerticalTunnel(session, height + 96);
-            PaintUtilSetSegmentSupportHeight(
-                session, PaintUtilRotateSegments(SEGMENT_C4 | SEGMENT_CC | SEGMENT_D0, direction), 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 96, 0x20);
-            break;
-        case 1:
-            break;
-    }
-}
-
-/** rct2: 0x008B05E0 */
-static void InvertedImpulseRCTrackLeftQuarterTurn190DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    InvertedImpulseRCTrackRightQuarterTurn190DegUp(session, ride, trackSequence, (direction + 1) & 3, height, trackElement);
-}
-
-/** rct2: 0x008B05F0 */
-static void InvertedImpulseRCTrackRightQuarterTurn190DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    InvertedImpulseRCTrackLeftQuarterTurn190DegUp(session, ride, trackSequence, (direction - 1) & 3, height, trackElement);
-}
-
 TRACK_PAINT_FUNCTION GetTrackPaintFunctionInvertedImpulseRC(int32_t trackType)
 {
     switch (trackType)
     {
         case TrackElemType::Flat:
-            return InvertedImpulseRCTrackFlat;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrackFlat>;
         case TrackElemType::EndStation:
         case TrackElemType::BeginStation:
         case TrackElemType::MiddleStation:
             return InvertedImpulseRCTrackStation;
         case TrackElemType::Up25:
-            return InvertedImpulseRCTrack25DegUp;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack25DegUp>;
         case TrackElemType::Up60:
-            return InvertedImpulseRCTrack60DegUp;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack60DegUp>;
         case TrackElemType::FlatToUp25:
-            return InvertedImpulseRCTrackFlatTo25DegUp;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrackFlatTo25DegUp>;
         case TrackElemType::Up25ToUp60:
-            return InvertedImpulseRCTrack25DegUpTo60DegUp;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack25DegUpTo60DegUp>;
         case TrackElemType::Up60ToUp25:
-            return InvertedImpulseRCTrack60DegUpTo25DegUp;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack60DegUpTo25DegUp>;
         case TrackElemType::Up25ToFlat:
-            return InvertedImpulseRCTrack25DegUpToFlat;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack25DegUpToFlat>;
         case TrackElemType::Down25:
-            return InvertedImpulseRCTrack25DegDown;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack25DegUp, 2>;
         case TrackElemType::Down60:
-            return InvertedImpulseRCTrack60DegDown;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack60DegUp, 2>;
         case TrackElemType::FlatToDown25:
-            return InvertedImpulseRCTrackFlatTo25DegDown;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack25DegUpToFlat, 2>;
         case TrackElemType::Down25ToDown60:
-            return InvertedImpulseRCTrack25DegDownTo60DegDown;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack60DegUpTo25DegUp, 2>;
         case TrackElemType::Down60ToDown25:
-            return InvertedImpulseRCTrack60DegDownTo25DegDown;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack25DegUpTo60DegUp, 2>;
         case TrackElemType::Down25ToFlat:
-            return InvertedImpulseRCTrack25DegDownToFlat;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrackFlatTo25DegUp, 2>;
         case TrackElemType::Up90:
-            return InvertedImpulseRCTrack90DegUp;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack90DegUp>;
         case TrackElemType::Down90:
-            return InvertedImpulseRCTrack90DegDown;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack90DegUp, 2>;
         case TrackElemType::Up60ToUp90:
-            return InvertedImpulseRCTrack60DegUpTo90DegUp;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack60DegUpTo90DegUp>;
         case TrackElemType::Down90ToDown60:
-            return InvertedImpulseRCTrack90DegDownTo60DegDown;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack60DegUpTo90DegUp, 2>;
         case TrackElemType::Up90ToUp60:
-            return InvertedImpulseRCTrack90DegUpTo60DegUp;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack90DegUpTo60DegUp>;
         case TrackElemType::Down60ToDown90:
-            return InvertedImpulseRCTrack60DegDownTo90DegDown;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrack60DegDownTo90DegDown>;
         case TrackElemType::LeftQuarterTurn1TileUp90:
-            return InvertedImpulseRCTrackLeftQuarterTurn190DegUp;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrackLeftQuarterTurn190DegUp>;
         case TrackElemType::RightQuarterTurn1TileUp90:
-            return InvertedImpulseRCTrackRightQuarterTurn190DegUp;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrackRightQuarterTurn190DegUp>;
         case TrackElemType::LeftQuarterTurn1TileDown90:
-            return InvertedImpulseRCTrackLeftQuarterTurn190DegDown;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrackRightQuarterTurn190DegUp, 1>;
         case TrackElemType::RightQuarterTurn1TileDown90:
-            return InvertedImpulseRCTrackRightQuarterTurn190DegDown;
+            return TrackPaintPieceFunction<InvertedImpulseRCTrackLeftQuarterTurn190DegUp, 3>;
     }
     return nullptr;
 }
@@ -333,7 +333,13 @@ static void ScenarioWeekUpdate()
     MarketingUpdate();
     PeepProblemWarningsUpdate();
     RideCheckAllReachable();
-    RideUpdateFavouritedStat();
+#if DEBUG_LEVEL_1
+    if (!RideValidateFavouritedStat())
+    {
+        Guard::Fail("Favourite ride counts are out of sync");
+        RideUpdateFavouritedStat();
+    }
+#endif
 
     auto water_type = static_cast<WaterObjectEntry*>(ObjectEntryGetChunk(ObjectType::Water, 0));
 
@@ -439,8 +445,8 @@ bool ScenarioCreateDucks()
     constexpr int32_t SquareRadiusSize = SquareCentre * 32;
 
     CoordsXY centrePos;
-    centrePos.x = SquareRadiusSize + (ScenarioRandMax(gMapSize.x - SquareCentre) * 32);
-    centrePos.y = SquareRadiusSize + (ScenarioRandMax(gMapSize.y - SquareCentre) * 32);
+    centrePos.x = SquareRadiusSize + (ScenarioRandMax(GetMapSize().x - SquareCentre) * 32);
+    centrePos.y = SquareRadiusSize + (ScenarioRandMax(GetMapSize().y - SquareCentre) * 32);
 
     Guard::Assert(MapIsLocationValid(centrePos));
 
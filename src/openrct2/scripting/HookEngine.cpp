@@ -11,9 +11,14 @@
 
 #    include "HookEngine.h"
 
+#    include "../config/Config.h"
 #    include "../core/EnumMap.hpp"
+#    include "../core/String.hpp"
+#    include "../interface/InteractiveConsole.h"
 #    include "ScriptEngine.h"
 
+#    include <algorithm>
+#    include <chrono>
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
@@ -42,6 +47,12 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    auto result = HooksLookupTable.find(type);
+    return (result != HooksLookupTable.end()) ? result->first : std::string_view();
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -52,11 +63,13 @@ HookEngine::HookEngine(ScriptEngine& scriptEngine)
     }
 }
 
-uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function)
+uint32_t HookEngine::Subscribe(
+    HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, std::vector<std::string> filter)
 {
     auto& hookList = GetHookList(type);
     auto cookie = _nextCookie++;
-    hookList.Hooks.emplace_back(cookie, owner, function);
+    hookList.Hooks.emplace_back(cookie, owner, function, std::move(filter));
+    RebuildFilterIndex(hookList);
     return cookie;
 }
 
@@ -69,6 +82,7 @@ void HookEngine::Unsubscribe(HOOK_TYPE type, uint32_t cookie)
         if (it->Cookie == cookie)
         {
             hooks.erase(it);
+            RebuildFilterIndex(hookList);
             break;
         }
     }
@@ -81,6 +95,7 @@ void HookEngine::UnsubscribeAll(std::shared_ptr<const Plugin> owner)
         auto& hooks = hookList.Hooks;
         auto isOwner = [&](auto& obj) { return obj.Owner == owner; };
         hooks.erase(std::remove_if(hooks.begin(), hooks.end(), isOwner), hooks.end());
+        RebuildFilterIndex(hookList);
     }
 }
 
@@ -90,6 +105,7 @@ void HookEngine::UnsubscribeAll()
     {
         auto& hooks = hookList.Hooks;
         hooks.clear();
+        RebuildFilterIndex(hookList);
     }
 }
 
@@ -99,6 +115,12 @@ bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
     return !hookList.Hooks.empty();
 }
 
+bool HookEngine::HasSubscriptions(HOOK_TYPE type, const std::string& filterValue) const
+{
+    auto& hookList = GetHookList(type);
+    return !GetFilteredHooks(hookList, filterValue).empty();
+}
+
 bool HookEngine::IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const
 {
     if (type == HOOK_TYPE::MAP_CHANGED && plugin.GetMetadata().Type != PluginType::Intransient)
@@ -111,18 +133,42 @@ bool HookEngine::IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
+    for (size_t i = 0; i < hookList.Hooks.size(); i++)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        CallHook(hookList, i, {}, isGameStateMutable);
     }
 }
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
+    const std::vector<DukValue> args{ arg };
+    for (size_t i = 0; i < hookList.Hooks.size(); i++)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        CallHook(hookList, i, args, isGameStateMutable);
+    }
+}
+
+void HookEngine::Call(HOOK_TYPE type, const std::string& filterValue, const DukValue& arg, bool isGameStateMutable)
+{
+    auto& hookList = GetHookList(type);
+    const std::vector<DukValue> args{ arg };
+
+    // The hooks may subscribe or unsubscribe hooks which rebuilds the index, so the hooks to call are decided up front
+    std::vector<uint32_t> cookies;
+    for (auto index : GetFilteredHooks(hookList, filterValue))
+    {
+        cookies.push_back(hookList.Hooks[index].Cookie);
+    }
+
+    const auto& hooks = hookList.Hooks;
+    for (auto cookie : cookies)
+    {
+        auto it = std::find_if(hooks.begin(), hooks.end(), [cookie](const Hook& h) { return h.Cookie == cookie; });
+        if (it != hooks.end())
+        {
+            CallHook(hookList, static_cast<size_t>(it - hooks.begin()), args, isGameStateMutable);
+        }
     }
 }
 
@@ -130,8 +176,13 @@ void HookEngine::Call(
     HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
+    for (size_t i = 0; i < hookList.Hooks.size(); i++)
     {
+        if (hookList.Hooks[i].Disabled)
+        {
+            continue;
+        }
+
         auto ctx = _scriptEngine.GetContext();
 
         // Convert key/value pairs into an object
@@ -157,7 +208,105 @@ void HookEngine::Call(
 
         std::vector<DukValue> dukArgs;
         dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+        CallHook(hookList, i, dukArgs, isGameStateMutable);
+    }
+}
+
+void HookEngine::CallHook(HookList& hookList, size_t index, const std::vector<DukValue>& args, bool isGameStateMutable)
+{
+    auto& hook = hookList.Hooks[index];
+    if (hook.Disabled)
+    {
+        return;
+    }
+
+    // The hook may subscribe or unsubscribe hooks, so it is looked up again by its cookie afterwards
+    const auto cookie = hook.Cookie;
+    const auto heapSizeBefore = _scriptEngine.GetHeapSize();
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, args, isGameStateMutable);
+    const auto endTime = std::chrono::high_resolution_clock::now();
+
+    auto& hooks = hookList.Hooks;
+    auto it = std::find_if(hooks.begin(), hooks.end(), [cookie](const Hook& h) { return h.Cookie == cookie; });
+    if (it == hooks.end())
+    {
+        return;
+    }
+
+    const auto time = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    auto& statistics = it->Statistics;
+    statistics.CallCount++;
+    statistics.TotalTime += time;
+    statistics.MaxTime = std::max(statistics.MaxTime, time);
+    statistics.HeapGrowth += static_cast<int64_t>(_scriptEngine.GetHeapSize()) - static_cast<int64_t>(heapSizeBefore);
+    CheckHookBudget(hookList, *it, time);
+}
+
+// Whether a hook can stop being called without changing the outcome of game actions or the game tick
+static bool CanDisableHook(HOOK_TYPE type)
+{
+    switch (type)
+    {
+        case HOOK_TYPE::ACTION_QUERY:
+        case HOOK_TYPE::ACTION_EXECUTE:
+        case HOOK_TYPE::ACTION_LOCATION:
+        case HOOK_TYPE::INTERVAL_TICK:
+        case HOOK_TYPE::INTERVAL_DAY:
+        case HOOK_TYPE::RIDE_RATINGS_CALCULATE:
+        case HOOK_TYPE::GUEST_GENERATION:
+        case HOOK_TYPE::VEHICLE_CRASH:
+            return false;
+        default:
+            return true;
+    }
+}
+
+void HookEngine::CheckHookBudget(HookList& hookList, Hook& hook, double time)
+{
+    const auto budget = gConfigPlugin.HookTimeBudget;
+    if (budget <= 0 || time <= budget)
+    {
+        return;
+    }
+
+    hook.Statistics.OverBudgetCount++;
+    if (hook.Statistics.OverBudgetCount != 1)
+    {
+        return;
+    }
+
+    const auto& pluginName = hook.Owner->GetMetadata().Name;
+    auto message = String::StdFormat(
+        "Plugin %s took %.2f ms in %s, the budget is %.2f ms.", pluginName.c_str(), time,
+        std::string(GetHookName(hookList.Type)).c_str(), budget);
+    LOG_WARNING("%s", message.c_str());
+
+    const auto action = gConfigPlugin.HookBudgetAction;
+    if (action == PluginHookBudgetAction::Log)
+    {
+        return;
+    }
+
+    // Remote plugins run on every client in the same way, disabling their hooks on one of them would desynchronise it.
+    // Hooks of actions and the tick only get the warning, a plugin that stopped seeing them would break its own state.
+    if (action == PluginHookBudgetAction::Disable && hook.Owner->GetMetadata().Type != PluginType::Remote
+        && CanDisableHook(hookList.Type))
+    {
+        hook.Disabled = true;
+        message += " The hook has been disabled.";
+    }
+    _scriptEngine.GetConsole().WriteLineWarning(message);
+}
+
+void HookEngine::ResetStatistics()
+{
+    for (auto& hookList : _hookMap)
+    {
+        for (auto& hook : hookList.Hooks)
+        {
+            hook.Statistics = {};
+        }
     }
 }
 
@@ -173,4 +322,52 @@ const HookList& HookEngine::GetHookList(HOOK_TYPE type) const
     return _hookMap[index];
 }
 
+const std::vector<size_t>& HookEngine::GetFilteredHooks(const HookList& hookList, const std::string& filterValue) const
+{
+    auto it = hookList.FilterIndex.find(filterValue);
+    return it != hookList.FilterIndex.end() ? it->second : hookList.UnfilteredHooks;
+}
+
+void HookEngine::RebuildFilterIndex(HookList& hookList)
+{
+    auto& filterIndex = hookList.FilterIndex;
+    auto& unfilteredHooks = hookList.UnfilteredHooks;
+    filterIndex.clear();
+    unfilteredHooks.clear();
+
+    const auto& hooks = hookList.Hooks;
+    for (size_t i = 0; i < hooks.size(); i++)
+    {
+        for (const auto& value : hooks[i].Filter)
+        {
+            filterIndex.try_emplace(value);
+        }
+    }
+
+    for (size_t i = 0; i < hooks.size(); i++)
+    {
+        const auto& filter = hooks[i].Filter;
+        if (filter.empty())
+        {
+            unfilteredHooks.push_back(i);
+            for (auto& entry : filterIndex)
+            {
+                entry.second.push_back(i);
+            }
+        }
+        else
+        {
+            for (const auto& value : filter)
+            {
+                // The filter may list a value more than once
+                auto& indices = filterIndex[value];
+                if (indices.empty() || indices.back() != i)
+                {
+                    indices.push_back(i);
+                }
+            }
+        }
+    }
+}
+
 #endif
@@ -18,6 +18,7 @@
 #    include <memory>
 #    include <string>
 #    include <tuple>
+#    include <unordered_map>
 #    include <vector>
 
 namespace OpenRCT2::Scripting
@@ -48,18 +49,37 @@ namespace OpenRCT2::Scripting
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookName(HOOK_TYPE type);
+
+    struct HookStatistics
+    {
+        uint64_t CallCount{};
+        // Times are in milliseconds
+        double TotalTime{};
+        double MaxTime{};
+        // Net change of the duktape heap size in bytes across all calls
+        int64_t HeapGrowth{};
+        // Number of calls that took longer than the configured budget
+        uint64_t OverBudgetCount{};
+    };
 
     struct Hook
     {
         uint32_t Cookie;
         std::shared_ptr<Plugin> Owner;
         DukValue Function;
+        // Values the hook is called for, e.g. action names, the hook is called for all values when empty
+        std::vector<std::string> Filter;
+        HookStatistics Statistics;
+        // Set when the hook went over its budget and is no longer called
+        bool Disabled{};
 
         Hook() = default;
-        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function)
+        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function, std::vector<std::string> filter)
             : Cookie(cookie)
             , Owner(owner)
             , Function(function)
+            , Filter(std::move(filter))
         {
         }
     };
@@ -68,6 +88,10 @@ namespace OpenRCT2::Scripting
     {
         HOOK_TYPE Type{};
         std::vector<Hook> Hooks;
+        // Indices of the hooks to call for each filtered value in subscription order, including the hooks without a
+        // filter. Values no hook filters on only call the hooks without a filter. Rebuilt when hooks are added or removed.
+        std::unordered_map<std::string, std::vector<size_t>> FilterIndex;
+        std::vector<size_t> UnfilteredHooks;
 
         HookList() = default;
         HookList(const HookList&) = delete;
@@ -84,20 +108,34 @@ namespace OpenRCT2::Scripting
     public:
         HookEngine(ScriptEngine& scriptEngine);
         HookEngine(const HookEngine&) = delete;
-        uint32_t Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function);
+        uint32_t Subscribe(
+            HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, std::vector<std::string> filter = {});
         void Unsubscribe(HOOK_TYPE type, uint32_t cookie);
         void UnsubscribeAll(std::shared_ptr<const Plugin> owner);
         void UnsubscribeAll();
         bool HasSubscriptions(HOOK_TYPE type) const;
+        bool HasSubscriptions(HOOK_TYPE type, const std::string& filterValue) const;
         bool IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const;
         void Call(HOOK_TYPE type, bool isGameStateMutable);
         void Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable);
+        // Only calls the hooks without a filter and the hooks whose filter contains the given value
+        void Call(HOOK_TYPE type, const std::string& filterValue, const DukValue& arg, bool isGameStateMutable);
         void Call(
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
+        const std::vector<HookList>& GetHookLists() const
+        {
+            return _hookMap;
+        }
+        void ResetStatistics();
+
     private:
         HookList& GetHookList(HOOK_TYPE type);
         const HookList& GetHookList(HOOK_TYPE type) const;
+        const std::vector<size_t>& GetFilteredHooks(const HookList& hookList, const std::string& filterValue) const;
+        void RebuildFilterIndex(HookList& hookList);
+        void CallHook(HookList& hookList, size_t index, const std::vector<DukValue>& args, bool isGameStateMutable);
+        void CheckHookBudget(HookList& hookList, Hook& hook, double time);
     };
 } // namespace OpenRCT2::Scripting
 
@@ -15,6 +15,7 @@
 #    include "../OpenRCT2.h"
 #    include "../core/File.h"
 #    include "Duktape.hpp"
+#    include "PluginBytecodeCache.h"
 #    include "ScriptEngine.h"
 
 #    include <algorithm>
@@ -63,9 +64,16 @@ void Plugin::Load()
         "     })(" + projectedVariables + ");";
     // clang-format on
 
-    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
-    auto result = duk_eval_raw(_context, code.c_str(), code.size(), flags);
-    if (result != DUK_ERR_NONE)
+    // Plugins sent by a server have no path, their entries are named after the code instead
+    auto cacheName = HasPath() ? std::string_view(_path) : std::string_view(code);
+    auto result = DUK_EXEC_ERROR;
+    if (PluginBytecodeCache::PushFunction(_context, cacheName, code))
+    {
+        // Same as duk_eval_raw, see GH-164 in duktape for the explicit 'this' binding
+        duk_push_global_object(_context);
+        result = duk_pcall_method(_context, 0);
+    }
+    if (result != DUK_EXEC_SUCCESS)
     {
         auto val = std::string(duk_safe_to_string(_context, -1));
         duk_pop(_context);
@@ -0,0 +1,234 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "PluginBytecodeCache.h"
+
+#    include "../Context.h"
+#    include "../Diagnostic.h"
+#    include "../PlatformEnvironment.h"
+#    include "../Version.h"
+#    include "../core/Crypt.h"
+#    include "../core/File.h"
+#    include "../core/FileStream.h"
+#    include "../core/FileSystem.hpp"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
+#    include "Duktape.hpp"
+#    include "ScriptEngine.h"
+
+#    include <array>
+#    include <chrono>
+#    include <cstring>
+#    include <mutex>
+#    include <random>
+
+using namespace OpenRCT2;
+
+namespace OpenRCT2::Scripting::PluginBytecodeCache
+{
+    constexpr uint32_t MAGIC_NUMBER = 0x43425350; // PSBC
+    // Increment when the file layout changes
+    constexpr uint32_t VERSION = 1;
+    // Entries that were not used for this long are removed. Plugins sent by a server get a new entry for every version
+    // of their code, those of servers that are no longer joined would otherwise stay forever.
+    constexpr auto MAX_ENTRY_AGE = std::chrono::hours(24 * 30);
+
+    // The file is the header, the key and then the bytecode
+    struct CacheHeader
+    {
+        uint32_t MagicNumber = MAGIC_NUMBER;
+        uint32_t Version = VERSION;
+        uint64_t KeyLength = 0;
+        uint64_t BytecodeLength = 0;
+        // Duktape trusts the bytecode it loads, so guard against files that were truncated or damaged on disk
+        std::array<uint8_t, 8> BytecodeHash{};
+    };
+    static_assert(sizeof(CacheHeader) == 32);
+
+    static std::string ToHex(const uint8_t* data, size_t dataLen)
+    {
+        std::string result;
+        result.reserve(dataLen * 2);
+        for (size_t i = 0; i < dataLen; i++)
+        {
+            result += String::StdFormat("%02x", data[i]);
+        }
+        return result;
+    }
+
+    static void Prune(const u8string& directory)
+    {
+        try
+        {
+            const auto now = fs::file_time_type::clock::now();
+            std::error_code ec;
+            for (const auto& entry : fs::directory_iterator(fs::u8path(directory), ec))
+            {
+                // Also removes temporary files left behind by writes that were interrupted
+                auto lastWriteTime = entry.last_write_time(ec);
+                if (!ec && now - lastWriteTime > MAX_ENTRY_AGE)
+                {
+                    fs::remove(entry.path(), ec);
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to prune plugin cache '%s': %s", directory.c_str(), e.what());
+        }
+    }
+
+    static u8string GetCachePath(std::string_view name)
+    {
+        auto env = GetContext()->GetPlatformEnvironment();
+        auto directory = env->GetDirectoryPath(DIRBASE::CACHE, DIRID::PLUGIN_CACHE);
+
+        static std::once_flag pruneFlag;
+        std::call_once(pruneFlag, [&directory]() { Prune(directory); });
+
+        auto hash = Crypt::FNV1a(name.data(), name.size());
+        return Path::Combine(directory, ToHex(hash.data(), hash.size()) + u8".dat");
+    }
+
+    static std::string GetKey(std::string_view code)
+    {
+        // The bytecode format is specific to the duktape version and build configuration, the latter is covered by
+        // the full game version as duktape is built with the game.
+        auto key = String::StdFormat(
+            "%s;duktape %ld;api %d;ptr %zu\n", gVersionInfoFull, static_cast<long>(DUK_VERSION),
+            OPENRCT2_PLUGIN_API_VERSION, sizeof(void*));
+        key.append(code);
+        return key;
+    }
+
+    static duk_ret_t LoadFunction(duk_context* ctx, void*)
+    {
+        duk_load_function(ctx);
+        return 1;
+    }
+
+    static bool TryPushCachedFunction(duk_context* ctx, const u8string& path, std::string_view key)
+    {
+        if (!File::Exists(path))
+        {
+            return false;
+        }
+
+        try
+        {
+            auto data = File::ReadAllBytes(path);
+
+            CacheHeader header;
+            if (data.size() < sizeof(header))
+            {
+                return false;
+            }
+            std::memcpy(&header, data.data(), sizeof(header));
+
+            const uint64_t expectedSize = sizeof(header) + header.KeyLength + header.BytecodeLength;
+            if (header.MagicNumber != MAGIC_NUMBER || header.Version != VERSION || header.KeyLength != key.size()
+                || expectedSize != data.size())
+            {
+                return false;
+            }
+
+            const auto* keyData = data.data() + sizeof(header);
+            if (std::memcmp(keyData, key.data(), key.size()) != 0)
+            {
+                return false;
+            }
+
+            const auto* bytecode = keyData + header.KeyLength;
+            const auto bytecodeLength = static_cast<size_t>(header.BytecodeLength);
+            if (Crypt::FNV1a(bytecode, bytecodeLength) != header.BytecodeHash)
+            {
+                return false;
+            }
+
+            auto* buffer = duk_push_fixed_buffer(ctx, bytecodeLength);
+            std::memcpy(buffer, bytecode, bytecodeLength);
+            if (duk_safe_call(ctx, LoadFunction, nullptr, 1, 1) != DUK_EXEC_SUCCESS)
+            {
+                LOG_VERBOSE("Unable to load plugin cache '%s': %s", path.c_str(), duk_safe_to_string(ctx, -1));
+                duk_pop(ctx);
+                return false;
+            }
+
+            // The modification time tells when the entry was last used, see Prune
+            std::error_code ec;
+            fs::last_write_time(fs::u8path(path), fs::file_time_type::clock::now(), ec);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to read plugin cache '%s': %s", path.c_str(), e.what());
+            return false;
+        }
+    }
+
+    static void Write(const u8string& path, std::string_view key, const void* bytecode, size_t bytecodeLength)
+    {
+        auto tempPath = path + u8"." + std::to_string(std::random_device{}()) + u8".tmp";
+        try
+        {
+            CacheHeader header;
+            header.KeyLength = key.size();
+            header.BytecodeLength = bytecodeLength;
+            header.BytecodeHash = Crypt::FNV1a(bytecode, bytecodeLength);
+
+            Path::CreateDirectory(Path::GetDirectory(path));
+            {
+                auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+                fs.WriteValue(header);
+                fs.Write(key.data(), key.size());
+                fs.Write(bytecode, bytecodeLength);
+            }
+
+            // Replace any entry compiled from an older version of the code
+            File::Delete(path);
+            if (!File::Move(tempPath, path))
+            {
+                File::Delete(tempPath);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_VERBOSE("Unable to write plugin cache '%s': %s", path.c_str(), e.what());
+            File::Delete(tempPath);
+        }
+    }
+
+    bool PushFunction(duk_context* ctx, std::string_view name, std::string_view code)
+    {
+        auto path = GetCachePath(name);
+        auto key = GetKey(code);
+        if (TryPushCachedFunction(ctx, path, key))
+        {
+            return true;
+        }
+
+        auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
+        if (duk_compile_raw(ctx, code.data(), code.size(), flags) != DUK_EXEC_SUCCESS)
+        {
+            return false;
+        }
+
+        duk_dup(ctx, -1);
+        duk_dump_function(ctx);
+        duk_size_t bytecodeLength{};
+        const auto* bytecode = duk_get_buffer(ctx, -1, &bytecodeLength);
+        Write(path, key, bytecode, bytecodeLength);
+        duk_pop(ctx);
+        return true;
+    }
+} // namespace OpenRCT2::Scripting::PluginBytecodeCache
+
+#endif
@@ -0,0 +1,38 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "../common.h"
+
+#    include <string_view>
+
+struct duk_hthread;
+typedef struct duk_hthread duk_context;
+
+/**
+ * An on-disk cache of compiled plugin scripts. Entries hold the duktape bytecode of a plugin's wrapped source and are
+ * keyed by that source and the versions of the game, the plugin API and duktape, so any change to either compiles the
+ * script again. Entries are only ever written from bytecode compiled by this process, duktape does not validate
+ * bytecode when it is loaded. Entries that were not used for 30 days are removed the first time a process uses the
+ * cache.
+ */
+namespace OpenRCT2::Scripting::PluginBytecodeCache
+{
+    /**
+     * Pushes the function compiled from the given eval code, loaded from the cache when a matching entry exists.
+     * The name identifies the entry that is replaced when the code changes, e.g. the plugin path. Returns false with
+     * the error on the stack if the code does not compile.
+     */
+    [[nodiscard]] bool PushFunction(duk_context* ctx, std::string_view name, std::string_view code);
+} // namespace OpenRCT2::Scripting::PluginBytecodeCache
+
+#endif
@@ -24,6 +24,7 @@
 #    include "../interface/InteractiveConsole.h"
 #    include "../platform/Platform.h"
 #    include "Duktape.hpp"
+#    include "ScriptWorker.h"
 #    include "bindings/entity/ScEntity.hpp"
 #    include "bindings/entity/ScGuest.hpp"
 #    include "bindings/entity/ScLitter.hpp"
@@ -35,6 +36,7 @@
 #    include "bindings/game/ScContext.hpp"
 #    include "bindings/game/ScDisposable.hpp"
 #    include "bindings/game/ScProfiler.hpp"
+#    include "bindings/game/ScWorker.hpp"
 #    include "bindings/network/ScNetwork.hpp"
 #    include "bindings/network/ScPlayer.hpp"
 #    include "bindings/network/ScPlayerGroup.hpp"
@@ -51,6 +53,8 @@
 #    include "bindings/world/ScTile.hpp"
 #    include "bindings/world/ScTileElement.hpp"
 
+#    include <cstddef>
+#    include <cstdlib>
 #    include <iostream>
 #    include <memory>
 #    include <stdexcept>
@@ -365,9 +369,60 @@ public:
     }
 };
 
+// Every allocation is prefixed with its size so that the size of the heap can be tracked
+static constexpr size_t DukAllocationHeaderSize = alignof(std::max_align_t);
+
+static void* DukAlloc(void* udata, duk_size_t size)
+{
+    auto* block = static_cast<uint8_t*>(std::malloc(DukAllocationHeaderSize + size));
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+    *reinterpret_cast<size_t*>(block) = size;
+    *static_cast<size_t*>(udata) += size;
+    return block + DukAllocationHeaderSize;
+}
+
+static void DukFree(void* udata, void* ptr)
+{
+    if (ptr != nullptr)
+    {
+        auto* block = static_cast<uint8_t*>(ptr) - DukAllocationHeaderSize;
+        *static_cast<size_t*>(udata) -= *reinterpret_cast<size_t*>(block);
+        std::free(block);
+    }
+}
+
+static void* DukRealloc(void* udata, void* ptr, duk_size_t size)
+{
+    if (ptr == nullptr)
+    {
+        return DukAlloc(udata, size);
+    }
+    if (size == 0)
+    {
+        DukFree(udata, ptr);
+        return nullptr;
+    }
+
+    auto* block = static_cast<uint8_t*>(ptr) - DukAllocationHeaderSize;
+    const auto oldSize = *reinterpret_cast<size_t*>(block);
+    auto* newBlock = static_cast<uint8_t*>(std::realloc(block, DukAllocationHeaderSize + size));
+    if (newBlock == nullptr)
+    {
+        return nullptr;
+    }
+    *reinterpret_cast<size_t*>(newBlock) = size;
+    auto& heapSize = *static_cast<size_t*>(udata);
+    heapSize = heapSize - oldSize + size;
+    return newBlock + DukAllocationHeaderSize;
+}
+
 DukContext::DukContext()
+    : _heapSize(std::make_unique<size_t>(0))
 {
-    _context = duk_create_heap_default();
+    _context = duk_create_heap(DukAlloc, DukRealloc, DukFree, _heapSize.get(), nullptr);
     if (_context == nullptr)
     {
         throw std::runtime_error("Unable to initialise duktape context.");
@@ -409,6 +464,7 @@ void ScriptEngine::Initialise()
     ScPlayer::Register(ctx);
     ScPlayerGroup::Register(ctx);
     ScProfiler::Register(ctx);
+    ScWorker::Register(ctx);
     ScRide::Register(ctx);
     ScRideStation::Register(ctx);
     ScRideObject::Register(ctx);
@@ -746,6 +802,7 @@ void ScriptEngine::StopPlugin(std::shared_ptr<Plugin> plugin)
         RemoveCustomGameActions(plugin);
         RemoveIntervals(plugin);
         RemoveSockets(plugin);
+        RemoveWorkers(plugin);
         _hookEngine.UnsubscribeAll(plugin);
 
         plugin->StopEnd();
@@ -897,6 +954,7 @@ void ScriptEngine::Tick()
     CheckAndStartPlugins();
     UpdateIntervals();
     UpdateSockets();
+    UpdateWorkers();
     ProcessREPL();
     DoAutoReloadPluginCheck();
 }
@@ -1400,15 +1458,24 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
     DukStackFrame frame(_context);
 
     auto hookType = isExecute ? HOOK_TYPE::ACTION_EXECUTE : HOOK_TYPE::ACTION_QUERY;
-    if (_hookEngine.HasSubscriptions(hookType))
+    if (!_hookEngine.HasSubscriptions(hookType))
+    {
+        return;
+    }
+
+    auto actionId = action.GetType();
+    auto actionName = actionId == GameCommand::Custom ? static_cast<const CustomAction&>(action).GetId()
+                                                      : GetActionName(actionId);
+
+    // Only marshal the action and its result if a hook is interested in this action
+    if (_hookEngine.HasSubscriptions(hookType, actionName))
     {
         DukObject obj(_context);
 
-        auto actionId = action.GetType();
-        if (action.GetType() == GameCommand::Custom)
+        if (actionId == GameCommand::Custom)
         {
-            auto customAction = static_cast<const CustomAction&>(action);
-            obj.Set("action", customAction.GetId());
+            const auto& customAction = static_cast<const CustomAction&>(action);
+            obj.Set("action", actionName);
 
             auto dukArgs = DuktapeTryParseJson(_context, customAction.GetJson());
             if (dukArgs)
@@ -1423,7 +1490,6 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
         }
         else
         {
-            auto actionName = GetActionName(actionId);
             if (!actionName.empty())
             {
                 obj.Set("action", actionName);
@@ -1445,7 +1511,7 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
         obj.Set("result", GameActionResultToDuk(action, result));
         auto dukEventArgs = obj.Take();
 
-        _hookEngine.Call(hookType, dukEventArgs, false);
+        _hookEngine.Call(hookType, actionName, dukEventArgs, false);
 
         if (!isExecute)
         {
@@ -1708,6 +1774,47 @@ void ScriptEngine::RemoveSockets(const std::shared_ptr<Plugin>& plugin)
 #    endif
 }
 
+void ScriptEngine::AddWorker(const std::shared_ptr<ScWorker>& worker)
+{
+    _workers.push_back(worker);
+}
+
+void ScriptEngine::UpdateWorkers()
+{
+    auto it = _workers.begin();
+    while (it != _workers.end())
+    {
+        auto& worker = *it;
+        worker->Update();
+        if (worker->IsTerminated())
+        {
+            it = _workers.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void ScriptEngine::RemoveWorkers(const std::shared_ptr<Plugin>& plugin)
+{
+    auto it = _workers.begin();
+    while (it != _workers.end())
+    {
+        auto worker = it->get();
+        if (worker->GetPlugin() == plugin)
+        {
+            worker->Terminate();
+            it = _workers.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
 std::string OpenRCT2::Scripting::Stringify(const DukValue& val)
 {
     return ExpressionStringifier::StringifyExpression(val);
@@ -1766,7 +1873,8 @@ int32_t OpenRCT2::Scripting::GetTargetAPIVersion()
 
 duk_bool_t duk_exec_timeout_check(void*)
 {
-    return false;
+    // Only worker scripts are interrupted, once their worker is terminated
+    return ScriptWorker::IsCurrentWorkerTerminating();
 }
 
 #endif
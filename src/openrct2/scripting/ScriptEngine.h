@@ -47,7 +47,7 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 70;
+    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 76;
 
     // Versions marking breaking changes.
     static constexpr int32_t API_VERSION_33_PEEP_DEPRECATION = 33;
@@ -57,6 +57,7 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
     class ScSocketBase;
 #    endif
+    class ScWorker;
 
     class ScriptExecutionInfo
     {
@@ -108,12 +109,15 @@ namespace OpenRCT2::Scripting
     {
     private:
         duk_context* _context{};
+        // Bytes currently allocated by the heap, owned separately as the allocator keeps a pointer to it
+        std::unique_ptr<size_t> _heapSize;
 
     public:
         DukContext();
         DukContext(DukContext&) = delete;
         DukContext(DukContext&& src) noexcept
             : _context(std::move(src._context))
+            , _heapSize(std::move(src._heapSize))
         {
             src._context = {};
         }
@@ -123,6 +127,11 @@ namespace OpenRCT2::Scripting
         {
             return _context;
         }
+
+        size_t GetHeapSize() const
+        {
+            return _heapSize != nullptr ? *_heapSize : 0;
+        }
     };
 
     using IntervalHandle = int32_t;
@@ -180,6 +189,7 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
         std::list<std::shared_ptr<ScSocketBase>> _sockets;
 #    endif
+        std::list<std::shared_ptr<ScWorker>> _workers;
 
     public:
         ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& env);
@@ -189,10 +199,18 @@ namespace OpenRCT2::Scripting
         {
             return _context;
         }
+        InteractiveConsole& GetConsole()
+        {
+            return _console;
+        }
         HookEngine& GetHookEngine()
         {
             return _hookEngine;
         }
+        size_t GetHeapSize() const
+        {
+            return _context.GetHeapSize();
+        }
         ScriptExecutionInfo& GetExecInfo()
         {
             return _execInfo;
@@ -253,6 +271,7 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
         void AddSocket(const std::shared_ptr<ScSocketBase>& socket);
 #    endif
+        void AddWorker(const std::shared_ptr<ScWorker>& worker);
 
     private:
         void RegisterConstants();
@@ -289,6 +308,9 @@ namespace OpenRCT2::Scripting
 
         void UpdateSockets();
         void RemoveSockets(const std::shared_ptr<Plugin>& plugin);
+
+        void UpdateWorkers();
+        void RemoveWorkers(const std::shared_ptr<Plugin>& plugin);
     };
 
     bool IsGameStateMutable();
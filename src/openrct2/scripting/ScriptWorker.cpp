@@ -0,0 +1,145 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "ScriptWorker.h"
+
+using namespace OpenRCT2::Scripting;
+
+static constexpr const char* WorkerStashKey = "\xff" "worker";
+
+// The worker whose script runs on this thread, checked by duk_exec_timeout_check
+static thread_local const ScriptWorker* _currentWorker;
+
+ScriptWorker::ScriptWorker(std::string code)
+    : _code(std::move(code))
+{
+    _thread = std::thread(&ScriptWorker::Run, this);
+}
+
+ScriptWorker::~ScriptWorker()
+{
+    Terminate();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+void ScriptWorker::QueueMessage(std::string json)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _inbox.push(std::move(json));
+    }
+    _inboxCondition.notify_one();
+}
+
+std::vector<ScriptWorkerMessage> ScriptWorker::ReceiveResults()
+{
+    std::vector<ScriptWorkerMessage> results;
+    std::lock_guard<std::mutex> lock(_mutex);
+    results.swap(_outbox);
+    return results;
+}
+
+void ScriptWorker::Terminate()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminating = true;
+    }
+    _inboxCondition.notify_one();
+}
+
+bool ScriptWorker::IsCurrentWorkerTerminating()
+{
+    return _currentWorker != nullptr && _currentWorker->_terminating.load(std::memory_order_relaxed);
+}
+
+void ScriptWorker::PostResult(ScriptWorkerMessage&& message)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _outbox.push_back(std::move(message));
+}
+
+bool ScriptWorker::WaitForMessage(std::string& json)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _inboxCondition.wait(lock, [this] { return _terminating || !_inbox.empty(); });
+    if (_terminating)
+    {
+        return false;
+    }
+    json = std::move(_inbox.front());
+    _inbox.pop();
+    return true;
+}
+
+duk_ret_t ScriptWorker::WorkerPostMessage(duk_context* ctx)
+{
+    duk_push_global_stash(ctx);
+    duk_get_prop_string(ctx, -1, WorkerStashKey);
+    auto* worker = static_cast<ScriptWorker*>(duk_get_pointer(ctx, -1));
+    duk_pop_2(ctx);
+
+    duk_dup(ctx, 0);
+    const auto* json = duk_json_encode(ctx, -1);
+    worker->PostResult({ json != nullptr ? json : "null", false });
+    duk_pop(ctx);
+    return 0;
+}
+
+void ScriptWorker::Run()
+{
+    // The heap is created and destroyed on the worker thread, it is never touched by any other thread
+    auto* ctx = duk_create_heap_default();
+    if (ctx == nullptr)
+    {
+        PostResult({ "Unable to initialise duktape context.", true });
+        return;
+    }
+    _currentWorker = this;
+
+    duk_push_global_stash(ctx);
+    duk_push_pointer(ctx, this);
+    duk_put_prop_string(ctx, -2, WorkerStashKey);
+    duk_pop(ctx);
+
+    duk_push_c_function(ctx, WorkerPostMessage, 1);
+    duk_put_global_string(ctx, "postMessage");
+
+    if (duk_peval_lstring(ctx, _code.data(), _code.size()) != 0 && !_terminating)
+    {
+        PostResult({ duk_safe_to_string(ctx, -1), true });
+    }
+    duk_pop(ctx);
+
+    std::string json;
+    while (WaitForMessage(json))
+    {
+        duk_get_global_string(ctx, "onmessage");
+        if (duk_is_function(ctx, -1))
+        {
+            duk_push_lstring(ctx, json.data(), json.size());
+            duk_json_decode(ctx, -1);
+            if (duk_pcall(ctx, 1) != DUK_EXEC_SUCCESS && !_terminating)
+            {
+                PostResult({ duk_safe_to_string(ctx, -1), true });
+            }
+        }
+        duk_pop(ctx);
+    }
+
+    duk_destroy_heap(ctx);
+    _currentWorker = nullptr;
+}
+
+#endif
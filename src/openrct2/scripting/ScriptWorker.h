@@ -0,0 +1,75 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "../common.h"
+#    include "Duktape.hpp"
+
+#    include <atomic>
+#    include <condition_variable>
+#    include <mutex>
+#    include <queue>
+#    include <string>
+#    include <thread>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    struct ScriptWorkerMessage
+    {
+        // A JSON encoded value posted by the worker, or the message of an error raised by the worker's script
+        std::string Data;
+        bool IsError{};
+    };
+
+    /**
+     * Runs a script in its own duktape heap on a background thread. The heap only has the postMessage function and
+     * the onmessage handler, it has no access to the game, so the only way for the script to affect the game is to post
+     * a message back to the plugin that created the worker. Messages are passed in both directions as JSON strings, so
+     * neither side ever shares a value with the other.
+     *
+     * Terminating the worker interrupts its script through duktape's execution timeout check, so a script that never
+     * returns cannot keep the game waiting for the worker thread.
+     */
+    class ScriptWorker
+    {
+    private:
+        std::string _code;
+        std::thread _thread;
+        std::mutex _mutex;
+        std::condition_variable _inboxCondition;
+        std::queue<std::string> _inbox;
+        std::vector<ScriptWorkerMessage> _outbox;
+        std::atomic<bool> _terminating{};
+
+    public:
+        explicit ScriptWorker(std::string code);
+        ScriptWorker(const ScriptWorker&) = delete;
+        ~ScriptWorker();
+
+        void QueueMessage(std::string json);
+        std::vector<ScriptWorkerMessage> ReceiveResults();
+        // Stops the worker and interrupts its running script, pending messages are discarded
+        void Terminate();
+
+        // Whether the script running on the calling thread belongs to a worker that was terminated
+        static bool IsCurrentWorkerTerminating();
+
+    private:
+        void Run();
+        void PostResult(ScriptWorkerMessage&& message);
+        bool WaitForMessage(std::string& json);
+        static duk_ret_t WorkerPostMessage(duk_context* ctx);
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
@@ -23,6 +23,7 @@
 #    include "../../ScriptEngine.h"
 #    include "../game/ScConfiguration.hpp"
 #    include "../game/ScDisposable.hpp"
+#    include "../game/ScWorker.hpp"
 #    include "../object/ScObject.hpp"
 #    include "../ride/ScTrackSegment.h"
 
@@ -301,7 +302,7 @@ namespace OpenRCT2::Scripting
             return 1;
         }
 
-        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback)
+        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback, const DukValue& options)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
             auto ctx = scriptEngine.GetContext();
@@ -328,7 +329,36 @@ namespace OpenRCT2::Scripting
                 duk_error(ctx, DUK_ERR_ERROR, "Hook type not available for this plugin type.");
             }
 
-            auto cookie = _hookEngine.Subscribe(hookType, owner, callback);
+            std::vector<std::string> filter;
+            if (options.type() == DukValue::Type::OBJECT)
+            {
+                auto actions = options["actions"];
+                if (actions.type() != DukValue::Type::UNDEFINED)
+                {
+                    if (hookType != HOOK_TYPE::ACTION_QUERY && hookType != HOOK_TYPE::ACTION_EXECUTE)
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Hook type does not support filtering by action.");
+                    }
+                    if (!actions.is_array())
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Expected array for actions");
+                    }
+                    for (const auto& action : actions.as_array())
+                    {
+                        if (action.type() != DukValue::Type::STRING)
+                        {
+                            duk_error(ctx, DUK_ERR_ERROR, "Expected string for action");
+                        }
+                        filter.push_back(action.as_string());
+                    }
+                    if (filter.empty())
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Expected at least one action");
+                    }
+                }
+            }
+
+            auto cookie = _hookEngine.Subscribe(hookType, owner, callback, std::move(filter));
             return std::make_shared<ScDisposable>([this, hookType, cookie]() { _hookEngine.Unsubscribe(hookType, cookie); });
         }
 
@@ -454,6 +484,15 @@ namespace OpenRCT2::Scripting
             ClearIntervalOrTimeout(handle);
         }
 
+        std::shared_ptr<ScWorker> createWorker(const std::string& code)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
+            auto worker = std::make_shared<ScWorker>(plugin, code);
+            scriptEngine.AddWorker(worker);
+            return worker;
+        }
+
         int32_t getIcon(const std::string& iconName)
         {
             return GetIconByName(iconName);
@@ -482,6 +521,7 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::setTimeout, "setTimeout");
             dukglue_register_method(ctx, &ScContext::clearInterval, "clearInterval");
             dukglue_register_method(ctx, &ScContext::clearTimeout, "clearTimeout");
+            dukglue_register_method(ctx, &ScContext::createWorker, "createWorker");
             dukglue_register_method(ctx, &ScContext::getIcon, "getIcon");
         }
     };
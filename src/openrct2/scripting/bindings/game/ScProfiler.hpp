@@ -11,8 +11,14 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../../../Context.h"
 #    include "../../../profiling/Profiling.h"
 #    include "../../Duktape.hpp"
+#    include "../../HookEngine.h"
+#    include "../../Plugin.h"
+#    include "../../ScriptEngine.h"
+
+#    include <sstream>
 
 namespace OpenRCT2::Scripting
 {
@@ -69,6 +75,33 @@ namespace OpenRCT2::Scripting
             return DukValue::take_from_stack(_ctx);
         }
 
+        DukValue getHookData()
+        {
+            const auto& hookLists = GetContext()->GetScriptEngine().GetHookEngine().GetHookLists();
+            duk_push_array(_ctx);
+            duk_uarridx_t index = 0;
+            for (const auto& hookList : hookLists)
+            {
+                for (const auto& hook : hookList.Hooks)
+                {
+                    const auto& statistics = hook.Statistics;
+                    DukObject obj(_ctx);
+                    obj.Set("plugin", hook.Owner->GetMetadata().Name);
+                    obj.Set("hook", GetHookName(hookList.Type));
+                    obj.Set("callCount", statistics.CallCount);
+                    obj.Set("totalTime", statistics.TotalTime);
+                    obj.Set("maxTime", statistics.MaxTime);
+                    obj.Set("heapGrowth", statistics.HeapGrowth);
+                    obj.Set("overBudgetCount", statistics.OverBudgetCount);
+                    obj.Set("disabled", hook.Disabled);
+                    obj.Take().push();
+                    duk_put_prop_index(_ctx, /* duk stack index */ -2, index);
+                    index++;
+                }
+            }
+            return DukValue::take_from_stack(_ctx);
+        }
+
         void start()
         {
             OpenRCT2::Profiling::Enable();
@@ -82,6 +115,7 @@ namespace OpenRCT2::Scripting
         void reset()
         {
             OpenRCT2::Profiling::ResetData();
+            GetContext()->GetScriptEngine().GetHookEngine().ResetStatistics();
         }
 
         bool enabled_get() const
@@ -89,14 +123,47 @@ namespace OpenRCT2::Scripting
             return OpenRCT2::Profiling::IsEnabled();
         }
 
+        void startTrace(const DukValue& slowTickThreshold)
+        {
+            double thresholdMs = 0;
+            if (slowTickThreshold.type() == DukValue::Type::NUMBER)
+            {
+                thresholdMs = slowTickThreshold.as_double();
+            }
+            OpenRCT2::Profiling::Tracing::Start(thresholdMs);
+        }
+
+        void stopTrace()
+        {
+            OpenRCT2::Profiling::Tracing::Stop();
+        }
+
+        // Plugins get the trace as a string rather than being able to write it to any path.
+        std::string getTrace() const
+        {
+            std::ostringstream out;
+            OpenRCT2::Profiling::Tracing::WriteChromeTrace(out);
+            return out.str();
+        }
+
+        bool tracing_get() const
+        {
+            return OpenRCT2::Profiling::Tracing::IsEnabled();
+        }
+
     public:
         static void Register(duk_context* ctx)
         {
             dukglue_register_method(ctx, &ScProfiler::getData, "getData");
+            dukglue_register_method(ctx, &ScProfiler::getHookData, "getHookData");
             dukglue_register_method(ctx, &ScProfiler::start, "start");
             dukglue_register_method(ctx, &ScProfiler::stop, "stop");
             dukglue_register_method(ctx, &ScProfiler::reset, "reset");
             dukglue_register_property(ctx, &ScProfiler::enabled_get, nullptr, "enabled");
+            dukglue_register_method(ctx, &ScProfiler::startTrace, "startTrace");
+            dukglue_register_method(ctx, &ScProfiler::stopTrace, "stopTrace");
+            dukglue_register_method(ctx, &ScProfiler::getTrace, "getTrace");
+            dukglue_register_property(ctx, &ScProfiler::tracing_get, nullptr, "tracing");
         }
     };
 } // namespace OpenRCT2::Scripting
@@ -0,0 +1,150 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "../../../Context.h"
+#    include "../../Duktape.hpp"
+#    include "../../ScriptEngine.h"
+#    include "../../ScriptWorker.h"
+
+#    include <algorithm>
+#    include <memory>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    class ScWorker
+    {
+    private:
+        std::shared_ptr<Plugin> _plugin;
+        std::unique_ptr<ScriptWorker> _worker;
+        std::vector<DukValue> _messageListeners;
+        std::vector<DukValue> _errorListeners;
+
+    public:
+        ScWorker(const std::shared_ptr<Plugin>& plugin, std::string code)
+            : _plugin(plugin)
+            , _worker(std::make_unique<ScriptWorker>(std::move(code)))
+        {
+        }
+
+        const std::shared_ptr<Plugin>& GetPlugin() const
+        {
+            return _plugin;
+        }
+
+        bool IsTerminated() const
+        {
+            return _worker == nullptr;
+        }
+
+        void Update()
+        {
+            if (_worker == nullptr)
+                return;
+
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            for (auto& result : _worker->ReceiveResults())
+            {
+                DukValue arg;
+                if (result.IsError)
+                {
+                    arg = ToDuk(ctx, result.Data);
+                }
+                else
+                {
+                    arg = DuktapeTryParseJson(ctx, result.Data).value_or(ToDuk(ctx, nullptr));
+                }
+
+                // Copy the listeners as they might be changed by the listeners themselves
+                auto listeners = result.IsError ? _errorListeners : _messageListeners;
+                for (const auto& listener : listeners)
+                {
+                    scriptEngine.ExecutePluginCall(_plugin, listener, { arg }, false);
+                }
+
+                // A listener may have terminated the worker
+                if (_worker == nullptr)
+                    return;
+            }
+        }
+
+        void Terminate()
+        {
+            _worker = nullptr;
+            _messageListeners.clear();
+            _errorListeners.clear();
+        }
+
+    private:
+        ScWorker* postMessage(const DukValue& value)
+        {
+            if (_worker == nullptr)
+            {
+                duk_error(value.context(), DUK_ERR_ERROR, "Worker has been terminated.");
+            }
+
+            auto ctx = value.context();
+            value.push();
+            const auto* json = duk_json_encode(ctx, -1);
+            _worker->QueueMessage(json != nullptr ? json : "null");
+            duk_pop(ctx);
+            return this;
+        }
+
+        std::vector<DukValue>* GetListeners(const std::string& eventType)
+        {
+            if (eventType == "message")
+                return &_messageListeners;
+            if (eventType == "error")
+                return &_errorListeners;
+            return nullptr;
+        }
+
+        ScWorker* on(const std::string& eventType, const DukValue& callback)
+        {
+            auto* listeners = GetListeners(eventType);
+            if (listeners != nullptr)
+            {
+                listeners->push_back(callback);
+            }
+            return this;
+        }
+
+        ScWorker* off(const std::string& eventType, const DukValue& callback)
+        {
+            auto* listeners = GetListeners(eventType);
+            if (listeners != nullptr)
+            {
+                listeners->erase(std::remove(listeners->begin(), listeners->end(), callback), listeners->end());
+            }
+            return this;
+        }
+
+        void terminate()
+        {
+            Terminate();
+        }
+
+    public:
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_method(ctx, &ScWorker::postMessage, "postMessage");
+            dukglue_register_method(ctx, &ScWorker::on, "on");
+            dukglue_register_method(ctx, &ScWorker::off, "off");
+            dukglue_register_method(ctx, &ScWorker::terminate, "terminate");
+        }
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
@@ -495,6 +495,38 @@ namespace OpenRCT2::Scripting
         return ride != nullptr ? ride->downtime : 0;
     }
 
+    DukValue ScRide::analytics_get() const
+    {
+        auto ctx = GetContext()->GetScriptEngine().GetContext();
+        auto ride = GetRide();
+        if (ride == nullptr)
+        {
+            return ToDuk(ctx, nullptr);
+        }
+
+        const auto& analytics = ride->Analytics;
+        duk_push_array(ctx);
+        for (size_t i = 0; i < analytics.History.size(); i++)
+        {
+            const auto& sample = analytics.History[i];
+            DukObject dukSample(ctx);
+            dukSample.Set("customers", sample.Customers);
+            dukSample.Set("queueLength", sample.QueueLength);
+            dukSample.Set("queueTime", sample.MaxQueueTime);
+            dukSample.Set("breakdowns", sample.Breakdowns);
+            dukSample.Set("incomePerHour", sample.IncomePerHour);
+            dukSample.Take().push();
+            duk_put_prop_index(ctx, /* duk stack index */ -2, static_cast<duk_uarridx_t>(i));
+        }
+        auto history = DukValue::take_from_stack(ctx);
+
+        DukObject obj(ctx);
+        obj.Set("queueLength", analytics.QueueLength);
+        obj.Set("queueTime", analytics.MaxQueueTime);
+        obj.Set("history", history);
+        return obj.Take();
+    }
+
     uint8_t ScRide::liftHillSpeed_get() const
     {
         auto ride = GetRide();
@@ -555,6 +587,7 @@ namespace OpenRCT2::Scripting
         dukglue_register_property(ctx, &ScRide::inspectionInterval_get, &ScRide::inspectionInterval_set, "inspectionInterval");
         dukglue_register_property(ctx, &ScRide::value_get, &ScRide::value_set, "value");
         dukglue_register_property(ctx, &ScRide::downtime_get, nullptr, "downtime");
+        dukglue_register_property(ctx, &ScRide::analytics_get, nullptr, "analytics");
         dukglue_register_property(ctx, &ScRide::liftHillSpeed_get, &ScRide::lifthillSpeed_set, "liftHillSpeed");
         dukglue_register_property(ctx, &ScRide::maxLiftHillSpeed_get, nullptr, "maxLiftHillSpeed");
         dukglue_register_property(ctx, &ScRide::minLiftHillSpeed_get, nullptr, "minLiftHillSpeed");
@@ -157,6 +157,8 @@ namespace OpenRCT2::Scripting
 
         uint8_t downtime_get() const;
 
+        DukValue analytics_get() const;
+
         uint8_t liftHillSpeed_get() const;
         void lifthillSpeed_set(uint8_t value);
 
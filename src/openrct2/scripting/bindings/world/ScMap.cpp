@@ -34,6 +34,8 @@
 #    include "../ride/ScTrackIterator.h"
 #    include "../world/ScTile.hpp"
 
+#    include <cstring>
+
 namespace OpenRCT2::Scripting
 {
     ScMap::ScMap(duk_context* ctx)
@@ -43,7 +45,7 @@ namespace OpenRCT2::Scripting
 
     DukValue ScMap::size_get() const
     {
-        return ToDuk(_context, gMapSize);
+        return ToDuk(_context, GetMapSize());
     }
 
     int32_t ScMap::numRides_get() const
@@ -314,6 +316,206 @@ namespace OpenRCT2::Scripting
         return GetObjectAsDukValue(_context, trackIterator);
     }
 
+    // Values per entity in the array returned by queryEntities: id, x, y, z and state
+    static constexpr size_t EntityQueryStride = 5;
+
+    /**
+     * Pushes a typed array of the given duktape buffer object type holding count elements of T, the elements are
+     * zeroed and returned so they can be filled in before the array is taken from the stack.
+     */
+    template<typename T> static T* PushTypedArray(duk_context* ctx, size_t count, duk_uint_t bufferObjectType)
+    {
+        const auto byteLength = count * sizeof(T);
+        auto* data = static_cast<T*>(duk_push_fixed_buffer(ctx, byteLength));
+        duk_push_buffer_object(ctx, -1, 0, byteLength, bufferObjectType);
+        duk_remove(ctx, -2);
+        return data;
+    }
+
+    template<typename T, typename TFunc>
+    static DukValue QueryTileValues(
+        duk_context* ctx, const TileCoordsXY& leftTop, const TileCoordsXY& size, duk_uint_t bufferObjectType, TFunc&& func)
+    {
+        auto* data = PushTypedArray<T>(ctx, static_cast<size_t>(size.x) * size.y, bufferObjectType);
+        for (int32_t y = 0; y < size.y; y++)
+        {
+            for (int32_t x = 0; x < size.x; x++)
+            {
+                auto* element = MapGetFirstElementAt(TileCoordsXY{ leftTop.x + x, leftTop.y + y });
+                if (element != nullptr)
+                {
+                    *data = func(element);
+                }
+                data++;
+            }
+        }
+        return DukValue::take_from_stack(ctx);
+    }
+
+    static const SurfaceElement* GetTileSurfaceElement(const TileElement* element)
+    {
+        do
+        {
+            if (element->GetType() == TileElementType::Surface)
+            {
+                return element->AsSurface();
+            }
+        } while (!(element++)->IsLastForTile());
+        return nullptr;
+    }
+
+    DukValue ScMap::queryTiles(const DukValue& dukRange, const std::string& field) const
+    {
+        // Clamp the range to the map so that the size of the array is bounded
+        const auto range = FromDuk<MapRange>(dukRange);
+        const auto& mapSize = GetMapSize();
+        const auto leftTop = TileCoordsXY{ std::clamp(range.GetLeft() / COORDS_XY_STEP, 0, mapSize.x),
+                                           std::clamp(range.GetTop() / COORDS_XY_STEP, 0, mapSize.y) };
+        const auto rightBottom = TileCoordsXY{ std::clamp(range.GetRight() / COORDS_XY_STEP, -1, mapSize.x - 1),
+                                               std::clamp(range.GetBottom() / COORDS_XY_STEP, -1, mapSize.y - 1) };
+        const auto size = TileCoordsXY{ std::max(rightBottom.x - leftTop.x + 1, 0),
+                                        std::max(rightBottom.y - leftTop.y + 1, 0) };
+
+        if (field == "surfaceHeight")
+        {
+            return QueryTileValues<uint8_t>(_context, leftTop, size, DUK_BUFOBJ_UINT8ARRAY, [](const TileElement* element) {
+                const auto* surface = GetTileSurfaceElement(element);
+                return surface != nullptr ? surface->BaseHeight : 0;
+            });
+        }
+        if (field == "waterHeight")
+        {
+            return QueryTileValues<uint16_t>(_context, leftTop, size, DUK_BUFOBJ_UINT16ARRAY, [](const TileElement* element) {
+                const auto* surface = GetTileSurfaceElement(element);
+                return static_cast<uint16_t>(surface != nullptr ? surface->GetWaterHeight() : 0);
+            });
+        }
+        if (field == "ownership")
+        {
+            return QueryTileValues<uint8_t>(_context, leftTop, size, DUK_BUFOBJ_UINT8ARRAY, [](const TileElement* element) {
+                const auto* surface = GetTileSurfaceElement(element);
+                return surface != nullptr ? surface->GetOwnership() : 0;
+            });
+        }
+        if (field == "elementTypes")
+        {
+            return QueryTileValues<uint16_t>(_context, leftTop, size, DUK_BUFOBJ_UINT16ARRAY, GetElementTypes);
+        }
+
+        duk_error(_context, DUK_ERR_ERROR, "Invalid tile field: %s", field.c_str());
+        return {};
+    }
+
+    uint16_t ScMap::GetElementTypes(const TileElement* element)
+    {
+        uint16_t types = 0;
+        do
+        {
+            // Wall and entrance are listed the other way around than in the TileElementType enum
+            switch (element->GetType())
+            {
+                case TileElementType::Surface:
+                    types |= 1 << 0;
+                    break;
+                case TileElementType::Path:
+                    types |= 1 << 1;
+                    break;
+                case TileElementType::Track:
+                    types |= 1 << 2;
+                    break;
+                case TileElementType::SmallScenery:
+                    types |= 1 << 3;
+                    break;
+                case TileElementType::Wall:
+                    types |= 1 << 4;
+                    break;
+                case TileElementType::Entrance:
+                    types |= 1 << 5;
+                    break;
+                case TileElementType::LargeScenery:
+                    types |= 1 << 6;
+                    break;
+                case TileElementType::Banner:
+                    types |= 1 << 7;
+                    break;
+            }
+        } while (!(element++)->IsLastForTile());
+        return types;
+    }
+
+    static void AddEntityQueryValues(std::vector<int32_t>& values, const EntityBase& entity, int32_t state)
+    {
+        values.push_back(entity.Id.ToUnderlying());
+        values.push_back(entity.x);
+        values.push_back(entity.y);
+        values.push_back(entity.z);
+        values.push_back(state);
+    }
+
+    DukValue ScMap::queryEntities(const std::string& type) const
+    {
+        std::vector<int32_t> values;
+        if (type == "balloon")
+        {
+            for (auto sprite : EntityList<Balloon>())
+            {
+                AddEntityQueryValues(values, *sprite, 0);
+            }
+        }
+        else if (type == "car")
+        {
+            for (auto trainHead : TrainManager::View())
+            {
+                for (auto car = trainHead; car != nullptr; car = GetEntity<Vehicle>(car->next_vehicle_on_train))
+                {
+                    AddEntityQueryValues(values, *car, EnumValue(car->status));
+                }
+            }
+        }
+        else if (type == "litter")
+        {
+            for (auto sprite : EntityList<Litter>())
+            {
+                AddEntityQueryValues(values, *sprite, EnumValue(sprite->SubType));
+            }
+        }
+        else if (type == "duck")
+        {
+            for (auto sprite : EntityList<Duck>())
+            {
+                AddEntityQueryValues(values, *sprite, 0);
+            }
+        }
+        else if (type == "peep" || type == "guest" || type == "staff")
+        {
+            if (type != "staff")
+            {
+                for (auto sprite : EntityList<Guest>())
+                {
+                    AddEntityQueryValues(values, *sprite, EnumValue(sprite->State));
+                }
+            }
+            if (type != "guest")
+            {
+                for (auto sprite : EntityList<Staff>())
+                {
+                    AddEntityQueryValues(values, *sprite, EnumValue(sprite->State));
+                }
+            }
+        }
+        else
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+        }
+
+        auto* data = PushTypedArray<int32_t>(_context, values.size(), DUK_BUFOBJ_INT32ARRAY);
+        if (!values.empty())
+        {
+            std::memcpy(data, values.data(), values.size() * sizeof(int32_t));
+        }
+        return DukValue::take_from_stack(_context);
+    }
+
     void ScMap::Register(duk_context* ctx)
     {
         dukglue_register_property(ctx, &ScMap::size_get, nullptr, "size");
@@ -327,6 +529,8 @@ namespace OpenRCT2::Scripting
         dukglue_register_method(ctx, &ScMap::getAllEntitiesOnTile, "getAllEntitiesOnTile");
         dukglue_register_method(ctx, &ScMap::createEntity, "createEntity");
         dukglue_register_method(ctx, &ScMap::getTrackIterator, "getTrackIterator");
+        dukglue_register_method(ctx, &ScMap::queryTiles, "queryTiles");
+        dukglue_register_method(ctx, &ScMap::queryEntities, "queryEntities");
     }
 
     DukValue ScMap::GetEntityAsDukValue(const EntityBase* sprite) const
@@ -49,8 +49,15 @@ namespace OpenRCT2::Scripting
 
         DukValue getTrackIterator(const DukValue& position, int32_t elementIndex) const;
 
+        DukValue queryTiles(const DukValue& range, const std::string& field) const;
+
+        DukValue queryEntities(const std::string& type) const;
+
         static void Register(duk_context* ctx);
 
+        // The element types of a tile as returned by queryTiles, in the order of TileElementType in openrct2.d.ts
+        static uint16_t GetElementTypes(const TileElement* element);
+
     private:
         DukValue GetEntityAsDukValue(const EntityBase* sprite) const;
     };
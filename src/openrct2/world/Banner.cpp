@@ -250,9 +250,10 @@ struct BannerElementWithPos
 static std::vector<BannerElementWithPos> GetAllBannerElementsOnMap()
 {
     std::vector<BannerElementWithPos> banners;
-    for (int y = 0; y < gMapSize.y; y++)
+    const auto mapSize = GetMapSize();
+    for (int y = 0; y < mapSize.y; y++)
     {
-        for (int x = 0; x < gMapSize.x; x++)
+        for (int x = 0; x < mapSize.x; x++)
         {
             const auto tilePos = TileCoordsXY{ x, y };
             for (auto* bannerElement : OpenRCT2::TileElementsView<BannerElement>(tilePos.ToCoordsXY()))
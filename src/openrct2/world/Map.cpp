@@ -52,6 +52,7 @@
 #include "TileElementsView.h"
 #include "TileInspector.h"
 #include "Wall.h"
+#include "World.h"
 
 #include <algorithm>
 #include <iterator>
@@ -91,7 +92,6 @@ uint8_t gMapSelectArrowDirection;
 TileCoordsXY gWidePathTileLoopPosition;
 uint16_t gGrassSceneryTileLoopPosition;
 
-TileCoordsXY gMapSize;
 int32_t gMapBaseZ;
 
 std::vector<CoordsXY> gMapSelectionTiles;
@@ -108,43 +108,28 @@ uint32_t gLandRemainingConstructionSales;
 
 bool gMapLandRightsUpdateSuccess;
 
-static TilePointerIndex<TileElement> _tileIndex;
-static std::vector<TileElement> _tileElements;
-static TilePointerIndex<TileElement> _tileIndexStash;
-static std::vector<TileElement> _tileElementsStash;
-static size_t _tileElementsInUse;
-static size_t _tileElementsInUseStash;
-static TileCoordsXY _mapSizeStash;
-static int32_t _currentRotationStash;
-
-void StashMap()
+const std::vector<TileElement>& GetTileElements()
 {
-    _tileIndexStash = std::move(_tileIndex);
-    _tileElementsStash = std::move(_tileElements);
-    _mapSizeStash = gMapSize;
-    _currentRotationStash = gCurrentRotation;
-    _tileElementsInUseStash = _tileElementsInUse;
+    return GetCurrentWorld().TileElements;
 }
 
-void UnstashMap()
+void SetTileElements(std::vector<TileElement>&& tileElements)
 {
-    _tileIndex = std::move(_tileIndexStash);
-    _tileElements = std::move(_tileElementsStash);
-    gMapSize = _mapSizeStash;
-    gCurrentRotation = _currentRotationStash;
-    _tileElementsInUse = _tileElementsInUseStash;
+    auto& world = GetCurrentWorld();
+    world.TileElements = std::move(tileElements);
+    world.TileIndex = TilePointerIndex<TileElement>(
+        MAXIMUM_MAP_SIZE_TECHNICAL, world.TileElements.data(), world.TileElements.size());
+    world.TileElementsInUse = world.TileElements.size();
 }
 
-const std::vector<TileElement>& GetTileElements()
+const TileCoordsXY& GetMapSize()
 {
-    return _tileElements;
+    return GetCurrentWorld().MapSize;
 }
 
-void SetTileElements(std::vector<TileElement>&& tileElements)
+void SetMapSize(const TileCoordsXY& size)
 {
-    _tileElements = std::move(tileElements);
-    _tileIndex = TilePointerIndex<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data(), _tileElements.size());
-    _tileElementsInUse = _tileElements.size();
+    GetCurrentWorld().MapSize = size;
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -167,7 +152,7 @@ static TileElement GetDefaultSurfaceElement()
 std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts()
 {
     std::vector<TileElement> newElements;
-    newElements.reserve(std::max(MIN_TILE_ELEMENTS, _tileElements.size()));
+    newElements.reserve(std::max(MIN_TILE_ELEMENTS, GetCurrentWorld().TileElements.size()));
     for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
         for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
@@ -232,30 +217,32 @@ static void ReorganiseTileElements(size_t capacity)
 
 void ReorganiseTileElements()
 {
-    ReorganiseTileElements(_tileElements.size());
+    ReorganiseTileElements(GetCurrentWorld().TileElements.size());
 }
 
 static bool MapCheckFreeElementsAndReorganise(size_t numElementsOnTile, size_t numNewElements)
 {
-    // Check hard cap on num in use tiles (this would be the size of _tileElements immediately after a reorg)
-    if (_tileElementsInUse + numNewElements > MAX_TILE_ELEMENTS)
+    auto& world = GetCurrentWorld();
+
+    // Check hard cap on num in use tiles (this would be the size of the tile elements immediately after a reorg)
+    if (world.TileElementsInUse + numNewElements > MAX_TILE_ELEMENTS)
     {
         return false;
     }
 
     auto totalElementsRequired = numElementsOnTile + numNewElements;
-    auto freeElements = _tileElements.capacity() - _tileElements.size();
+    auto freeElements = world.TileElements.capacity() - world.TileElements.size();
     if (freeElements >= totalElementsRequired)
     {
         return true;
     }
 
     // if space issue is due to fragmentation then Reorg Tiles without increasing capacity
-    if (_tileElements.size() > totalElementsRequired + _tileElementsInUse)
+    if (world.TileElements.size() > totalElementsRequired + world.TileElementsInUse)
     {
         ReorganiseTileElements();
         // This check is not expected to fail
-        freeElements = _tileElements.capacity() - _tileElements.size();
+        freeElements = world.TileElements.capacity() - world.TileElements.size();
         if (freeElements >= totalElementsRequired)
         {
             return true;
@@ -263,7 +250,7 @@ static bool MapCheckFreeElementsAndReorganise(size_t numElementsOnTile, size_t n
     }
 
     // Capacity must increase to handle the space (Note capacity can go above MAX_TILE_ELEMENTS)
-    auto newCapacity = _tileElements.capacity() * 2;
+    auto newCapacity = world.TileElements.capacity() * 2;
     ReorganiseTileElements(newCapacity);
     return true;
 }
@@ -337,7 +324,7 @@ TileElement* MapGetFirstElementAt(const TileCoordsXY& tilePos)
         LOG_VERBOSE("Trying to access element outside of range");
         return nullptr;
     }
-    return _tileIndex.GetFirstElementAt(tilePos);
+    return GetCurrentWorld().TileIndex.GetFirstElementAt(tilePos);
 }
 
 TileElement* MapGetFirstElementAt(const CoordsXY& elementPos)
@@ -395,7 +382,7 @@ void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements)
         LOG_ERROR("Trying to access element outside of range");
         return;
     }
-    _tileIndex.SetTile(tilePos, elements);
+    GetCurrentWorld().TileIndex.SetTile(tilePos, elements);
 }
 
 SurfaceElement* MapGetSurfaceElementAt(const CoordsXY& coords)
@@ -443,7 +430,7 @@ void MapInit(const TileCoordsXY& size)
 
     gGrassSceneryTileLoopPosition = 0;
     gWidePathTileLoopPosition = {};
-    gMapSize = size;
+    SetMapSize(size);
     gMapBaseZ = 7;
     MapRemoveOutOfRangeElements();
     MapAnimationAutoCreate();
@@ -462,9 +449,10 @@ void MapCountRemainingLandRights()
     gLandRemainingOwnershipSales = 0;
     gLandRemainingConstructionSales = 0;
 
-    for (int32_t y = 0; y < gMapSize.y; y++)
+    const auto mapSize = GetMapSize();
+    for (int32_t y = 0; y < mapSize.y; y++)
     {
-        for (int32_t x = 0; x < gMapSize.x; x++)
+        for (int32_t x = 0; x < mapSize.x; x++)
         {
             auto* surfaceElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y }.ToCoordsXY());
             // Surface elements are sometimes hacked out to save some space for other map elements
@@ -504,7 +492,7 @@ void MapCountRemainingLandRights()
  */
 void MapStripGhostFlagFromElements()
 {
-    for (auto& element : _tileElements)
+    for (auto& element : GetCurrentWorld().TileElements)
     {
         element.SetGhost(false);
     }
@@ -1088,10 +1076,11 @@ void TileElementRemove(TileElement* tileElement)
     // Mark the latest element with the last element flag.
     (tileElement - 1)->SetLastForTile(true);
     tileElement->BaseHeight = MAX_ELEMENT_HEIGHT;
-    _tileElementsInUse--;
-    if (tileElement == &_tileElements.back())
+    auto& world = GetCurrentWorld();
+    world.TileElementsInUse--;
+    if (tileElement == &world.TileElements.back())
     {
-        _tileElements.pop_back();
+        world.TileElements.pop_back();
     }
 }
 
@@ -1200,7 +1189,7 @@ void MapInvalidateSelectionRect()
 static size_t CountElementsOnTile(const CoordsXY& loc)
 {
     size_t count = 0;
-    auto* element = _tileIndex.GetFirstElementAt(TileCoordsXY(loc));
+    auto* element = GetCurrentWorld().TileIndex.GetFirstElementAt(TileCoordsXY(loc));
     do
     {
         count++;
@@ -1216,10 +1205,11 @@ static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNew
         return nullptr;
     }
 
-    auto oldSize = _tileElements.size();
-    _tileElements.resize(_tileElements.size() + numElementsOnTile + numNewElements);
-    _tileElementsInUse += numNewElements;
-    return &_tileElements[oldSize];
+    auto& world = GetCurrentWorld();
+    auto oldSize = world.TileElements.size();
+    world.TileElements.resize(world.TileElements.size() + numElementsOnTile + numNewElements);
+    world.TileElementsInUse += numNewElements;
+    return &world.TileElements[oldSize];
 }
 
 /**
@@ -1232,14 +1222,15 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
 
     auto numElementsOnTileOld = CountElementsOnTile(loc);
     auto* newTileElement = AllocateTileElements(numElementsOnTileOld, 1);
-    auto* originalTileElement = _tileIndex.GetFirstElementAt(tileLoc);
+    auto& tileIndex = GetCurrentWorld().TileIndex;
+    auto* originalTileElement = tileIndex.GetFirstElementAt(tileLoc);
     if (newTileElement == nullptr)
     {
         return nullptr;
     }
 
     // Set tile index pointer to point to new element block
-    _tileIndex.SetTile(tileLoc, newTileElement);
+    tileIndex.SetTile(tileLoc, newTileElement);
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
@@ -1326,9 +1317,10 @@ void MapUpdateTiles()
         }
 
         // Repeat for each 256x256 block on the map
-        for (int32_t blockY = 0; blockY < gMapSize.y; blockY += 256)
+        const auto mapSize = GetMapSize();
+        for (int32_t blockY = 0; blockY < mapSize.y; blockY += 256)
         {
-            for (int32_t blockX = 0; blockX < gMapSize.x; blockX += 256)
+            for (int32_t blockX = 0; blockX < mapSize.x; blockX += 256)
             {
                 auto mapPos = TileCoordsXY{ blockX + x, blockY + y }.ToCoordsXY();
                 auto* surfaceElement = MapGetSurfaceElementAt(mapPos);
@@ -1473,7 +1465,7 @@ static void MapExtendBoundarySurfaceExtendTile(const SurfaceElement& sourceTile,
  */
 void MapExtendBoundarySurfaceY()
 {
-    auto y = gMapSize.y - 2;
+    auto y = GetMapSize().y - 2;
     for (auto x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
     {
         auto existingTileElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y - 1 }.ToCoordsXY());
@@ -1493,7 +1485,7 @@ void MapExtendBoundarySurfaceY()
  */
 void MapExtendBoundarySurfaceX()
 {
-    auto x = gMapSize.x - 2;
+    auto x = GetMapSize().x - 2;
     for (auto y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
         auto existingTileElement = MapGetSurfaceElementAt(TileCoordsXY{ x - 1, y }.ToCoordsXY());
@@ -105,17 +105,21 @@ extern const TileCoordsXY TileDirectionDelta[];
 extern TileCoordsXY gWidePathTileLoopPosition;
 extern uint16_t gGrassSceneryTileLoopPosition;
 
-extern TileCoordsXY gMapSize;
 extern int32_t gMapBaseZ;
 
+// Size in tiles of the map of the current world
+const TileCoordsXY& GetMapSize();
+void SetMapSize(const TileCoordsXY& size);
+
 inline CoordsXY GetMapSizeUnits()
 {
-    return { (gMapSize.x - 1) * COORDS_XY_STEP, (gMapSize.y - 1) * COORDS_XY_STEP };
+    const auto& mapSize = GetMapSize();
+    return { (mapSize.x - 1) * COORDS_XY_STEP, (mapSize.y - 1) * COORDS_XY_STEP };
 }
 inline CoordsXY GetMapSizeMinus2()
 {
-    return { (gMapSize.x * COORDS_XY_STEP) + (8 * COORDS_XY_STEP - 2),
-             (gMapSize.y * COORDS_XY_STEP) + (8 * COORDS_XY_STEP - 2) };
+    const auto& mapSize = GetMapSize();
+    return { (mapSize.x * COORDS_XY_STEP) + (8 * COORDS_XY_STEP - 2), (mapSize.y * COORDS_XY_STEP) + (8 * COORDS_XY_STEP - 2) };
 }
 inline CoordsXY GetMapSizeMaxXY()
 {
@@ -153,8 +157,6 @@ extern const uint8_t tile_element_raise_styles[9][32];
 void ReorganiseTileElements();
 const std::vector<TileElement>& GetTileElements();
 void SetTileElements(std::vector<TileElement>&& tileElements);
-void StashMap();
-void UnstashMap();
 std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts();
 
 void MapInit(const TileCoordsXY& size);
@@ -0,0 +1,53 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "World.h"
+
+#include "../entity/EntityRegistry.h"
+
+using namespace OpenRCT2;
+
+thread_local World* OpenRCT2::Detail::CurrentWorld = nullptr;
+
+void EntityRegistryStateDeleter::operator()(EntityRegistryState* state) const
+{
+    DestroyEntityRegistryState(state);
+}
+
+EntityRegistryState& World::GetEntityRegistry()
+{
+    if (_entityRegistry == nullptr)
+    {
+        _entityRegistry.reset(CreateEntityRegistryState());
+    }
+    return *_entityRegistry;
+}
+
+World& OpenRCT2::GetMainWorld()
+{
+    static World mainWorld;
+    return mainWorld;
+}
+
+World& OpenRCT2::Detail::InitialiseCurrentWorld()
+{
+    CurrentWorld = &GetMainWorld();
+    return *CurrentWorld;
+}
+
+WorldScope::WorldScope(World& world)
+    : _previousWorld(Detail::CurrentWorld)
+{
+    Detail::CurrentWorld = &world;
+}
+
+WorldScope::~WorldScope()
+{
+    Detail::CurrentWorld = _previousWorld;
+}
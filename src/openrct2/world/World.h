@@ -0,0 +1,90 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Location.hpp"
+#include "TileElement.h"
+#include "TilePointerIndex.hpp"
+
+#include <memory>
+#include <vector>
+
+struct EntityRegistryState;
+
+namespace OpenRCT2
+{
+    struct EntityRegistryStateDeleter
+    {
+        void operator()(EntityRegistryState* state) const;
+    };
+
+    /**
+     * The tile elements and entities of a map. The park is held by the main world, scratch worlds can be created to
+     * place and draw things without touching the park. Map and entity functions operate on the current world of the
+     * calling thread, which is the main world unless a WorldScope says otherwise.
+     */
+    class World final
+    {
+    public:
+        TileCoordsXY MapSize{};
+        std::vector<TileElement> TileElements;
+        TilePointerIndex<TileElement> TileIndex;
+        size_t TileElementsInUse{};
+
+        World() = default;
+        World(const World&) = delete;
+        World& operator=(const World&) = delete;
+
+        /**
+         * Entity storage is large, it is only allocated once the world is first used for entities.
+         */
+        EntityRegistryState& GetEntityRegistry();
+
+    private:
+        std::unique_ptr<EntityRegistryState, EntityRegistryStateDeleter> _entityRegistry;
+    };
+
+    World& GetMainWorld();
+
+    namespace Detail
+    {
+        extern thread_local World* CurrentWorld;
+
+        World& InitialiseCurrentWorld();
+    } // namespace Detail
+
+    /**
+     * Map accessors call this for every tile, so it is inline. The main world becomes the current world of a thread
+     * on the first call.
+     */
+    inline World& GetCurrentWorld()
+    {
+        auto* world = Detail::CurrentWorld;
+        return world != nullptr ? *world : Detail::InitialiseCurrentWorld();
+    }
+
+    /**
+     * Makes a world the current world of the calling thread until the scope ends. A world must only be used by one
+     * thread at a time, and rides, objects and other park state remain shared between all worlds.
+     */
+    class WorldScope final
+    {
+    public:
+        explicit WorldScope(World& world);
+        ~WorldScope();
+
+        WorldScope(const WorldScope&) = delete;
+        WorldScope& operator=(const WorldScope&) = delete;
+
+    private:
+        World* _previousWorld;
+    };
+} // namespace OpenRCT2
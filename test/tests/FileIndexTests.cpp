@@ -0,0 +1,157 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/FileIndex.hpp>
+#include <openrct2/core/FileSystem.hpp>
+#include <openrct2/core/Path.hpp>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+struct TestIndexItem
+{
+    std::string Path;
+    std::string Content;
+
+    bool operator==(const TestIndexItem& other) const
+    {
+        return Path == other.Path && Content == other.Content;
+    }
+};
+
+class TestFileIndex final : public FileIndex<TestIndexItem>
+{
+public:
+    mutable std::atomic<int32_t> CreateCount{};
+
+    TestFileIndex(const std::string& indexPath, const std::string& directory)
+        : FileIndex("test index", 0x58444954, 1, std::string(indexPath), "*.txt", std::vector<std::string>{ directory })
+    {
+    }
+
+protected:
+    std::optional<TestIndexItem> Create(int32_t, const std::string& path) const override
+    {
+        CreateCount++;
+        return TestIndexItem{ Path::GetFileName(path), File::ReadAllText(path) };
+    }
+
+    void Serialise(DataSerialiser& ds, const TestIndexItem& item) const override
+    {
+        ds << item.Path;
+        ds << item.Content;
+    }
+};
+
+class FileIndexTest : public testing::Test
+{
+protected:
+    std::string _directory;
+    std::string _indexPath;
+
+    void SetUp() override
+    {
+        auto root = (fs::temp_directory_path() / "openrct2_file_index_test").u8string();
+        fs::remove_all(fs::u8path(root));
+        _directory = Path::Combine(root, u8"files");
+        _indexPath = Path::Combine(root, u8"test.idx");
+        fs::create_directories(fs::u8path(_directory));
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(fs::u8path(Path::GetDirectory(_indexPath)));
+    }
+
+    void WriteFile(const std::string& name, const std::string& content) const
+    {
+        File::WriteAllBytes(Path::Combine(_directory, name), content.data(), content.size());
+    }
+
+    std::vector<TestIndexItem> Load(TestFileIndex& index) const
+    {
+        auto items = index.LoadOrBuild(0);
+        std::sort(items.begin(), items.end(), [](const TestIndexItem& a, const TestIndexItem& b) { return a.Path < b.Path; });
+        return items;
+    }
+};
+
+TEST_F(FileIndexTest, IncrementalRescan)
+{
+    WriteFile("a.txt", "first");
+    WriteFile("b.txt", "second");
+    WriteFile("c.txt", "third");
+
+    {
+        TestFileIndex index(_indexPath, _directory);
+        auto items = Load(index);
+        ASSERT_EQ(index.CreateCount, 3);
+        ASSERT_EQ(items, (std::vector<TestIndexItem>{ { "a.txt", "first" }, { "b.txt", "second" }, { "c.txt", "third" } }));
+    }
+
+    // Nothing changed, every item comes from the index
+    {
+        TestFileIndex index(_indexPath, _directory);
+        auto items = Load(index);
+        ASSERT_EQ(index.CreateCount, 0);
+        ASSERT_EQ(items, (std::vector<TestIndexItem>{ { "a.txt", "first" }, { "b.txt", "second" }, { "c.txt", "third" } }));
+    }
+
+    // Only the added and the changed file are indexed again, the removed file is dropped
+    WriteFile("b.txt", "second, changed");
+    WriteFile("d.txt", "fourth");
+    File::Delete(Path::Combine(_directory, "c.txt"));
+    {
+        TestFileIndex index(_indexPath, _directory);
+        auto items = Load(index);
+        ASSERT_EQ(index.CreateCount, 2);
+        ASSERT_EQ(
+            items,
+            (std::vector<TestIndexItem>{ { "a.txt", "first" }, { "b.txt", "second, changed" }, { "d.txt", "fourth" } }));
+    }
+
+    // The rewritten index is up to date again
+    {
+        TestFileIndex index(_indexPath, _directory);
+        auto items = Load(index);
+        ASSERT_EQ(index.CreateCount, 0);
+        ASSERT_EQ(
+            items,
+            (std::vector<TestIndexItem>{ { "a.txt", "first" }, { "b.txt", "second, changed" }, { "d.txt", "fourth" } }));
+    }
+}
+
+TEST_F(FileIndexTest, IndexIsReplaced)
+{
+    WriteFile("a.txt", "first");
+    {
+        TestFileIndex index(_indexPath, _directory);
+        Load(index);
+    }
+
+    WriteFile("b.txt", "second");
+    {
+        TestFileIndex index(_indexPath, _directory);
+        Load(index);
+    }
+
+    // The index is written to a temporary file first, nothing but the index is left next to it
+    std::vector<std::string> names;
+    for (const auto& entry : fs::directory_iterator(fs::u8path(Path::GetDirectory(_indexPath))))
+    {
+        names.push_back(entry.path().filename().u8string());
+    }
+    std::sort(names.begin(), names.end());
+    ASSERT_EQ(names, (std::vector<std::string>{ "files", "test.idx" }));
+}
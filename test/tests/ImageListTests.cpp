@@ -0,0 +1,228 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/config/Config.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/Image.h>
+#include <openrct2/object/ObjectLimits.h>
+#include <openrct2/platform/Platform.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/RideEntry.h>
+#include <thread>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class TestImageSource final : public IDeferredImageSource
+{
+private:
+    std::vector<G1Element> _images;
+
+public:
+    std::atomic<int32_t> LoadCount{};
+    std::function<void()> OnLoad;
+    size_t DataSize{};
+
+    explicit TestImageSource(uint32_t count)
+        : _images(count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            _images[i].width = static_cast<int16_t>(i + 1);
+            _images[i].height = 1;
+        }
+    }
+
+    const G1Element* LoadImages() override
+    {
+        LoadCount++;
+        if (OnLoad != nullptr)
+        {
+            OnLoad();
+        }
+        // Give other threads the chance to request the same images while loading
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return _images.data();
+    }
+
+    void UnloadImages() override
+    {
+    }
+
+    size_t GetImageDataSize() const override
+    {
+        return DataSize;
+    }
+};
+
+class ImageListTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        gOpenRCT2NoGraphics = false;
+    }
+};
+
+TEST_F(ImageListTest, DeferredImagesLoadOnFirstUse)
+{
+    TestImageSource source(8);
+    auto baseImageId = GfxObjectAllocateDeferredImages(source, 8);
+    ASSERT_EQ(source.LoadCount, 0);
+
+    auto* g1 = GfxGetG1Element(baseImageId + 3);
+    ASSERT_NE(g1, nullptr);
+    ASSERT_EQ(g1->width, 4);
+    ASSERT_EQ(source.LoadCount, 1);
+
+    g1 = GfxGetG1Element(baseImageId + 7);
+    ASSERT_NE(g1, nullptr);
+    ASSERT_EQ(g1->width, 8);
+    ASSERT_EQ(source.LoadCount, 1);
+
+    GfxObjectFreeImages(baseImageId, 8);
+}
+
+TEST_F(ImageListTest, DeferredImagesLoadOnceAcrossThreads)
+{
+    TestImageSource source(64);
+    auto baseImageId = GfxObjectAllocateDeferredImages(source, 64);
+
+    std::atomic<int32_t> mismatches{};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 8; t++)
+    {
+        threads.emplace_back([&mismatches, baseImageId, t]() {
+            for (uint32_t i = t; i < 64; i += 8)
+            {
+                auto* g1 = GfxGetG1Element(baseImageId + i);
+                if (g1 == nullptr || g1->width != static_cast<int16_t>(i + 1))
+                {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(mismatches, 0);
+    ASSERT_EQ(source.LoadCount, 1);
+
+    GfxObjectFreeImages(baseImageId, 64);
+}
+
+TEST_F(ImageListTest, LoadingDeferredImagesMayUseOtherImages)
+{
+    TestImageSource sourceA(4);
+    TestImageSource sourceB(4);
+    auto baseImageIdA = GfxObjectAllocateDeferredImages(sourceA, 4);
+    auto baseImageIdB = GfxObjectAllocateDeferredImages(sourceB, 4);
+
+    // Objects are read again to load their images, which may need images of other objects
+    const G1Element* g1B = nullptr;
+    sourceA.OnLoad = [&g1B, baseImageIdB]() { g1B = GfxGetG1Element(baseImageIdB + 2); };
+
+    auto* g1A = GfxGetG1Element(baseImageIdA + 1);
+    ASSERT_NE(g1A, nullptr);
+    ASSERT_EQ(g1A->width, 2);
+    ASSERT_NE(g1B, nullptr);
+    ASSERT_EQ(g1B->width, 3);
+
+    GfxObjectFreeImages(baseImageIdB, 4);
+    GfxObjectFreeImages(baseImageIdA, 4);
+}
+
+TEST_F(ImageListTest, UnusedImagesUnloadOverBudget)
+{
+    const auto budget = gConfigGeneral.ObjectImageMemoryBudget;
+    gConfigGeneral.ObjectImageMemoryBudget = 1;
+
+    TestImageSource sourceA(4);
+    TestImageSource sourceB(4);
+    sourceA.DataSize = 1024 * 1024;
+    sourceB.DataSize = 1024 * 1024;
+    auto baseImageIdA = GfxObjectAllocateDeferredImages(sourceA, 4);
+    auto baseImageIdB = GfxObjectAllocateDeferredImages(sourceB, 4);
+    ASSERT_NE(GfxGetG1Element(baseImageIdA), nullptr);
+    ASSERT_NE(GfxGetG1Element(baseImageIdB), nullptr);
+    GfxObjectUnloadUnusedImages();
+
+    // Only B is used in the next frame, A is unloaded to get back within the budget and loaded again when used
+    ASSERT_NE(GfxGetG1Element(baseImageIdB), nullptr);
+    GfxObjectUnloadUnusedImages();
+    ASSERT_NE(GfxGetG1Element(baseImageIdB), nullptr);
+    ASSERT_EQ(sourceB.LoadCount, 1);
+    ASSERT_NE(GfxGetG1Element(baseImageIdA), nullptr);
+    ASSERT_EQ(sourceA.LoadCount, 2);
+
+    // Without a budget nothing is unloaded
+    gConfigGeneral.ObjectImageMemoryBudget = 0;
+    GfxObjectUnloadUnusedImages();
+    GfxObjectUnloadUnusedImages();
+    ASSERT_NE(GfxGetG1Element(baseImageIdA), nullptr);
+    ASSERT_NE(GfxGetG1Element(baseImageIdB), nullptr);
+    ASSERT_EQ(sourceA.LoadCount, 2);
+    ASSERT_EQ(sourceB.LoadCount, 1);
+
+    GfxObjectFreeImages(baseImageIdB, 4);
+    GfxObjectFreeImages(baseImageIdA, 4);
+    gConfigGeneral.ObjectImageMemoryBudget = budget;
+}
+
+struct ParkImageIds
+{
+    size_t UsedCount{};
+    std::vector<uint32_t> RideImageIds;
+};
+
+static ParkImageIds LoadParkImageIds(bool noGraphics)
+{
+    ParkImageIds result;
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = noGraphics;
+
+    Platform::CoreInit();
+    auto context = CreateContext();
+    if (context->Initialise() && context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6")))
+    {
+        result.UsedCount = ImageListGetUsedCount();
+        for (ObjectEntryIndex i = 0; i < MAX_RIDE_OBJECTS; i++)
+        {
+            const auto* rideEntry = GetRideEntryByIndex(i);
+            if (rideEntry != nullptr)
+            {
+                result.RideImageIds.push_back(rideEntry->images_offset);
+            }
+        }
+    }
+    return result;
+}
+
+TEST_F(ImageListTest, HeadlessAllocatesSameImageIds)
+{
+    auto withGraphics = LoadParkImageIds(false);
+    auto headless = LoadParkImageIds(true);
+
+    ASSERT_NE(withGraphics.UsedCount, 0U);
+    ASSERT_FALSE(withGraphics.RideImageIds.empty());
+    ASSERT_EQ(headless.UsedCount, withGraphics.UsedCount);
+    ASSERT_EQ(headless.RideImageIds, withGraphics.RideImageIds);
+}
@@ -13,14 +13,17 @@
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
 #include <openrct2/GameState.h>
+#include <openrct2/GameStateSnapshots.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ParkImporter.h>
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
+#include <openrct2/management/Finance.h>
 #include <openrct2/platform/Platform.h>
 #include <openrct2/ride/Ride.h>
+#include <openrct2/scenario/Scenario.h>
 #include <string>
 
 using namespace OpenRCT2;
@@ -63,3 +66,41 @@ TEST(MultiLaunchTest, all)
     }
     SUCCEED();
 }
+
+TEST(MultiLaunchTest, simulation_only)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    Platform::CoreInit();
+    auto context = CreateContext();
+    ASSERT_TRUE(context->Initialise());
+    auto* snapshots = context->GetGameStateSnapshots();
+    auto* gs = context->GetGameState();
+
+    // The simulation-only path must produce exactly the same game state as the normal path
+    ASSERT_TRUE(context->LoadParkFromFile(path));
+    for (int j = 0; j < updatesToTest; j++)
+    {
+        gs->UpdateLogic();
+    }
+    auto& expected = snapshots->CreateSnapshot();
+    snapshots->Capture(expected);
+    snapshots->LinkSnapshot(expected, gCurrentTicks, ScenarioRandState().s0);
+    auto expectedCash = gCash;
+
+    ASSERT_TRUE(context->LoadParkFromFile(path));
+    gs->Simulate(updatesToTest);
+    auto& actual = snapshots->CreateSnapshot();
+    snapshots->Capture(actual);
+    snapshots->LinkSnapshot(actual, gCurrentTicks, ScenarioRandState().s0);
+
+    auto cmpData = snapshots->Compare(expected, actual);
+    ASSERT_EQ(cmpData.tickLeft, cmpData.tickRight);
+    ASSERT_EQ(cmpData.srand0Left, cmpData.srand0Right);
+    ASSERT_TRUE(cmpData.spriteChanges.empty()) << snapshots->GetCompareDataText(cmpData);
+    ASSERT_EQ(gs->GetDate().GetMonthTicks(), 7862 + updatesToTest);
+    ASSERT_EQ(gCash, expectedCash);
+}
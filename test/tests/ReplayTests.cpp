@@ -16,13 +16,16 @@
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ReplayManager.h>
 #include <openrct2/audio/AudioContext.h>
+#include <openrct2/config/Config.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/FileScanner.h>
+#include <openrct2/core/FileSystem.hpp>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/platform/Platform.h>
 #include <openrct2/ride/Ride.h>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -69,26 +72,15 @@ class ReplayTests : public testing::TestWithParam<ReplayTestData>
 protected:
 };
 
-TEST_P(ReplayTests, RunReplay)
+static void PlayReplay(IContext& context, const ReplayTestData& testData)
 {
-    gOpenRCT2Headless = true;
-    gOpenRCT2NoGraphics = true;
-    Platform::CoreInit();
-
-    auto testData = GetParam();
-    auto replayFile = testData.filePath;
-
-    auto context = CreateContext();
-    bool initialised = context->Initialise();
-    ASSERT_TRUE(initialised);
-
-    auto gs = context->GetGameState();
+    auto gs = context.GetGameState();
     ASSERT_NE(gs, nullptr);
 
-    IReplayManager* replayManager = context->GetReplayManager();
+    IReplayManager* replayManager = context.GetReplayManager();
     ASSERT_NE(replayManager, nullptr);
 
-    bool startedReplay = replayManager->StartPlayback(replayFile);
+    bool startedReplay = replayManager->StartPlayback(testData.filePath);
     ASSERT_TRUE(startedReplay);
 
     while (replayManager->IsReplaying())
@@ -101,6 +93,34 @@ TEST_P(ReplayTests, RunReplay)
     ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
 }
 
+static void RunReplay(const ReplayTestData& testData, bool parallelSimulation)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    Platform::CoreInit();
+
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    // Trains of separate rides are updated in parallel, the replay checksums must match the serial update.
+    // The setting is restored so it does not carry over into the tests run after this one.
+    const bool previousParallelSimulation = gConfigGeneral.ParallelSimulation;
+    gConfigGeneral.ParallelSimulation = parallelSimulation;
+    PlayReplay(*context, testData);
+    gConfigGeneral.ParallelSimulation = previousParallelSimulation;
+}
+
+TEST_P(ReplayTests, RunReplay)
+{
+    RunReplay(GetParam(), false);
+}
+
+TEST_P(ReplayTests, RunReplayParallelSimulation)
+{
+    RunReplay(GetParam(), true);
+}
+
 static void PrintTo(const ReplayTestData& testData, std::ostream* os)
 {
     *os << testData.filePath;
@@ -116,3 +136,64 @@ struct PrintReplayParameter
 };
 
 INSTANTIATE_TEST_SUITE_P(Replay, ReplayTests, testing::ValuesIn(GetReplayFiles()), PrintReplayParameter());
+
+TEST(ReplayKeyframeTests, SegmentsMatchRecording)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    Platform::CoreInit();
+
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    ASSERT_TRUE(context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6")));
+    GameLoadInit();
+
+    auto gs = context->GetGameState();
+    ASSERT_NE(gs, nullptr);
+
+    IReplayManager* replayManager = context->GetReplayManager();
+    ASSERT_NE(replayManager, nullptr);
+
+    auto replayFile = (fs::temp_directory_path() / "replay_keyframes.parkrep").string();
+    bool startedRecording = replayManager->StartRecording(replayFile, 350, IReplayManager::RecordType::NORMAL, 100);
+    ASSERT_TRUE(startedRecording);
+    while (replayManager->IsRecording())
+    {
+        gs->UpdateLogic();
+    }
+
+    ReplayRecordInfo info;
+    ASSERT_TRUE(replayManager->ReadReplayInfo(replayFile, info));
+    ASSERT_EQ(info.KeyframeTicks, std::vector<uint32_t>({ 100, 200, 300 }));
+
+    // Every segment starts from its own keyframe and has to match the checksums recorded for it
+    for (uint32_t segment = 0; segment <= info.KeyframeTicks.size(); segment++)
+    {
+        ASSERT_TRUE(replayManager->StartPlaybackSegment(replayFile, segment));
+        while (replayManager->IsReplaying())
+        {
+            gs->UpdateLogic();
+            if (replayManager->IsPlaybackStateMismatching())
+                break;
+        }
+        ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+        replayManager->StopPlayback();
+    }
+
+    // Seeking backwards restores a keyframe, the playback must still match afterwards
+    ASSERT_TRUE(replayManager->StartPlayback(replayFile));
+    ASSERT_TRUE(replayManager->SeekPlayback(250));
+    ASSERT_TRUE(replayManager->SeekPlayback(120));
+    while (replayManager->IsReplaying())
+    {
+        gs->UpdateLogic();
+        if (replayManager->IsPlaybackStateMismatching())
+            break;
+    }
+    ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+    replayManager->StopPlayback();
+
+    File::Delete(replayFile);
+}
@@ -0,0 +1,154 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/platform/Platform.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/RideAnalytics.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static std::unique_ptr<Ride> CreateRideWithQueues()
+{
+    auto ride = std::make_unique<Ride>();
+    for (auto& station : ride->GetStations())
+    {
+        station.Entrance.SetNull();
+    }
+
+    auto& stations = ride->GetStations();
+    stations[0].Entrance = { 1, 1, 1, 0 };
+    stations[0].QueueLength = 10;
+    stations[0].QueueTime = 20;
+    stations[1].Entrance = { 2, 2, 1, 0 };
+    stations[1].QueueLength = 5;
+    stations[1].QueueTime = 40;
+    // Queues of stations without an entrance are not counted
+    stations[2].QueueLength = 100;
+    stations[2].QueueTime = 200;
+    return ride;
+}
+
+TEST(RideAnalyticsTest, QueuesOfAllStations)
+{
+    auto ride = CreateRideWithQueues();
+    ride->Analytics.UpdateQueues(*ride);
+    ASSERT_EQ(ride->Analytics.QueueLength, 15);
+    ASSERT_EQ(ride->Analytics.MaxQueueTime, 40);
+    ASSERT_EQ(ride->Analytics.QueueLength, ride->GetTotalQueueLength());
+    ASSERT_EQ(ride->Analytics.MaxQueueTime, ride->GetMaxQueueTime());
+}
+
+TEST(RideAnalyticsTest, SampleOfInterval)
+{
+    auto ride = CreateRideWithQueues();
+    ride->Analytics.UpdateQueues(*ride);
+    ride->cur_num_customers = 7;
+    ride->income_per_hour = 1234;
+    ride->Analytics.CurrentBreakdowns = 2;
+
+    ride->Analytics.AddSample(*ride);
+    ASSERT_EQ(ride->Analytics.History.size(), 1U);
+    const auto& sample = ride->Analytics.History.back();
+    ASSERT_EQ(sample.Customers, 7);
+    ASSERT_EQ(sample.QueueLength, 15);
+    ASSERT_EQ(sample.MaxQueueTime, 40);
+    ASSERT_EQ(sample.Breakdowns, 2);
+    ASSERT_EQ(sample.IncomePerHour, 1234);
+
+    // Breakdowns are counted per interval
+    ASSERT_EQ(ride->Analytics.CurrentBreakdowns, 0);
+    ride->Analytics.AddSample(*ride);
+    ASSERT_EQ(ride->Analytics.History.back().Breakdowns, 0);
+}
+
+TEST(RideAnalyticsTest, HistoryKeepsLatestSamples)
+{
+    auto ride = std::make_unique<Ride>();
+    const size_t numSamples = RideAnalyticsHistorySize + 10;
+    for (size_t i = 0; i < numSamples; i++)
+    {
+        ride->cur_num_customers = static_cast<uint16_t>(i);
+        ride->Analytics.AddSample(*ride);
+    }
+
+    const auto& history = ride->Analytics.History;
+    ASSERT_EQ(history.size(), RideAnalyticsHistorySize);
+    for (size_t i = 0; i < history.size(); i++)
+    {
+        ASSERT_EQ(history[i].Customers, numSamples - RideAnalyticsHistorySize + i);
+    }
+}
+
+class RideAnalyticsParkTest : public testing::Test
+{
+protected:
+    std::unique_ptr<IContext> _context;
+
+    void SetUp() override
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        Platform::CoreInit();
+
+        _context = CreateContext();
+        ASSERT_TRUE(_context->Initialise());
+        ASSERT_TRUE(_context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6")));
+    }
+
+    void TearDown() override
+    {
+        _context = nullptr;
+    }
+};
+
+TEST_F(RideAnalyticsParkTest, QueuesAreSetOnLoad)
+{
+    bool anyQueue = false;
+    for (const auto& ride : GetRideManager())
+    {
+        ASSERT_EQ(ride.Analytics.QueueLength, ride.GetTotalQueueLength());
+        ASSERT_EQ(ride.Analytics.MaxQueueTime, ride.GetMaxQueueTime());
+        anyQueue |= ride.Analytics.QueueLength != 0;
+    }
+    ASSERT_TRUE(anyQueue);
+}
+
+TEST_F(RideAnalyticsParkTest, OneSamplePerInterval)
+{
+    std::vector<uint16_t> timeouts;
+    for (const auto& ride : GetRideManager())
+    {
+        ASSERT_TRUE(ride.Analytics.History.empty());
+        timeouts.push_back(ride.num_customers_timeout);
+    }
+
+    // Every ride completes one customer interval within 960 ticks, wherever its timeout was when the park was saved
+    auto* gameState = _context->GetGameState();
+    for (int32_t i = 0; i < 960; i++)
+    {
+        gameState->UpdateLogic();
+    }
+
+    size_t index = 0;
+    for (const auto& ride : GetRideManager())
+    {
+        ASSERT_EQ(ride.Analytics.History.size(), 1U) << "ride " << ride.id.ToUnderlying();
+        ASSERT_EQ(ride.num_customers_timeout, timeouts[index]);
+        ASSERT_EQ(ride.Analytics.History.back().IncomePerHour, ride.income_per_hour);
+        index++;
+    }
+}
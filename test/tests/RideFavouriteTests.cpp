@@ -0,0 +1,160 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/actions/RideDemolishAction.h>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/Guest.h>
+#include <openrct2/entity/Peep.h>
+#include <openrct2/platform/Platform.h>
+#include <openrct2/ride/Ride.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class RideFavouriteTest : public testing::Test
+{
+protected:
+    std::unique_ptr<IContext> _context;
+    std::vector<Ride*> _rides;
+
+    void SetUp() override
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        Platform::CoreInit();
+
+        _context = CreateContext();
+        ASSERT_TRUE(_context->Initialise());
+        ASSERT_TRUE(_context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6")));
+
+        for (auto& ride : GetRideManager())
+        {
+            _rides.push_back(&ride);
+        }
+        ASSERT_GE(_rides.size(), 2U);
+    }
+
+    void TearDown() override
+    {
+        _context = nullptr;
+    }
+
+    static Guest* GetFirstGuest()
+    {
+        for (auto* guest : EntityList<Guest>())
+        {
+            return guest;
+        }
+        return nullptr;
+    }
+
+    static uint16_t CountGuestsWithFavourite(RideId rideId)
+    {
+        uint16_t count = 0;
+        for (auto* guest : EntityList<Guest>())
+        {
+            if (guest->FavouriteRide == rideId)
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+};
+
+TEST_F(RideFavouriteTest, CountsMatchAfterLoad)
+{
+    ASSERT_TRUE(RideValidateFavouritedStat());
+    for (auto* ride : _rides)
+    {
+        ASSERT_EQ(ride->guests_favourite, CountGuestsWithFavourite(ride->id));
+    }
+}
+
+TEST_F(RideFavouriteTest, ValidationDoesNotChangeCounts)
+{
+    auto* ride = _rides[0];
+    const auto count = ride->guests_favourite;
+    ride->guests_favourite++;
+
+    ASSERT_FALSE(RideValidateFavouritedStat());
+    ASSERT_EQ(ride->guests_favourite, count + 1);
+
+    RideUpdateFavouritedStat();
+    ASSERT_EQ(ride->guests_favourite, count);
+    ASSERT_TRUE(RideValidateFavouritedStat());
+}
+
+TEST_F(RideFavouriteTest, FavouriteChangeMovesCount)
+{
+    auto* guest = GetFirstGuest();
+    ASSERT_NE(guest, nullptr);
+    guest->SetFavouriteRide(RideId::GetNull());
+
+    auto* rideA = _rides[0];
+    auto* rideB = _rides[1];
+    const auto countA = rideA->guests_favourite;
+    const auto countB = rideB->guests_favourite;
+
+    guest->SetFavouriteRide(rideA->id);
+    ASSERT_EQ(rideA->guests_favourite, countA + 1);
+    ASSERT_EQ(rideB->guests_favourite, countB);
+
+    // Setting the same favourite again does not count the guest twice
+    guest->SetFavouriteRide(rideA->id);
+    ASSERT_EQ(rideA->guests_favourite, countA + 1);
+
+    guest->SetFavouriteRide(rideB->id);
+    ASSERT_EQ(rideA->guests_favourite, countA);
+    ASSERT_EQ(rideB->guests_favourite, countB + 1);
+
+    guest->SetFavouriteRide(RideId::GetNull());
+    ASSERT_EQ(rideB->guests_favourite, countB);
+    ASSERT_TRUE(RideValidateFavouritedStat());
+}
+
+TEST_F(RideFavouriteTest, RemovedGuestIsNotCounted)
+{
+    auto* guest = GetFirstGuest();
+    ASSERT_NE(guest, nullptr);
+
+    auto* ride = _rides[0];
+    guest->SetFavouriteRide(ride->id);
+    const auto count = ride->guests_favourite;
+
+    PeepEntityRemove(guest);
+    ASSERT_EQ(ride->guests_favourite, count - 1);
+    ASSERT_TRUE(RideValidateFavouritedStat());
+}
+
+TEST_F(RideFavouriteTest, DemolishedRideIsNotAFavourite)
+{
+    auto* guest = GetFirstGuest();
+    ASSERT_NE(guest, nullptr);
+
+    auto* ride = _rides[0];
+    ride->lifecycle_flags &= ~(RIDE_LIFECYCLE_INDESTRUCTIBLE | RIDE_LIFECYCLE_INDESTRUCTIBLE_TRACK);
+    const auto rideId = ride->id;
+    guest->SetFavouriteRide(rideId);
+    ASSERT_NE(CountGuestsWithFavourite(rideId), 0);
+
+    auto demolishAction = RideDemolishAction(rideId, RIDE_MODIFY_DEMOLISH);
+    ASSERT_EQ(GameActions::Execute(&demolishAction).Error, GameActions::Status::Ok);
+
+    ASSERT_EQ(GetRide(rideId), nullptr);
+    ASSERT_EQ(CountGuestsWithFavourite(rideId), 0);
+    ASSERT_TRUE(RideValidateFavouritedStat());
+}
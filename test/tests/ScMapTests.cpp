@@ -0,0 +1,55 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include <gtest/gtest.h>
+#    include <iterator>
+#    include <openrct2/scripting/bindings/world/ScMap.hpp>
+#    include <openrct2/world/TileElement.h>
+#    include <vector>
+
+using namespace OpenRCT2::Scripting;
+
+// The element types in the order of TileElementType in openrct2.d.ts
+static constexpr TileElementType ScriptElementTypes[] = {
+    TileElementType::Surface,  TileElementType::Path,     TileElementType::Track,        TileElementType::SmallScenery,
+    TileElementType::Wall,     TileElementType::Entrance, TileElementType::LargeScenery, TileElementType::Banner,
+};
+
+static uint16_t GetElementTypes(const std::vector<TileElementType>& types)
+{
+    std::vector<TileElement> elements(types.size());
+    for (size_t i = 0; i < types.size(); i++)
+    {
+        elements[i].SetType(types[i]);
+    }
+    elements.back().SetLastForTile(true);
+    return ScMap::GetElementTypes(elements.data());
+}
+
+TEST(ScMapTest, ElementTypesFollowScriptOrder)
+{
+    for (size_t bit = 0; bit < std::size(ScriptElementTypes); bit++)
+    {
+        ASSERT_EQ(GetElementTypes({ ScriptElementTypes[bit] }), 1 << bit) << "bit " << bit;
+    }
+}
+
+TEST(ScMapTest, ElementTypesOfTile)
+{
+    auto types = GetElementTypes({ TileElementType::Surface, TileElementType::Entrance, TileElementType::Wall,
+                                   TileElementType::Wall, TileElementType::Banner });
+    ASSERT_EQ(types, (1 << 0) | (1 << 4) | (1 << 5) | (1 << 7));
+
+    ASSERT_EQ(GetElementTypes({ TileElementType::Surface, TileElementType::Entrance }), (1 << 0) | (1 << 5));
+    ASSERT_EQ(GetElementTypes({ TileElementType::Surface, TileElementType::Wall }), (1 << 0) | (1 << 4));
+}
+
+#endif
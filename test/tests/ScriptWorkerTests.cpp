@@ -0,0 +1,70 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include <chrono>
+#    include <gtest/gtest.h>
+#    include <memory>
+#    include <openrct2/scripting/ScriptWorker.h>
+#    include <thread>
+#    include <vector>
+
+using namespace OpenRCT2::Scripting;
+
+static std::vector<ScriptWorkerMessage> WaitForResults(ScriptWorker& worker)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        auto results = worker.ReceiveResults();
+        if (!results.empty())
+        {
+            return results;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return {};
+}
+
+TEST(ScriptWorkerTest, PostAndReceiveMessage)
+{
+    ScriptWorker worker("onmessage = function (e) { postMessage({ sum: e.a + e.b, text: e.text + '!' }); };");
+    worker.QueueMessage(R"({"a":2,"b":3,"text":"hello"})");
+
+    auto results = WaitForResults(worker);
+    ASSERT_EQ(results.size(), 1U);
+    ASSERT_FALSE(results[0].IsError);
+    ASSERT_EQ(results[0].Data, R"({"sum":5,"text":"hello!"})");
+}
+
+TEST(ScriptWorkerTest, ScriptErrorIsReported)
+{
+    ScriptWorker worker("onmessage = function (e) { throw new Error('bad ' + e); };");
+    worker.QueueMessage("1");
+
+    auto results = WaitForResults(worker);
+    ASSERT_EQ(results.size(), 1U);
+    ASSERT_TRUE(results[0].IsError);
+    ASSERT_EQ(results[0].Data, "Error: bad 1");
+}
+
+TEST(ScriptWorkerTest, TerminateInterruptsEndlessScript)
+{
+    auto worker = std::make_unique<ScriptWorker>("onmessage = function () { postMessage(1); while (true) {} };");
+    worker->QueueMessage("null");
+    ASSERT_EQ(WaitForResults(*worker).size(), 1U);
+
+    // Destroying the worker joins its thread, which must not wait for the script to return
+    auto start = std::chrono::steady_clock::now();
+    worker = nullptr;
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+#endif
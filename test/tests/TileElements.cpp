@@ -17,6 +17,8 @@
 #include <openrct2/ParkImporter.h>
 #include <openrct2/world/Footpath.h>
 #include <openrct2/world/Map.h>
+#include <openrct2/world/World.h>
+#include <thread>
 
 using namespace OpenRCT2;
 
@@ -171,3 +173,28 @@ TEST_F(TileElementWantsFootpathConnection, MapEdge)
     // The tile in the -X direction is a normal tile and should not be marked as an edge
     EXPECT_FALSE(edges & (1 << 2));
 }
+
+TEST_F(TileElementWantsFootpathConnection, ScratchWorld)
+{
+    // Scratch worlds on other threads must not see or change the park's map
+    const auto parkMapSize = GetMapSize();
+    const auto* pathElement = MapGetFootpathElement(TileCoordsXYZ{ 19, 18, 14 }.ToCoordsXYZ());
+    ASSERT_NE(pathElement, nullptr);
+
+    std::thread worker([] {
+        World scratchWorld;
+        WorldScope scratchWorldScope(scratchWorld);
+        TileElement surfaceElement{};
+        surfaceElement.ClearAs(TileElementType::Surface);
+        surfaceElement.SetLastForTile(true);
+        SetTileElements(std::vector<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL, surfaceElement));
+        SetMapSize({ 32, 32 });
+
+        EXPECT_EQ(GetMapSize(), TileCoordsXY(32, 32));
+        EXPECT_EQ(MapGetFootpathElement(TileCoordsXYZ{ 19, 18, 14 }.ToCoordsXYZ()), nullptr);
+    });
+    worker.join();
+
+    EXPECT_EQ(GetMapSize(), parkMapSize);
+    EXPECT_EQ(MapGetFootpathElement(TileCoordsXYZ{ 19, 18, 14 }.ToCoordsXYZ()), pathElement);
+}
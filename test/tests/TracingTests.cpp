@@ -0,0 +1,81 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <openrct2/profiling/Tracing.h>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace OpenRCT2::Profiling;
+
+static void RunWorker(const char* name)
+{
+    std::thread worker([name]() {
+        Tracing::Detail::Begin(name);
+        Tracing::Detail::End(name);
+    });
+    worker.join();
+}
+
+static size_t CountOccurrences(const std::string& str, const std::string& value)
+{
+    size_t count = 0;
+    for (auto pos = str.find(value); pos != std::string::npos; pos = str.find(value, pos + 1))
+    {
+        count++;
+    }
+    return count;
+}
+
+static std::string GetChromeTrace()
+{
+    std::ostringstream out;
+    Tracing::WriteChromeTrace(out);
+    return out.str();
+}
+
+TEST(TracingTest, RecordsWorkerThreads)
+{
+    Tracing::Start();
+    {
+        Tracing::ScopedTick tick(1);
+        RunWorker("WorkerInTick");
+    }
+    RunWorker("WorkerOutsideTick");
+    Tracing::Stop();
+
+    auto trace = GetChromeTrace();
+    ASSERT_EQ(CountOccurrences(trace, "\"WorkerInTick\""), 2U);
+    ASSERT_EQ(CountOccurrences(trace, "\"WorkerOutsideTick\""), 2U);
+}
+
+TEST(TracingTest, SlowTicksKeepWorkerEvents)
+{
+    Tracing::Start(20);
+    {
+        Tracing::ScopedTick tick(1);
+        RunWorker("WorkerInSlowTick");
+        std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    }
+    {
+        Tracing::ScopedTick tick(2);
+        RunWorker("WorkerInFastTick");
+    }
+    RunWorker("WorkerOutsideTick");
+    Tracing::Stop();
+
+    auto trace = GetChromeTrace();
+    ASSERT_EQ(CountOccurrences(trace, "\"args\":{\"tick\":1}"), 1U);
+    ASSERT_EQ(CountOccurrences(trace, "\"args\":{\"tick\":2}"), 0U);
+    ASSERT_EQ(CountOccurrences(trace, "\"WorkerInSlowTick\""), 2U);
+    ASSERT_EQ(CountOccurrences(trace, "\"WorkerInFastTick\""), 0U);
+    ASSERT_EQ(CountOccurrences(trace, "\"WorkerOutsideTick\""), 0U);
+}
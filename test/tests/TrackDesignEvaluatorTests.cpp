@@ -0,0 +1,144 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Cheats.h>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/PlatformEnvironment.h>
+#include <openrct2/core/FileScanner.h>
+#include <openrct2/core/Path.hpp>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/object/ObjectManager.h>
+#include <openrct2/platform/Platform.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/TrackDesign.h>
+#include <openrct2/ride/TrackDesignEvaluator.h>
+#include <openrct2/scenario/Scenario.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/Park.h>
+#include <utility>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class TrackDesignEvaluatorTest : public testing::Test
+{
+protected:
+    std::unique_ptr<IContext> _context;
+
+    void SetUp() override
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        Platform::CoreInit();
+
+        _context = CreateContext();
+        ASSERT_TRUE(_context->Initialise());
+        ASSERT_TRUE(_context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6")));
+    }
+
+    void TearDown() override
+    {
+        _context = nullptr;
+    }
+
+    // The first of the designs that come with RollerCoaster Tycoon 2
+    u8string GetBundledDesignPath() const
+    {
+        auto env = _context->GetPlatformEnvironment();
+        auto directory = env->GetDirectoryPath(DIRBASE::RCT2, DIRID::TRACK);
+
+        std::vector<u8string> paths;
+        auto scanner = Path::ScanDirectory(Path::Combine(directory, u8"*.td6"), true);
+        while (scanner->Next())
+        {
+            paths.push_back(scanner->GetPath());
+        }
+        std::sort(paths.begin(), paths.end());
+        return paths.empty() ? u8string() : paths.front();
+    }
+
+    static std::vector<std::pair<RideId, ride_type_t>> GetRides()
+    {
+        std::vector<std::pair<RideId, ride_type_t>> rides;
+        for (const auto& ride : GetRideManager())
+        {
+            rides.emplace_back(ride.id, ride.type);
+        }
+        return rides;
+    }
+};
+
+TEST_F(TrackDesignEvaluatorTest, RatesBundledDesign)
+{
+    auto path = GetBundledDesignPath();
+    ASSERT_FALSE(path.empty());
+
+    auto evaluation = TrackDesignEvaluate(path);
+    ASSERT_TRUE(evaluation.IsValid()) << path << ": " << evaluation.Error;
+    ASSERT_NE(evaluation.Ratings.Excitement, RIDE_RATING_UNDEFINED);
+    ASSERT_GT(evaluation.Ratings.Excitement, 0);
+    ASSERT_GT(evaluation.Ratings.Intensity, 0);
+    ASSERT_GT(evaluation.RideLength, 0);
+    ASSERT_GT(evaluation.TestTicks, 0U);
+
+    // The test run does not depend on anything left behind by the previous evaluation
+    auto again = TrackDesignEvaluate(path);
+    ASSERT_TRUE(again.IsValid());
+    ASSERT_EQ(again.Ratings.Excitement, evaluation.Ratings.Excitement);
+    ASSERT_EQ(again.Ratings.Intensity, evaluation.Ratings.Intensity);
+    ASSERT_EQ(again.Ratings.Nausea, evaluation.Ratings.Nausea);
+    ASSERT_EQ(again.TestTicks, evaluation.TestTicks);
+}
+
+TEST_F(TrackDesignEvaluatorTest, ParkIsLeftUntouched)
+{
+    auto path = GetBundledDesignPath();
+    ASSERT_FALSE(path.empty());
+
+    auto td = TrackDesignImport(path.c_str());
+    ASSERT_NE(td, nullptr);
+    auto& objectManager = _context->GetObjectManager();
+    const bool vehicleLoaded = objectManager.GetLoadedObject(td->vehicle_object) != nullptr;
+
+    const auto rides = GetRides();
+    const auto mapSize = GetMapSize();
+    const auto numTileElements = GetTileElements().size();
+    const auto numVehicles = GetEntityListCount(EntityType::Vehicle);
+    const auto numGuests = GetEntityListCount(EntityType::Guest);
+    const auto currentTicks = gCurrentTicks;
+    const auto randState = ScenarioRandState();
+    const auto screenFlags = gScreenFlags;
+    const auto parkFlags = gParkFlags;
+    const auto sandboxMode = gCheatsSandboxMode;
+    const auto disableAllBreakdowns = gCheatsDisableAllBreakdowns;
+
+    auto evaluation = TrackDesignEvaluate(path);
+    ASSERT_TRUE(evaluation.IsValid()) << path << ": " << evaluation.Error;
+
+    ASSERT_EQ(GetRides(), rides);
+    ASSERT_EQ(GetMapSize(), mapSize);
+    ASSERT_EQ(GetTileElements().size(), numTileElements);
+    ASSERT_EQ(GetEntityListCount(EntityType::Vehicle), numVehicles);
+    ASSERT_EQ(GetEntityListCount(EntityType::Guest), numGuests);
+    ASSERT_EQ(gCurrentTicks, currentTicks);
+    ASSERT_EQ(ScenarioRandState().s0, randState.s0);
+    ASSERT_EQ(ScenarioRandState().s1, randState.s1);
+    ASSERT_EQ(gScreenFlags, screenFlags);
+    ASSERT_EQ(gParkFlags, parkFlags);
+    ASSERT_EQ(gCheatsSandboxMode, sandboxMode);
+    ASSERT_EQ(gCheatsDisableAllBreakdowns, disableAllBreakdowns);
+    ASSERT_EQ(objectManager.GetLoadedObject(td->vehicle_object) != nullptr, vehicleLoaded);
+}
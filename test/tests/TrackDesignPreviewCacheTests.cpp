@@ -0,0 +1,156 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/FileSystem.hpp>
+#include <openrct2/core/Path.hpp>
+#include <openrct2/ride/TrackDesign.h>
+#include <openrct2/ride/TrackDesignPreviewCache.h>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class TrackDesignPreviewCacheTest : public testing::Test
+{
+protected:
+    static constexpr const char* ObjectsKey = "objects";
+
+    u8string _directory;
+    u8string _cacheDirectory;
+
+    void SetUp() override
+    {
+        _directory = (fs::temp_directory_path() / "openrct2_track_preview_test").u8string();
+        _cacheDirectory = Path::Combine(_directory, u8"cache");
+        fs::remove_all(fs::u8path(_directory));
+        fs::create_directories(fs::u8path(_directory));
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(fs::u8path(_directory));
+    }
+
+    u8string WriteDesign(const u8string& name, const std::vector<uint8_t>& data) const
+    {
+        auto path = Path::Combine(_directory, name);
+        File::WriteAllBytes(path, data.data(), data.size());
+        return path;
+    }
+
+    // Long runs of the background colour with noisy sprites in between, like a rendered preview
+    static std::vector<uint8_t> CreatePreview()
+    {
+        std::vector<uint8_t> pixels(TRACK_PREVIEW_IMAGE_SIZE * 4);
+        uint32_t noise = 12345;
+        for (size_t i = 0; i < pixels.size(); i++)
+        {
+            if ((i / 1000) % 3 == 0)
+            {
+                noise = noise * 1103515245 + 12345;
+                pixels[i] = static_cast<uint8_t>(noise >> 16);
+            }
+        }
+        return pixels;
+    }
+};
+
+TEST_F(TrackDesignPreviewCacheTest, RoundTrip)
+{
+    auto path = WriteDesign(u8"design.td6", { 1, 2, 3, 4 });
+    auto expected = CreatePreview();
+    std::vector<uint8_t> actual(expected.size());
+    TrackDesignPreviewCache::Placement placement;
+    {
+        TrackDesignPreviewCache cache(_cacheDirectory, ObjectsKey);
+        ASSERT_FALSE(cache.Get(path, actual.data(), placement));
+        cache.Store(path, expected.data(), { 1234, 2 });
+        ASSERT_TRUE(cache.Get(path, actual.data(), placement));
+        ASSERT_EQ(actual, expected);
+        ASSERT_EQ(placement.Cost, 1234);
+        ASSERT_EQ(placement.TrackFlags, 2);
+    }
+
+    // Destroying the cache finishes writing, a new one reads the preview back from disk
+    std::fill(actual.begin(), actual.end(), 0);
+    placement = {};
+    TrackDesignPreviewCache cache(_cacheDirectory, ObjectsKey);
+    ASSERT_TRUE(cache.Get(path, actual.data(), placement));
+    ASSERT_EQ(actual, expected);
+    ASSERT_EQ(placement.Cost, 1234);
+    ASSERT_EQ(placement.TrackFlags, 2);
+}
+
+TEST_F(TrackDesignPreviewCacheTest, KeyedByDesignContents)
+{
+    auto path = WriteDesign(u8"design.td6", { 1, 2, 3, 4 });
+    auto expected = CreatePreview();
+    {
+        TrackDesignPreviewCache cache(_cacheDirectory, ObjectsKey);
+        cache.Store(path, expected.data(), { 1234, 2 });
+    }
+
+    // A copy of the design under another name shares its preview
+    auto copyPath = WriteDesign(u8"copy.td6", { 1, 2, 3, 4 });
+    std::vector<uint8_t> actual(expected.size());
+    TrackDesignPreviewCache::Placement placement;
+    {
+        TrackDesignPreviewCache cache(_cacheDirectory, ObjectsKey);
+        ASSERT_TRUE(cache.Get(copyPath, actual.data(), placement));
+        ASSERT_EQ(actual, expected);
+    }
+
+    // A changed design has to be painted again
+    WriteDesign(u8"design.td6", { 1, 2, 3, 5 });
+    TrackDesignPreviewCache cache(_cacheDirectory, ObjectsKey);
+    ASSERT_FALSE(cache.Get(path, actual.data(), placement));
+}
+
+TEST_F(TrackDesignPreviewCacheTest, KeyedByObjects)
+{
+    auto path = WriteDesign(u8"design.td6", { 1, 2, 3, 4 });
+    auto expected = CreatePreview();
+    {
+        TrackDesignPreviewCache cache(_cacheDirectory, ObjectsKey);
+        cache.Store(path, expected.data(), { 1234, 2 });
+    }
+
+    // The same design placed with other objects has to be painted again
+    std::vector<uint8_t> actual(expected.size());
+    TrackDesignPreviewCache::Placement placement;
+    {
+        TrackDesignPreviewCache cache(_cacheDirectory, "other objects");
+        ASSERT_FALSE(cache.Get(path, actual.data(), placement));
+    }
+
+    TrackDesignPreviewCache cache(_cacheDirectory, ObjectsKey);
+    ASSERT_TRUE(cache.Get(path, actual.data(), placement));
+    ASSERT_EQ(actual, expected);
+}
+
+TEST_F(TrackDesignPreviewCacheTest, Prefetch)
+{
+    auto path = WriteDesign(u8"design.td6", { 1, 2, 3, 4 });
+    auto missingPath = WriteDesign(u8"missing.td6", { 5, 6, 7, 8 });
+    auto expected = CreatePreview();
+    {
+        TrackDesignPreviewCache cache(_cacheDirectory, ObjectsKey);
+        cache.Store(path, expected.data(), { 1234, 2 });
+    }
+
+    TrackDesignPreviewCache cache(_cacheDirectory, ObjectsKey);
+    cache.Prefetch({ missingPath, path });
+    std::vector<uint8_t> actual(expected.size());
+    TrackDesignPreviewCache::Placement placement;
+    ASSERT_TRUE(cache.Get(path, actual.data(), placement));
+    ASSERT_EQ(actual, expected);
+    ASSERT_FALSE(cache.Get(missingPath, actual.data(), placement));
+}
@@ -0,0 +1,15 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <openrct2/ride/TrackPaint.h>
+
+// Hand-written track paint functions of rides that are now painted from TrackPaintPiece tables
+TRACK_PAINT_FUNCTION GetTrackPaintFunctionInvertedImpulseRCReference(int32_t trackType);
@@ -0,0 +1,165 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackPaintReference.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/core/String.hpp>
+#include <openrct2/paint/Paint.SessionFlags.h>
+#include <openrct2/paint/Paint.h>
+#include <openrct2/platform/Platform.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/Track.h>
+#include <openrct2/ride/TrackData.h>
+#include <openrct2/ride/TrackPaint.h>
+#include <openrct2/world/TileElement.h>
+#include <string>
+
+using namespace OpenRCT2;
+
+class TrackPaintTableTest : public testing::Test
+{
+protected:
+    static void DescribePaintStruct(std::string& out, const PaintStruct* ps, int32_t depth)
+    {
+        for (; ps != nullptr; ps = ps->children)
+        {
+            out += String::StdFormat(
+                "%*sps image %08X at (%d, %d) bounds (%d, %d, %d)-(%d, %d, %d)\n", depth * 2, "", ps->image_id.ToUInt32(),
+                ps->x, ps->y, ps->bounds.x, ps->bounds.y, ps->bounds.z, ps->bounds.x_end, ps->bounds.y_end,
+                ps->bounds.z_end);
+            for (const auto* attached = ps->attached_ps; attached != nullptr; attached = attached->next)
+            {
+                out += String::StdFormat(
+                    "%*sattached image %08X at (%d, %d)\n", depth * 2 + 2, "", attached->image_id.ToUInt32(), attached->x,
+                    attached->y);
+            }
+            depth++;
+        }
+    }
+
+    // Paints one tile of a track piece and describes everything the paint function left in the session
+    static std::string Paint(
+        TRACK_PAINT_FUNCTION paintFunction, const CoordsXY& mapPos, uint8_t rotation, uint8_t trackSequence,
+        uint8_t direction, int32_t height)
+    {
+        // Large enough that no sprite is culled
+        DrawPixelInfo dpi{};
+        dpi.x = -16384;
+        dpi.y = -16384;
+        dpi.width = 32768;
+        dpi.height = 32768;
+
+        auto* session = PaintSessionAlloc(&dpi, 0);
+        session->CurrentRotation = rotation;
+        session->MapPosition = mapPos;
+        session->SpritePosition = mapPos;
+        session->Flags = PaintSessionFlags::PassedSurface;
+        session->TrackColours[SCHEME_TRACK] = ImageId(0, COLOUR_BRIGHT_RED, COLOUR_LIGHT_BLUE);
+        session->TrackColours[SCHEME_SUPPORTS] = ImageId(0, COLOUR_YELLOW, COLOUR_DARK_GREEN);
+        session->TrackColours[SCHEME_MISC] = ImageId(0, COLOUR_GREY, COLOUR_BLACK);
+        session->TrackColours[SCHEME_3] = ImageId(0, COLOUR_WHITE, COLOUR_BORDEAUX_RED);
+        session->LeftTunnelCount = 0;
+        session->RightTunnelCount = 0;
+        session->LeftTunnels[0] = { 0xFF, 0xFF };
+        session->RightTunnels[0] = { 0xFF, 0xFF };
+        session->VerticalTunnelHeight = 0xFF;
+        // Flat ground at height 0, so supports reach all the way down
+        session->Support = { 0, 0, 0 };
+        for (auto& segment : session->SupportSegments)
+        {
+            segment = { 0, 0, 0 };
+        }
+
+        Ride ride{};
+        TileElement tileElement{};
+        tileElement.SetType(TileElementType::Track);
+        paintFunction(*session, ride, trackSequence, direction, height, *tileElement.AsTrack());
+
+        std::string out;
+        for (uint32_t quadrant = session->QuadrantBackIndex; quadrant <= session->QuadrantFrontIndex; quadrant++)
+        {
+            for (const auto* ps = session->Quadrants[quadrant]; ps != nullptr; ps = ps->next_quadrant_ps)
+            {
+                DescribePaintStruct(out, ps, 0);
+            }
+        }
+        for (const auto& segment : session->SupportSegments)
+        {
+            out += String::StdFormat("segment %u %u\n", segment.height, segment.slope);
+        }
+        out += String::StdFormat("general support %u %u\n", session->Support.height, session->Support.slope);
+        for (uint8_t i = 0; i < session->LeftTunnelCount; i++)
+        {
+            out += String::StdFormat("left tunnel %u %u\n", session->LeftTunnels[i].height, session->LeftTunnels[i].type);
+        }
+        for (uint8_t i = 0; i < session->RightTunnelCount; i++)
+        {
+            out += String::StdFormat("right tunnel %u %u\n", session->RightTunnels[i].height, session->RightTunnels[i].type);
+        }
+        out += String::StdFormat("vertical tunnel %u\n", session->VerticalTunnelHeight);
+
+        PaintSessionFree(session);
+        return out;
+    }
+
+    static void ExpectSameAsReference(TRACK_PAINT_FUNCTION_GETTER getter, TRACK_PAINT_FUNCTION_GETTER referenceGetter)
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = false;
+
+        Platform::CoreInit();
+        auto context = CreateContext();
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        // Supports are only painted on some tiles of certain pieces, so tiles on both sides of the pattern are painted
+        static constexpr CoordsXY mapPositions[] = { { 64, 64 }, { 96, 64 }, { 64, 96 }, { 96, 96 } };
+        static constexpr int32_t heights[] = { 48, 160 };
+
+        for (track_type_t trackType = 0; trackType < TrackElemType::Count; trackType++)
+        {
+            auto paintFunction = getter(trackType);
+            auto referenceFunction = referenceGetter(trackType);
+            ASSERT_EQ(paintFunction == nullptr, referenceFunction == nullptr) << "track type " << trackType;
+            if (paintFunction == nullptr)
+                continue;
+
+            const auto& ted = TrackMetaData::GetTrackElementDescriptor(trackType);
+            for (uint8_t trackSequence = 0; ted.GetBlockForSequence(trackSequence) != nullptr; trackSequence++)
+            {
+                for (uint8_t rotation = 0; rotation < NumOrthogonalDirections; rotation++)
+                {
+                    for (uint8_t direction = 0; direction < NumOrthogonalDirections; direction++)
+                    {
+                        for (const auto& mapPos : mapPositions)
+                        {
+                            for (auto height : heights)
+                            {
+                                SCOPED_TRACE(String::StdFormat(
+                                    "track type %u, sequence %u, rotation %u, direction %u, tile (%d, %d), height %d",
+                                    trackType, trackSequence, rotation, direction, mapPos.x, mapPos.y, height));
+                                auto actual = Paint(paintFunction, mapPos, rotation, trackSequence, direction, height);
+                                auto expected = Paint(referenceFunction, mapPos, rotation, trackSequence, direction, height);
+                                ASSERT_EQ(actual, expected);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+TEST_F(TrackPaintTableTest, InvertedImpulseCoaster)
+{
+    ExpectSameAsReference(GetTrackPaintFunctionInvertedImpulseRC, GetTrackPaintFunctionInvertedImpulseRCReference);
+}
@@ -0,0 +1,125 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <limits>
+#include <openrct2/ride/Track.h>
+#include <openrct2/ride/Vehicle.h>
+#include <openrct2/ride/VehicleData.h>
+#include <openrct2/ride/VehicleMotionTables.h>
+#include <openrct2/ride/VehicleSubpositionData.h>
+#include <unordered_set>
+#include <vector>
+
+// Distances left to a vehicle at the start of a step, from slow vehicles that stop on the next point to fast ones that
+// cross whole pieces
+static constexpr int32_t RemainingDistances[] = {
+    0x368A, 0x368B, 0x4000, 0x6000, 0x8000, 0xC000, 0x10000, 0x18000, 0x20000, 0x40000, 0x80000, 0x100000, 0x400000,
+};
+
+// Moves one point at a time like the loop in Vehicle::UpdateTrackMotionForwards
+static VehicleMotionResult StepAlongPiece(
+    const VehicleInfo* info, uint16_t numPoints, uint16_t trackProgress, int32_t remainingDistance)
+{
+    VehicleMotionResult result{};
+    auto progress = trackProgress;
+    while (progress + 1 < numPoints)
+    {
+        progress++;
+
+        uint8_t remainingDistanceFlags = 0;
+        if (info[progress].x != info[progress - 1].x)
+        {
+            remainingDistanceFlags |= 1;
+        }
+        if (info[progress].y != info[progress - 1].y)
+        {
+            remainingDistanceFlags |= 2;
+        }
+        if (info[progress].z != info[progress - 1].z)
+        {
+            remainingDistanceFlags |= 4;
+        }
+        remainingDistance -= SubpositionTranslationDistances[remainingDistanceFlags];
+        result.Distance += SubpositionTranslationDistances[remainingDistanceFlags];
+        if (remainingDistance < 0x368A)
+        {
+            result.OutOfDistance = true;
+            break;
+        }
+
+        result.Acceleration += AccelerationFromPitch[info[progress].Pitch];
+        result.PointsPassed++;
+    }
+    result.TrackProgress = progress;
+    return result;
+}
+
+TEST(VehicleMotionTest, SkipMatchesSteppingOnAllPieces)
+{
+    size_t numPaths = 0;
+    std::unordered_set<const VehicleInfo*> testedPaths;
+    for (size_t subposition = 0; subposition < EnumValue(VehicleTrackSubposition::Count); subposition++)
+    {
+        const auto trackSubposition = static_cast<VehicleTrackSubposition>(subposition);
+        for (track_type_t type = 0; type < TrackElemType::Count; type++)
+        {
+            for (uint8_t direction = 0; direction < NumOrthogonalDirections; direction++)
+            {
+                const auto numPoints = VehicleGetMoveInfoSize(trackSubposition, type, direction);
+                const auto* points = VehicleGetMotionPoints(trackSubposition, type, direction);
+                if (numPoints == 0)
+                {
+                    ASSERT_EQ(points, nullptr);
+                    continue;
+                }
+                ASSERT_NE(points, nullptr);
+
+                // Paths are shared between many pieces, each list only has to be checked once
+                const auto* info = gTrackVehicleInfo[subposition][(type << 2) | direction]->info;
+                if (!testedPaths.insert(info).second)
+                {
+                    continue;
+                }
+                numPaths++;
+
+                for (uint16_t trackProgress = 0; trackProgress + 1 < numPoints; trackProgress++)
+                {
+                    // Also stop exactly on, and just before, the next point and the end of the piece
+                    const auto nextDistance = static_cast<int32_t>(StepAlongPiece(info, numPoints, trackProgress, 0).Distance);
+                    const auto pieceDistance = static_cast<int32_t>(
+                        StepAlongPiece(info, numPoints, trackProgress, std::numeric_limits<int32_t>::max()).Distance);
+                    std::vector<int32_t> remainingDistances(std::begin(RemainingDistances), std::end(RemainingDistances));
+                    for (auto distance : { nextDistance, pieceDistance })
+                    {
+                        remainingDistances.push_back(std::max(distance + 0x368A - 1, 0x368A));
+                        remainingDistances.push_back(distance + 0x368A);
+                    }
+
+                    for (auto remainingDistance : remainingDistances)
+                    {
+                        const auto expected = StepAlongPiece(info, numPoints, trackProgress, remainingDistance);
+                        const auto actual = VehicleMoveAlongMotionPoints(points, numPoints, trackProgress, remainingDistance);
+                        ASSERT_EQ(actual.TrackProgress, expected.TrackProgress)
+                            << "subposition " << subposition << ", type " << type << ", direction "
+                            << static_cast<int32_t>(direction) << ", progress " << trackProgress << ", distance "
+                            << remainingDistance;
+                        ASSERT_EQ(actual.Distance, expected.Distance);
+                        ASSERT_EQ(actual.Acceleration, expected.Acceleration);
+                        ASSERT_EQ(actual.PointsPassed, expected.PointsPassed);
+                        ASSERT_EQ(actual.OutOfDistance, expected.OutOfDistance);
+                    }
+                }
+            }
+        }
+    }
+    ASSERT_GT(numPaths, 0U);
+}
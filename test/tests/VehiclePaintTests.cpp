@@ -0,0 +1,113 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2023 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/entity/Yaw.hpp>
+#include <openrct2/ride/CarEntry.h>
+#include <openrct2/ride/Vehicle.h>
+#include <openrct2/ride/VehiclePaint.h>
+
+using namespace OpenRCT2::Entity::Yaw;
+
+class VehiclePaintTest : public testing::Test
+{
+protected:
+    CarEntry _cars[2]{};
+
+    void SetUp() override
+    {
+        // The first car has flat banked sprites, the inverted car behind it only its flat sprites
+        auto& car = _cars[0];
+        car.base_num_frames = 1;
+        car.SpriteGroups[EnumValue(SpriteGroupType::SlopeFlat)] = { 1000, SpritePrecision::Sprites32 };
+        car.SpriteGroups[EnumValue(SpriteGroupType::FlatBanked67)] = { 2000, SpritePrecision::Sprites4 };
+        car.SpriteGroups[EnumValue(SpriteGroupType::RestraintAnimation)] = { 3000, SpritePrecision::Sprites4 };
+
+        auto& invertedCar = _cars[1];
+        invertedCar.base_num_frames = 2;
+        invertedCar.SpriteGroups[EnumValue(SpriteGroupType::SlopeFlat)] = { 4000, SpritePrecision::Sprites32 };
+    }
+
+    static Vehicle CreateVehicle(uint8_t pitch, uint8_t bankRotation, bool inverted)
+    {
+        Vehicle vehicle{};
+        vehicle.Pitch = pitch;
+        vehicle.bank_rotation = bankRotation;
+        if (inverted)
+        {
+            vehicle.SetFlag(VehicleFlags::CarIsInverted);
+        }
+        return vehicle;
+    }
+};
+
+TEST_F(VehiclePaintTest, FlatUnbanked)
+{
+    auto table = VehicleSpriteTableCreate(_cars, 0);
+    auto vehicle = CreateVehicle(0, 0, false);
+    for (int32_t imageDirection = 0; imageDirection < BaseRotation; imageDirection++)
+    {
+        const auto* entry = table.Find(vehicle, imageDirection);
+        ASSERT_NE(entry, nullptr);
+        ASSERT_EQ(entry->SpriteNum, _cars[0].SpriteOffset(SpriteGroupType::SlopeFlat, imageDirection, 0));
+        ASSERT_EQ(entry->BoundingBoxNum, YawTo16(imageDirection));
+        ASSERT_EQ(entry->CarEntryOffset, 0);
+
+        // Restraints only animate in the cardinal directions
+        const bool restraints = (entry->Flags & VehicleSpriteTable::ENTRY_FLAG_RESTRAINTS) != 0;
+        ASSERT_EQ(restraints, (imageDirection & 7) == 0);
+    }
+}
+
+TEST_F(VehiclePaintTest, MissingGroupFallsBack)
+{
+    // Without 25 degree slope sprites the car is painted flat
+    auto table = VehicleSpriteTableCreate(_cars, 0);
+    auto vehicle = CreateVehicle(2, 0, false);
+    const auto* entry = table.Find(vehicle, 5);
+    ASSERT_NE(entry, nullptr);
+    ASSERT_EQ(entry->SpriteNum, _cars[0].SpriteOffset(SpriteGroupType::SlopeFlat, 5, 0));
+    ASSERT_EQ(entry->BoundingBoxNum, YawTo16(5));
+}
+
+TEST_F(VehiclePaintTest, InvertedUsesPreviousCar)
+{
+    auto table = VehicleSpriteTableCreate(_cars, 1);
+
+    auto vehicle = CreateVehicle(0, 0, true);
+    const auto* entry = table.Find(vehicle, 9);
+    ASSERT_NE(entry, nullptr);
+    ASSERT_EQ(entry->SpriteNum, _cars[1].SpriteOffset(SpriteGroupType::SlopeFlat, 9, 0));
+    ASSERT_EQ(entry->CarEntryOffset, 0);
+
+    // Banked left 67 degrees uses the car in front, which has those sprites
+    vehicle = CreateVehicle(0, 5, true);
+    entry = table.Find(vehicle, 9);
+    ASSERT_NE(entry, nullptr);
+    ASSERT_EQ(entry->SpriteNum, _cars[0].SpriteOffset(SpriteGroupType::FlatBanked67, 9, 0));
+    ASSERT_EQ(entry->BoundingBoxNum, YawTo4(9) + 124);
+    ASSERT_EQ(entry->CarEntryOffset, -1);
+}
+
+TEST_F(VehiclePaintTest, UnusualStatesNotTabulated)
+{
+    auto table = VehicleSpriteTableCreate(_cars, 1);
+
+    auto vehicle = CreateVehicle(0, VehicleSpriteTable::NumBankRotations, false);
+    ASSERT_EQ(table.Find(vehicle, 0), nullptr);
+
+    // Inverted cars going 90 degrees down depend on the track type
+    vehicle = CreateVehicle(18, 0, true);
+    ASSERT_EQ(table.Find(vehicle, 0), nullptr);
+
+    // The first car can not be inverted
+    auto firstTable = VehicleSpriteTableCreate(_cars, 0);
+    vehicle = CreateVehicle(0, 0, true);
+    ASSERT_EQ(firstTable.Find(vehicle, 0), nullptr);
+}